@@ -0,0 +1,54 @@
+/* Host tool: prepared op data of the EON model
+ *
+ * Sets the compiled model up the way the firmware does (init and prepare of
+ * every node) and writes the op data that came out of prepare (quantized
+ * multipliers and shifts, padding, zero points) as C++ constants, to
+ * tflite-model/tflite_learn_864078_5_prepared.h. A build with
+ * EI_CLASSIFIER_PREPARED_OP_DATA=1 takes the op data from there, out of flash,
+ * and skips init and prepare of those nodes at boot.
+ *
+ * Usage: eon_prepare [output file]
+ * Writes to stdout without a file. Run it again whenever the model changes.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
+#include "tflite-model/tflite_learn_864078_5_compiled.h"
+
+static void write_file(void *user, const char *text)
+{
+    fputs(text, (FILE *)user);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [output file]\n", argv[0]);
+        return 1;
+    }
+
+    if (tflite_learn_864078_5_init(ei_aligned_calloc) != kTfLiteOk) {
+        fprintf(stderr, "Failed to set up the model\n");
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (argc == 2) {
+        out = fopen(argv[1], "w");
+        if (!out) {
+            fprintf(stderr, "Failed to open %s\n", argv[1]);
+            return 1;
+        }
+    }
+    TfLiteStatus status = tflite_learn_864078_5_write_prepared(write_file, out);
+    if (out != stdout) {
+        fclose(out);
+    }
+    tflite_learn_864078_5_reset(ei_aligned_free);
+    if (status != kTfLiteOk) {
+        fprintf(stderr, "Failed to write the op data\n");
+        return 1;
+    }
+    return 0;
+}
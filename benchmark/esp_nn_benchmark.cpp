@@ -0,0 +1,330 @@
+/* Host benchmark: ESP-NN kernels of the plain ESP32
+ *
+ * Runs the CONV_2D and DEPTHWISE_CONV_2D nodes of the compiled model (the
+ * shapes of their tensors, random weights and activations) through the ESP-NN
+ * kernels the plain ESP32 uses (esp_nn_*_opt, generic C) and through the
+ * reference ones (esp_nn_*_ansi), and prints the time of both and how far the
+ * outputs are apart. The _opt kernels requantize with the fast rounding, so an
+ * output can be off by one from the reference; more than that is an error.
+ * Convolutions also run on the filter packed ahead of time
+ * (esp_nn_conv_s8_packed_opt), which has to match esp_nn_conv_s8_opt exactly.
+ *
+ * Output size and padding are the ones the kernels get on the device: the
+ * output tensor's and what prepare computes. Where a PAD was folded into the
+ * node the output is a row and column larger than the padding mode gives.
+ * There, as with SAME padding, the last windows run past the bottom or right
+ * edge of the input (marked with *), and the reference kernel also has to
+ * match itself run on the input padded with zero points, which is what the
+ * PAD used to write.
+ *
+ * Usage: esp_nn_benchmark [-n iterations]
+ * The ESP-NN sources are built without auto-vectorization, like the code the
+ * ESP32 runs, so the times compare the C and not the host's SIMD units.
+ */
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_conv_packed.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#include "tflite-model/tflite_learn_864078_5_compiled.h"
+
+typedef struct {
+    char name[48];
+    bool depthwise;
+    int filter_wd, filter_ht;
+    int stride_wd, stride_ht;
+    int pad_wd, pad_ht;     // top and left, as prepare computes them
+    int input_wd, input_ht, in_channels;
+    int out_wd, out_ht, out_channels;
+    bool past_edge;         // windows run past the bottom or right edge
+} layer_t;
+
+static bool same_shape(const layer_t &a, const layer_t &b)
+{
+    return a.depthwise == b.depthwise && a.filter_wd == b.filter_wd && a.filter_ht == b.filter_ht &&
+        a.stride_wd == b.stride_wd && a.stride_ht == b.stride_ht && a.pad_wd == b.pad_wd &&
+        a.pad_ht == b.pad_ht && a.input_wd == b.input_wd && a.input_ht == b.input_ht &&
+        a.in_channels == b.in_channels && a.out_wd == b.out_wd && a.out_ht == b.out_ht &&
+        a.out_channels == b.out_channels;
+}
+
+// Every distinct convolution and depthwise convolution of the compiled model
+static std::vector<layer_t> model_layers()
+{
+    std::vector<layer_t> layers;
+    for (size_t ix = 0; ix < tflite_learn_864078_5_nodes(); ix++) {
+        const char *op;
+        const void *params;
+        TfLiteTensor input, filter, output;
+        if (tflite_learn_864078_5_node_shape(ix, &op, &params, &input, &filter, &output) != kTfLiteOk) {
+            break;
+        }
+        layer_t layer = {};
+        TfLitePadding padding;
+        int dilation_wd, dilation_ht;
+        if (strcmp(op, "CONV_2D") == 0) {
+            const TfLiteConvParams *conv = (const TfLiteConvParams *)params;
+            padding = conv->padding;
+            layer.stride_wd = conv->stride_width;
+            layer.stride_ht = conv->stride_height;
+            dilation_wd = conv->dilation_width_factor;
+            dilation_ht = conv->dilation_height_factor;
+        }
+        else if (strcmp(op, "DEPTHWISE_CONV_2D") == 0) {
+            const TfLiteDepthwiseConvParams *dw = (const TfLiteDepthwiseConvParams *)params;
+            padding = dw->padding;
+            layer.depthwise = true;
+            layer.stride_wd = dw->stride_width;
+            layer.stride_ht = dw->stride_height;
+            dilation_wd = dw->dilation_width_factor;
+            dilation_ht = dw->dilation_height_factor;
+        }
+        else {
+            continue;
+        }
+        // NHWC, filter OHWI (1HWC for depthwise)
+        layer.input_ht = input.dims->data[1];
+        layer.input_wd = input.dims->data[2];
+        layer.in_channels = input.dims->data[3];
+        layer.filter_ht = filter.dims->data[1];
+        layer.filter_wd = filter.dims->data[2];
+        layer.out_ht = output.dims->data[1];
+        layer.out_wd = output.dims->data[2];
+        layer.out_channels = output.dims->data[3];
+        int computed_ht, computed_wd;
+        TfLitePaddingValues pad = tflite::ComputePaddingHeightWidth(
+            layer.stride_ht, layer.stride_wd, dilation_ht, dilation_wd, layer.input_ht, layer.input_wd,
+            layer.filter_ht, layer.filter_wd, padding, &computed_ht, &computed_wd);
+        layer.pad_wd = pad.width;
+        layer.pad_ht = pad.height;
+        layer.past_edge =
+            (layer.out_wd - 1) * layer.stride_wd + layer.filter_wd - layer.pad_wd > layer.input_wd ||
+            (layer.out_ht - 1) * layer.stride_ht + layer.filter_ht - layer.pad_ht > layer.input_ht;
+        snprintf(layer.name, sizeof(layer.name), "%s %dx%d/%d %dx%dx%d ->%dx%dx%d%s",
+            layer.depthwise ? "dw" : "conv", layer.filter_wd, layer.filter_ht, layer.stride_wd,
+            layer.input_wd, layer.input_ht, layer.in_channels, layer.out_wd, layer.out_ht,
+            layer.out_channels, layer.past_edge ? " *" : "");
+
+        bool seen = false;
+        for (const layer_t &other : layers) {
+            seen = seen || same_shape(layer, other);
+        }
+        if (!seen) {
+            layers.push_back(layer);
+        }
+    }
+    return layers;
+}
+
+static void fill(std::vector<int8_t> &v)
+{
+    for (size_t ix = 0; ix < v.size(); ix++) {
+        v[ix] = (int8_t)(rand() & 0xff);
+    }
+}
+
+// Runs one kernel iterations times and returns the mean time in us
+template <typename F>
+static double time_us(int iterations, F run)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        run();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+// The input padded on the bottom and right with the value the input offset
+// cancels, up to where the last windows reach
+static std::vector<int8_t> pad_input(const layer_t &layer, const std::vector<int8_t> &input, int in_offset,
+                                     int *padded_wd, int *padded_ht)
+{
+    *padded_wd = std::max(layer.input_wd, (layer.out_wd - 1) * layer.stride_wd + layer.filter_wd - layer.pad_wd);
+    *padded_ht = std::max(layer.input_ht, (layer.out_ht - 1) * layer.stride_ht + layer.filter_ht - layer.pad_ht);
+    const size_t row = (size_t)layer.input_wd * layer.in_channels;
+    std::vector<int8_t> padded((size_t)*padded_wd * *padded_ht * layer.in_channels, (int8_t)-in_offset);
+    for (int y = 0; y < layer.input_ht; y++) {
+        memcpy(&padded[(size_t)y * *padded_wd * layer.in_channels], &input[y * row], row);
+    }
+    return padded;
+}
+
+// Returns the largest difference between the ansi and opt outputs. For a
+// convolution *packed_match says whether the packed kernel's output is the opt
+// one; for a layer whose windows run past the edge *edge_match whether the ansi
+// output is the one of the ansi kernel on the padded input
+static int run_layer(const layer_t &layer, int iterations, double *ansi_us, double *opt_us,
+                     double *packed_us, bool *packed_match, bool *edge_match)
+{
+    const int filter_in = layer.depthwise ? 1 : layer.in_channels;
+    const int in_offset = 128;
+
+    std::vector<int8_t> input((size_t)layer.input_wd * layer.input_ht * layer.in_channels);
+    std::vector<int8_t> filter((size_t)layer.out_channels * layer.filter_wd * layer.filter_ht * filter_in);
+    std::vector<int32_t> bias(layer.out_channels), mult(layer.out_channels), shift(layer.out_channels);
+    std::vector<int8_t> ansi_out((size_t)layer.out_wd * layer.out_ht * layer.out_channels);
+    std::vector<int8_t> opt_out(ansi_out.size());
+    std::vector<int8_t> packed_out(ansi_out.size());
+    std::vector<int8_t> edge_out(ansi_out.size());
+    fill(input);
+    fill(filter);
+    for (int ch = 0; ch < layer.out_channels; ch++) {
+        bias[ch] = rand() % 4001 - 2000;
+        mult[ch] = (int32_t)((1u << 30) + ((uint32_t)rand() % (1u << 30)));
+        shift[ch] = -(rand() % 5) - 6;
+    }
+    int padded_wd = layer.input_wd, padded_ht = layer.input_ht;
+    std::vector<int8_t> padded;
+    if (layer.past_edge) {
+        padded = pad_input(layer, input, in_offset, &padded_wd, &padded_ht);
+    }
+
+    data_dims_t input_dims = { layer.input_wd, layer.input_ht, layer.in_channels, 1 };
+    data_dims_t padded_dims = { padded_wd, padded_ht, layer.in_channels, 1 };
+    data_dims_t filter_dims = { layer.filter_wd, layer.filter_ht, 0, 0 };
+    data_dims_t output_dims = { layer.out_wd, layer.out_ht, layer.out_channels, 1 };
+    quant_data_t quant_data = { shift.data(), mult.data() };
+
+    if (layer.depthwise) {
+        dw_conv_params_t params = {};
+        params.in_offset = in_offset;
+        params.out_offset = -5;
+        params.ch_mult = layer.out_channels / layer.in_channels;
+        params.stride.width = layer.stride_wd;
+        params.stride.height = layer.stride_ht;
+        params.padding.width = layer.pad_wd;
+        params.padding.height = layer.pad_ht;
+        params.dilation.width = params.dilation.height = 1;
+        params.activation.min = -128;
+        params.activation.max = 127;
+        *ansi_us = time_us(iterations, [&]() {
+            esp_nn_depthwise_conv_s8_ansi(&input_dims, input.data(), &filter_dims, filter.data(),
+                                          bias.data(), &output_dims, ansi_out.data(), &params, &quant_data);
+        });
+        *opt_us = time_us(iterations, [&]() {
+            esp_nn_depthwise_conv_s8_opt(&input_dims, input.data(), &filter_dims, filter.data(),
+                                         bias.data(), &output_dims, opt_out.data(), &params, &quant_data);
+        });
+        if (layer.past_edge) {
+            esp_nn_depthwise_conv_s8_ansi(&padded_dims, padded.data(), &filter_dims, filter.data(),
+                                          bias.data(), &output_dims, edge_out.data(), &params, &quant_data);
+        }
+        *packed_us = 0;
+        *packed_match = true;
+    }
+    else {
+        conv_params_t params = {};
+        params.in_offset = in_offset;
+        params.out_offset = -5;
+        params.stride.width = layer.stride_wd;
+        params.stride.height = layer.stride_ht;
+        params.padding.width = layer.pad_wd;
+        params.padding.height = layer.pad_ht;
+        params.dilation.width = params.dilation.height = 1;
+        params.activation.min = -128;
+        params.activation.max = 127;
+        *ansi_us = time_us(iterations, [&]() {
+            esp_nn_conv_s8_ansi(&input_dims, input.data(), &filter_dims, filter.data(),
+                                bias.data(), &output_dims, ansi_out.data(), &params, &quant_data);
+        });
+        *opt_us = time_us(iterations, [&]() {
+            esp_nn_conv_s8_opt(&input_dims, input.data(), &filter_dims, filter.data(),
+                               bias.data(), &output_dims, opt_out.data(), &params, &quant_data);
+        });
+        if (layer.past_edge) {
+            esp_nn_conv_s8_ansi(&padded_dims, padded.data(), &filter_dims, filter.data(),
+                                bias.data(), &output_dims, edge_out.data(), &params, &quant_data);
+        }
+        const int32_t filter_size = layer.filter_wd * layer.filter_ht * layer.in_channels;
+        std::vector<int8_t> packed(filter.size());
+        std::vector<int32_t> filter_base(layer.out_channels);
+        esp_nn_conv_pack_filter_s8(filter.data(), layer.out_channels, filter_size, packed.data());
+        esp_nn_conv_filter_base_s8(filter.data(), bias.data(), layer.out_channels, filter_size,
+                                   params.in_offset, filter_base.data());
+        *packed_us = time_us(iterations, [&]() {
+            esp_nn_conv_s8_packed_opt(&input_dims, input.data(), &filter_dims, packed.data(),
+                                      filter_base.data(), &output_dims, packed_out.data(), &params,
+                                      &quant_data);
+        });
+        *packed_match = packed_out == opt_out;
+    }
+    *edge_match = !layer.past_edge || edge_out == ansi_out;
+
+    int max_diff = 0;
+    for (size_t ix = 0; ix < ansi_out.size(); ix++) {
+        int diff = abs((int)ansi_out[ix] - (int)opt_out[ix]);
+        if (diff > max_diff) {
+            max_diff = diff;
+        }
+    }
+    return max_diff;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20;
+
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-n") == 0 && a + 1 < argc) {
+            iterations = atoi(argv[++a]);
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    const std::vector<layer_t> layers = model_layers();
+    if (layers.empty()) {
+        printf("The model has no convolutions\n");
+        return 1;
+    }
+
+    srand(1);
+    printf("%-40s %10s %10s %8s %5s %10s\n", "layer", "ansi us", "opt us", "speedup", "diff", "packed us");
+    double ansi_total = 0, opt_total = 0, packed_total = 0;
+    int failed = 0, packed_failed = 0, edge_failed = 0;
+    for (const layer_t &layer : layers) {
+        double ansi_us, opt_us, packed_us;
+        bool packed_match, edge_match;
+        int diff = run_layer(layer, iterations, &ansi_us, &opt_us, &packed_us, &packed_match, &edge_match);
+        char packed_text[16] = "-";
+        if (!layer.depthwise) {
+            snprintf(packed_text, sizeof(packed_text), "%.1f", packed_us);
+        }
+        printf("%-40s %10.1f %10.1f %7.2fx %5d %10s%s%s%s\n", layer.name, ansi_us, opt_us,
+            ansi_us / opt_us, diff, packed_text, diff > 1 ? "  MISMATCH" : "",
+            packed_match ? "" : "  PACKED MISMATCH", edge_match ? "" : "  EDGE MISMATCH");
+        ansi_total += ansi_us;
+        opt_total += opt_us;
+        packed_total += layer.depthwise ? opt_us : packed_us;
+        failed += diff > 1;
+        packed_failed += !packed_match;
+        edge_failed += !edge_match;
+    }
+    printf("%-40s %10.1f %10.1f %7.2fx %5s %10.1f\n", "total", ansi_total, opt_total,
+        ansi_total / opt_total, "", packed_total);
+    printf("* windows run past the bottom or right edge of the input\n");
+    if (failed) {
+        printf("%d layers differ from the reference by more than 1\n", failed);
+        return 1;
+    }
+    if (packed_failed) {
+        printf("%d layers differ between the packed and the opt kernel\n", packed_failed);
+        return 1;
+    }
+    if (edge_failed) {
+        printf("%d layers differ from the reference on the padded input\n", edge_failed);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,816 @@
+/* Host benchmark: the full impulse
+ *
+ * Runs run_classifier() (JPEG decode, crop/resize/quantize and the EON model,
+ * the same path as the firmware) over camera frames and reports the stage
+ * times from result.timing as percentiles, plus the top label of every frame
+ * so a change that moves the results shows up next to one that moves the
+ * times.
+ *
+ * Usage: impulse_benchmark [-n iterations] [-w warmup] [-t threads] [-b batch]
+ *                          [-d threshold] [-s budget_us] [-g golden.txt]
+ *                          [-o scores.txt] [-p] [-csv profile.csv]
+ *                          <dir | frame.jpg> [...]
+ * A directory is scanned (not recursively) for .jpg / .jpeg files. Frames can
+ * be grabbed from a running device with
+ *   curl http://<esp32-ip>/snapshot -o frame.jpg
+ *
+ * With the per-operator profiler compiled in (cmake -DEI_PROFILE_OPS=ON), -p
+ * prints the time per operator and the slowest nodes of the timed runs, and
+ * -csv writes every node to a file.
+ *
+ * -t classifies the frames again on that many threads, each with its own
+ * handle and copy of the model (run_classifier_open_instance()), and compares
+ * the frames per second and the labels with the run on one thread.
+ *
+ * -b classifies the frames again through run_classifier_batch(), that many at
+ * once, and prints the images per second and the time per stage, and whether
+ * every score matches the run on one image at a time.
+ *
+ * -d decides every frame against that probability threshold through
+ * run_classifier_decide_quantized() (the firmware's inference stage) and
+ * compares the time of the model and the decisions with
+ * run_classifier_quantized() on the same features.
+ *
+ * -s classifies the frames again a few layers at a time
+ * (run_classifier_start_quantized(), run_classifier_step() with that budget),
+ * each after a first start that is aborted after one step, as a stale frame
+ * would be. It prints the steps per frame and the longest step, and whether
+ * every score matches the run in one go.
+ *
+ * -g compares the int8 output of the model for every frame with the scores in
+ * a file (frames/golden_scores.txt, from the model before the compiled graph
+ * was rewritten) and fails on any difference, or on a frame the file does not
+ * list. -o writes the scores of this run in the same format. With -g it also
+ * checks that the graph it scores has been rewritten: no PAD node is left,
+ * convolutions have a PAD folded in, and the residual blocks are fused (no ADD
+ * node is left).
+ */
+#include <algorithm>
+#include <dirent.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <strings.h>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#include "tflite-model/tflite_learn_864078_5_compiled.h"
+
+typedef struct {
+    std::string path;
+    std::vector<uint8_t> data;
+} frame_t;
+
+static bool is_jpeg_name(const char *name)
+{
+    const char *dot = strrchr(name, '.');
+    return dot && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0);
+}
+
+static bool load_frame(const std::string &path, std::vector<frame_t> &frames)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        fprintf(stderr, "Cannot open %s\n", path.c_str());
+        return false;
+    }
+    frame_t frame;
+    frame.path = path;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        frame.data.insert(frame.data.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    frames.push_back(frame);
+    return true;
+}
+
+static bool load_path(const char *path, std::vector<frame_t> &frames)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+        return load_frame(path, frames);
+    }
+
+    DIR *dir = opendir(path);
+    if (!dir) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    std::vector<std::string> names;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (is_jpeg_name(entry->d_name)) {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+
+    for (size_t ix = 0; ix < names.size(); ix++) {
+        if (!load_frame(std::string(path) + "/" + names[ix], frames)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ei::image_source_t jpeg_source(frame_t &frame)
+{
+    ei::image_source_t image;
+    image.buffer = frame.data.data();
+    image.width = 0;
+    image.height = 0;
+    image.stride = 0;
+    image.format = ei::EI_IMAGE_SOURCE_JPEG;
+    image.size = (uint32_t)frame.data.size();
+    return image;
+}
+
+// Nearest rank on a sorted sample
+static uint64_t percentile(const std::vector<uint64_t> &sorted, double p)
+{
+    size_t rank = (size_t)(p / 100.0 * sorted.size() + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[std::min(rank, sorted.size()) - 1];
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+static void write_file(void *user, const char *text)
+{
+    fputs(text, (FILE *)user);
+}
+#endif
+
+// Index of the top label of a result
+static size_t top_label(const ei_impulse_result_t &result)
+{
+    size_t best = 0;
+    for (size_t ix = 1; ix < EI_CLASSIFIER_LABEL_COUNT; ix++) {
+        if (result.classification[ix].value > result.classification[best].value) {
+            best = ix;
+        }
+    }
+    return best;
+}
+
+// File name of a frame, the key of the golden scores
+static std::string frame_name(const frame_t &frame)
+{
+    size_t slash = frame.path.find_last_of('/');
+    return slash == std::string::npos ? frame.path : frame.path.substr(slash + 1);
+}
+
+// The int8 outputs of the model behind the scores (values, EI_CLASSIFIER_LABEL_COUNT
+// per frame), from the quantization of the last node's output
+static bool quantized_scores(const std::vector<float> &values, std::vector<int> &scores)
+{
+    const char *op;
+    const void *params;
+    TfLiteTensor input, filter, output;
+    if (tflite_learn_864078_5_node_shape(tflite_learn_864078_5_nodes() - 1, &op, &params, &input, &filter,
+            &output) != kTfLiteOk || output.type != kTfLiteInt8 || output.params.scale <= 0.0f) {
+        return false;
+    }
+    scores.resize(values.size());
+    for (size_t ix = 0; ix < values.size(); ix++) {
+        scores[ix] = (int)lroundf(values[ix] / output.params.scale) + output.params.zero_point;
+    }
+    return true;
+}
+
+// Rewrites of the compiled graph: PAD nodes left, convolutions with a PAD
+// folded in (an output larger than their padding mode gives), ADD nodes left
+// and fused residual blocks
+typedef struct {
+    size_t pads;
+    size_t folded_pads;
+    size_t adds;
+    size_t fused_blocks;
+} graph_rewrites_t;
+
+static graph_rewrites_t graph_rewrites()
+{
+    graph_rewrites_t rewrites = {};
+    for (size_t ix = 0; ix < tflite_learn_864078_5_nodes(); ix++) {
+        const char *op;
+        const void *params;
+        TfLiteTensor input, filter, output;
+        if (tflite_learn_864078_5_node_shape(ix, &op, &params, &input, &filter, &output) != kTfLiteOk) {
+            break;
+        }
+        TfLitePadding padding;
+        int stride_wd, stride_ht, dilation_wd, dilation_ht;
+        if (strcmp(op, "PAD") == 0 || strcmp(op, "PADV2") == 0) {
+            rewrites.pads++;
+            continue;
+        }
+        else if (strcmp(op, "ADD") == 0) {
+            rewrites.adds++;
+            continue;
+        }
+        else if (strcmp(op, "INVERTED_RESIDUAL") == 0) {
+            rewrites.fused_blocks++;
+            continue;
+        }
+        else if (strcmp(op, "CONV_2D") == 0) {
+            const TfLiteConvParams *conv = (const TfLiteConvParams *)params;
+            padding = conv->padding;
+            stride_wd = conv->stride_width;
+            stride_ht = conv->stride_height;
+            dilation_wd = conv->dilation_width_factor;
+            dilation_ht = conv->dilation_height_factor;
+        }
+        else if (strcmp(op, "DEPTHWISE_CONV_2D") == 0) {
+            const TfLiteDepthwiseConvParams *dw = (const TfLiteDepthwiseConvParams *)params;
+            padding = dw->padding;
+            stride_wd = dw->stride_width;
+            stride_ht = dw->stride_height;
+            dilation_wd = dw->dilation_width_factor;
+            dilation_ht = dw->dilation_height_factor;
+        }
+        else {
+            continue;
+        }
+        // NHWC, filter OHWI (1HWC for depthwise)
+        int out_ht, out_wd;
+        tflite::ComputePaddingHeightWidth(stride_ht, stride_wd, dilation_ht, dilation_wd,
+            input.dims->data[1], input.dims->data[2], filter.dims->data[1], filter.dims->data[2], padding,
+            &out_ht, &out_wd);
+        if (output.dims->data[1] > out_ht || output.dims->data[2] > out_wd) {
+            rewrites.folded_pads++;
+        }
+    }
+    return rewrites;
+}
+
+// Writes the int8 scores of the frames that classified, one frame per line
+static bool write_scores(const char *path, const std::vector<frame_t> &frames, const std::vector<int> &labels,
+                         const std::vector<int> &scores)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+    for (size_t ix = 0; ix < frames.size(); ix++) {
+        if (labels[ix] < 0) {
+            continue;
+        }
+        fprintf(f, "%s", frame_name(frames[ix]).c_str());
+        for (size_t l = 0; l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+            fprintf(f, " %d", scores[ix * EI_CLASSIFIER_LABEL_COUNT + l]);
+        }
+        fprintf(f, "\n");
+    }
+    fclose(f);
+    return true;
+}
+
+// Compares the int8 scores of every frame with the ones in a file written by
+// write_scores() (lines starting with # are comments), the frames that differ
+// or are not in the file; -1 if the file cannot be read
+static int compare_scores(const char *path, const std::vector<frame_t> &frames, const std::vector<int> &labels,
+                          const std::vector<int> &scores)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    std::vector<std::string> names;
+    std::vector<int> golden;
+    char line[512];
+    while (fgets(line, sizeof(line), f)) {
+        char name[256];
+        int used;
+        if (line[0] == '#' || sscanf(line, "%255s%n", name, &used) != 1) {
+            continue;
+        }
+        const char *p = line + used;
+        std::vector<int> row(EI_CLASSIFIER_LABEL_COUNT);
+        for (size_t l = 0; l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+            char *end;
+            row[l] = (int)strtol(p, &end, 10);
+            if (end == p) {
+                fprintf(stderr, "%s: %s has fewer than %d scores\n", path, name, EI_CLASSIFIER_LABEL_COUNT);
+                fclose(f);
+                return -1;
+            }
+            p = end;
+        }
+        names.push_back(name);
+        golden.insert(golden.end(), row.begin(), row.end());
+    }
+    fclose(f);
+
+    int mismatches = 0;
+    for (size_t ix = 0; ix < frames.size(); ix++) {
+        const std::string name = frame_name(frames[ix]);
+        size_t g = std::find(names.begin(), names.end(), name) - names.begin();
+        if (g == names.size()) {
+            printf("  %-40s has no golden scores\n", frames[ix].path.c_str());
+            mismatches++;
+        }
+        else if (labels[ix] < 0 || !std::equal(&scores[ix * EI_CLASSIFIER_LABEL_COUNT],
+                &scores[ix * EI_CLASSIFIER_LABEL_COUNT] + EI_CLASSIFIER_LABEL_COUNT,
+                &golden[g * EI_CLASSIFIER_LABEL_COUNT])) {
+            printf("  %-40s scores differ from the golden ones:", frames[ix].path.c_str());
+            for (size_t l = 0; labels[ix] >= 0 && l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+                printf(" %d/%d", scores[ix * EI_CLASSIFIER_LABEL_COUNT + l], golden[g * EI_CLASSIFIER_LABEL_COUNT + l]);
+            }
+            printf("\n");
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+// Thread t of run_threads(): frames t, t + threads, ... on its own model instance
+static void classify_stripe(std::vector<frame_t> *frames, int iterations, int t, int threads,
+                            std::vector<int> *labels, EI_IMPULSE_ERROR *status)
+{
+    ei_impulse_handle_t handle(ei_default_impulse.impulse);
+    *status = run_classifier_open_instance(&handle);
+    for (size_t f = t; f < frames->size() && *status == EI_IMPULSE_OK; f += threads) {
+        ei::image_source_t image = jpeg_source((*frames)[f]);
+        ei_impulse_result_t result;
+        EI_IMPULSE_ERROR res = EI_IMPULSE_OK;
+        for (int it = 0; it < iterations && res == EI_IMPULSE_OK; it++) {
+            memset(&result, 0, sizeof(result));
+            res = run_classifier(&handle, &image, &result, false);
+        }
+        // a frame that fails here failed on one thread too, the labels tell
+        (*labels)[f] = res == EI_IMPULSE_OK ? (int)top_label(result) : -1;
+    }
+    run_classifier_close_instance(&handle);
+}
+
+// Classify every frame on threads at once, the wall time in us. status is
+// that of setting up the model instances.
+static uint64_t run_threads(std::vector<frame_t> &frames, int iterations, int threads,
+                            std::vector<int> &labels, EI_IMPULSE_ERROR &status)
+{
+    std::vector<EI_IMPULSE_ERROR> statuses(threads, EI_IMPULSE_OK);
+    std::vector<std::thread> pool;
+    uint64_t start_us = ei_read_timer_us();
+    for (int t = 0; t < threads; t++) {
+        pool.push_back(std::thread(classify_stripe, &frames, iterations, t, threads, &labels, &statuses[t]));
+    }
+    for (int t = 0; t < threads; t++) {
+        pool[t].join();
+    }
+    uint64_t wall_us = ei_read_timer_us() - start_us;
+    status = EI_IMPULSE_OK;
+    for (int t = 0; t < threads; t++) {
+        if (statuses[t] != EI_IMPULSE_OK) {
+            status = statuses[t];
+        }
+    }
+    return wall_us;
+}
+
+// Classify the frames that classified one by one in batches of batch, the
+// scores into batch_values (EI_CLASSIFIER_LABEL_COUNT per frame)
+static EI_IMPULSE_ERROR run_batches(std::vector<frame_t> &frames, const std::vector<int> &labels, int iterations,
+                                    int batch, std::vector<float> &batch_values, ei_impulse_batch_timing_t &totals)
+{
+    std::vector<size_t> indices;
+    std::vector<ei::image_source_t> images;
+    for (size_t f = 0; f < frames.size(); f++) {
+        if (labels[f] >= 0) {
+            indices.push_back(f);
+            images.push_back(jpeg_source(frames[f]));
+        }
+    }
+    std::vector<ei_impulse_result_t> results(images.size());
+
+    ei_impulse_handle_t handle(ei_default_impulse.impulse);
+    EI_IMPULSE_ERROR res = run_classifier_open_batch(&handle, batch);
+    memset(&totals, 0, sizeof(totals));
+    for (int it = 0; it < iterations && res == EI_IMPULSE_OK; it++) {
+        memset(results.data(), 0, sizeof(ei_impulse_result_t) * results.size());
+        ei_impulse_batch_timing_t timing;
+        res = run_classifier_batch(&handle, images.data(), results.data(), images.size(), &timing);
+        totals.images += timing.images;
+        totals.total_us += timing.total_us;
+        totals.dsp_us += timing.dsp_us;
+        totals.classification_us += timing.classification_us;
+        totals.postprocessing_us += timing.postprocessing_us;
+    }
+    run_classifier_close_batch(&handle);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    totals.images_per_second = totals.total_us > 0 ? totals.images * 1e6f / totals.total_us : 0.0f;
+    for (size_t ix = 0; ix < indices.size(); ix++) {
+        for (size_t l = 0; l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+            batch_values[indices[ix] * EI_CLASSIFIER_LABEL_COUNT + l] = results[ix].classification[l].value;
+        }
+    }
+    return EI_IMPULSE_OK;
+}
+
+// Decide the frames that classified against threshold, once on the logits and
+// once on the full model; the mean time of each in us and the frames that
+// decided otherwise than the scores of the first run
+static EI_IMPULSE_ERROR run_decisions(std::vector<frame_t> &frames, const std::vector<int> &labels,
+                                      const std::vector<float> &values, int iterations, float threshold,
+                                      double &decide_us, double &full_us, size_t &mismatches)
+{
+    std::vector<int8_t> features(EI_CLASSIFIER_NN_INPUT_FRAME_SIZE);
+    uint64_t decide_total = 0, full_total = 0, runs = 0;
+    mismatches = 0;
+    for (size_t f = 0; f < frames.size(); f++) {
+        if (labels[f] < 0) {
+            continue;
+        }
+        ei::image_source_t image = jpeg_source(frames[f]);
+        EI_IMPULSE_ERROR res = run_classifier_quantize_image(&image, features.data(), features.size(), NULL, NULL);
+        ei_impulse_decision_t decision;
+        ei_impulse_result_t result;
+        for (int it = 0; it < iterations && res == EI_IMPULSE_OK; it++) {
+            memset(&result, 0, sizeof(result));
+            uint64_t start_us = ei_read_timer_us();
+            res = run_classifier_decide_quantized(features.data(), features.size(), threshold, false,
+                                                  &decision, &result, false);
+            decide_total += ei_read_timer_us() - start_us;
+            if (res != EI_IMPULSE_OK) {
+                break;
+            }
+            memset(&result, 0, sizeof(result));
+            start_us = ei_read_timer_us();
+            res = run_classifier_quantized(features.data(), features.size(), &result, false);
+            full_total += ei_read_timer_us() - start_us;
+            runs++;
+        }
+        if (res != EI_IMPULSE_OK) {
+            return res;
+        }
+        const bool above = values[f * EI_CLASSIFIER_LABEL_COUNT + labels[f]] > threshold;
+        if (decision.label != labels[f] || decision.above_threshold != above) {
+            printf("  %-40s decided otherwise on the logits\n", frames[f].path.c_str());
+            mismatches++;
+        }
+    }
+    decide_us = runs ? (double)decide_total / runs : 0.0;
+    full_us = runs ? (double)full_total / runs : 0.0;
+    return EI_IMPULSE_OK;
+}
+
+// Classify the frames that classified in one go again in steps of budget_us,
+// on the model with a session open, the scores into step_values; the steps
+// per frame and the longest step in us
+static EI_IMPULSE_ERROR run_steps(std::vector<frame_t> &frames, const std::vector<int> &labels, uint32_t budget_us,
+                                  std::vector<float> &step_values, double &steps_per_frame, uint64_t &longest_us)
+{
+    std::vector<int8_t> features(EI_CLASSIFIER_NN_INPUT_FRAME_SIZE);
+    uint64_t steps = 0, classified = 0;
+    longest_us = 0;
+    EI_IMPULSE_ERROR res = run_classifier_open_session();
+    for (size_t f = 0; f < frames.size() && res == EI_IMPULSE_OK; f++) {
+        if (labels[f] < 0) {
+            continue;
+        }
+        ei::image_source_t image = jpeg_source(frames[f]);
+        res = run_classifier_quantize_image(&image, features.data(), features.size(), NULL, NULL);
+        ei_impulse_result_t result;
+        bool done = false;
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_start_quantized(features.data(), features.size(), &result, false);
+        }
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_step(1, 0, &done, &result);
+        }
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_abort();
+        }
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_start_quantized(features.data(), features.size(), &result, false);
+        }
+        done = false;
+        while (res == EI_IMPULSE_OK && !done) {
+            uint64_t start_us = ei_read_timer_us();
+            res = run_classifier_step(0, budget_us, &done, &result);
+            longest_us = std::max(longest_us, ei_read_timer_us() - start_us);
+            steps++;
+        }
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_finish_quantized(&result, false);
+        }
+        if (res == EI_IMPULSE_OK) {
+            for (size_t l = 0; l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+                step_values[f * EI_CLASSIFIER_LABEL_COUNT + l] = result.classification[l].value;
+            }
+            classified++;
+        }
+    }
+    run_classifier_close_session();
+    steps_per_frame = classified ? (double)steps / classified : 0.0;
+    return res;
+}
+
+static void print_stage(const char *name, std::vector<uint64_t> &us)
+{
+    std::sort(us.begin(), us.end());
+    uint64_t sum = 0;
+    for (size_t ix = 0; ix < us.size(); ix++) {
+        sum += us[ix];
+    }
+    printf("  %-16s %9.1f %9.1f %9.1f %9.1f %9.1f\n", name,
+        (double)sum / us.size() / 1000.0,
+        percentile(us, 50) / 1000.0,
+        percentile(us, 90) / 1000.0,
+        percentile(us, 99) / 1000.0,
+        us.back() / 1000.0);
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20;
+    int warmup = 2;
+    int threads = 1;
+    int batch = 0;
+    float threshold = -1.0f;
+    long step_budget_us = -1;
+    const char *golden_path = NULL;
+    const char *scores_path = NULL;
+    bool print_profile = false;
+    const char *profile_csv = NULL;
+    std::vector<frame_t> frames;
+    const char *usage = "Usage: %s [-n iterations] [-w warmup] [-t threads] [-b batch] [-d threshold] [-s budget_us] [-g golden.txt] [-o scores.txt] [-p] [-csv profile.csv] <dir | frame.jpg> [...]\n";
+
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-n") == 0 && a + 1 < argc) {
+            iterations = atoi(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-w") == 0 && a + 1 < argc) {
+            warmup = atoi(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-t") == 0 && a + 1 < argc) {
+            threads = atoi(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-b") == 0 && a + 1 < argc) {
+            batch = atoi(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-d") == 0 && a + 1 < argc) {
+            threshold = (float)atof(argv[++a]);
+            if (threshold < 0.0f || threshold >= 1.0f) {
+                fprintf(stderr, usage, argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[a], "-s") == 0 && a + 1 < argc) {
+            step_budget_us = atol(argv[++a]);
+        }
+        else if (strcmp(argv[a], "-g") == 0 && a + 1 < argc) {
+            golden_path = argv[++a];
+        }
+        else if (strcmp(argv[a], "-o") == 0 && a + 1 < argc) {
+            scores_path = argv[++a];
+        }
+        else if (strcmp(argv[a], "-p") == 0) {
+            print_profile = true;
+        }
+        else if (strcmp(argv[a], "-csv") == 0 && a + 1 < argc) {
+            profile_csv = argv[++a];
+        }
+        else if (argv[a][0] == '-') {
+            fprintf(stderr, usage, argv[0]);
+            return 1;
+        }
+        else if (!load_path(argv[a], frames)) {
+            return 1;
+        }
+    }
+    if (frames.empty() || iterations < 1 || threads < 1 || batch < 0 || step_budget_us < -1) {
+        fprintf(stderr, usage, argv[0]);
+        return 1;
+    }
+#if !EI_CLASSIFIER_PROFILE_OPS
+    if (print_profile || profile_csv) {
+        fprintf(stderr, "The profiler is not compiled in, configure with -DEI_PROFILE_OPS=ON\n");
+        return 1;
+    }
+#endif
+
+    printf("%u frames, %d iterations each (%d warmup runs first), model input %dx%d\n\n",
+        (unsigned)frames.size(), iterations, warmup,
+        EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+
+    std::vector<uint64_t> dsp_us, classification_us, total_us;
+    std::vector<int> labels(frames.size(), -1);
+    std::vector<float> values(frames.size() * EI_CLASSIFIER_LABEL_COUNT, 0.0f);
+    int failed = 0;
+    ei_impulse_result_t result;
+
+    // warm up on the first frame, none of this is counted
+    for (int it = 0; it < warmup; it++) {
+        ei::image_source_t image = jpeg_source(frames[0]);
+        memset(&result, 0, sizeof(result));
+        run_classifier(&image, &result, false);
+    }
+#if EI_CLASSIFIER_PROFILE_OPS
+    run_classifier_reset_profile();
+#endif
+
+    uint64_t start_us = ei_read_timer_us();
+    for (size_t f = 0; f < frames.size(); f++) {
+        ei::image_source_t image = jpeg_source(frames[f]);
+        EI_IMPULSE_ERROR res = EI_IMPULSE_OK;
+        for (int it = 0; it < iterations && res == EI_IMPULSE_OK; it++) {
+            memset(&result, 0, sizeof(result));
+            res = run_classifier(&image, &result, false);
+            if (res == EI_IMPULSE_OK) {
+                dsp_us.push_back(result.timing.dsp_us);
+                classification_us.push_back(result.timing.classification_us);
+                total_us.push_back(result.timing.dsp_us + result.timing.classification_us);
+            }
+        }
+
+        if (res != EI_IMPULSE_OK) {
+            printf("  %-40s error %d\n", frames[f].path.c_str(), res);
+            failed++;
+            continue;
+        }
+        size_t best = top_label(result);
+        labels[f] = (int)best;
+        for (size_t l = 0; l < EI_CLASSIFIER_LABEL_COUNT; l++) {
+            values[f * EI_CLASSIFIER_LABEL_COUNT + l] = result.classification[l].value;
+        }
+        printf("  %-40s %-12s %.4f\n", frames[f].path.c_str(),
+            result.classification[best].label, result.classification[best].value);
+    }
+
+    uint64_t wall_us = ei_read_timer_us() - start_us;
+
+    if (total_us.empty()) {
+        printf("\nNo frame could be classified\n");
+        return 1;
+    }
+    printf("\n%u runs (ms)        mean       p50       p90       p99       max\n", (unsigned)total_us.size());
+    print_stage("dsp", dsp_us);
+    print_stage("classification", classification_us);
+    print_stage("total", total_us);
+
+    if (golden_path || scores_path) {
+        std::vector<int> scores;
+        if (!quantized_scores(values, scores)) {
+            printf("\nThe model output is not int8\n");
+            return 1;
+        }
+        if (scores_path && !write_scores(scores_path, frames, labels, scores)) {
+            return 1;
+        }
+        if (golden_path) {
+            int mismatches = compare_scores(golden_path, frames, labels, scores);
+            if (mismatches < 0) {
+                return 1;
+            }
+            printf("\n%s\n", mismatches ? "scores differ from the golden ones" : "same scores as the golden ones");
+            if (mismatches) {
+                failed++;
+            }
+            // the golden scores only vouch for the rewrites the graph has
+            const graph_rewrites_t rewrites = graph_rewrites();
+            printf("  graph            %u PAD nodes, %u convolutions with a PAD folded in\n",
+                (unsigned)rewrites.pads, (unsigned)rewrites.folded_pads);
+            printf("  graph            %u ADD nodes, %u fused residual blocks\n",
+                (unsigned)rewrites.adds, (unsigned)rewrites.fused_blocks);
+            if (rewrites.pads > 0 || rewrites.folded_pads == 0) {
+                printf("  the PAD nodes are not folded into the convolutions\n");
+                failed++;
+            }
+            if (rewrites.adds > 0 || rewrites.fused_blocks == 0) {
+                printf("  the residual blocks are not fused\n");
+                failed++;
+            }
+        }
+    }
+
+    if (threads > 1) {
+        std::vector<int> thread_labels(frames.size(), -1);
+        EI_IMPULSE_ERROR status;
+        uint64_t threads_us = run_threads(frames, iterations, threads, thread_labels, status);
+        if (status != EI_IMPULSE_OK) {
+            printf("\n%d threads: error %d\n", threads, status);
+            return 1;
+        }
+        size_t mismatches = 0;
+        for (size_t f = 0; f < frames.size(); f++) {
+            if (thread_labels[f] != labels[f]) {
+                printf("  %-40s label differs on %d threads\n", frames[f].path.c_str(), threads);
+                mismatches++;
+            }
+        }
+        const double runs = (double)frames.size() * iterations;
+        printf("\n1 thread   %9.1f frames/s\n", runs * 1e6 / wall_us);
+        printf("%d threads %9.1f frames/s, %s\n", threads, runs * 1e6 / threads_us,
+            mismatches ? "labels differ" : "same labels");
+        if (mismatches) {
+            failed++;
+        }
+    }
+
+    if (batch > 0) {
+        std::vector<float> batch_values(values.size(), 0.0f);
+        ei_impulse_batch_timing_t timing;
+        EI_IMPULSE_ERROR status = run_batches(frames, labels, iterations, batch, batch_values, timing);
+        if (status != EI_IMPULSE_OK) {
+            printf("\nbatch of %d: error %d\n", batch, status);
+            return 1;
+        }
+        size_t mismatches = 0;
+        for (size_t f = 0; f < frames.size(); f++) {
+            if (labels[f] >= 0 && memcmp(&batch_values[f * EI_CLASSIFIER_LABEL_COUNT],
+                    &values[f * EI_CLASSIFIER_LABEL_COUNT], sizeof(float) * EI_CLASSIFIER_LABEL_COUNT) != 0) {
+                printf("  %-40s scores differ in a batch of %d\n", frames[f].path.c_str(), batch);
+                mismatches++;
+            }
+        }
+        const double images = timing.images ? (double)timing.images : 1.0;
+        printf("\nbatch of %d %9.1f images/s, %s\n", batch, timing.images_per_second,
+            mismatches ? "scores differ" : "same scores");
+        printf("  per image (ms)   dsp %.1f, classification %.1f, postprocessing %.3f\n",
+            timing.dsp_us / images / 1000.0, timing.classification_us / images / 1000.0,
+            timing.postprocessing_us / images / 1000.0);
+        if (mismatches) {
+            failed++;
+        }
+    }
+
+    if (threshold >= 0.0f) {
+        double decide_us, full_us;
+        size_t mismatches;
+        EI_IMPULSE_ERROR status = run_decisions(frames, labels, values, iterations, threshold,
+                                                decide_us, full_us, mismatches);
+        if (status != EI_IMPULSE_OK) {
+            printf("\ndecisions at %.2f: error %d\n", threshold, status);
+            return 1;
+        }
+        printf("\ndecisions at %.2f, %s\n", threshold, mismatches ? "decisions differ" : "same decisions");
+        printf("  model (ms)       logits %.2f, full %.2f\n", decide_us / 1000.0, full_us / 1000.0);
+        if (mismatches) {
+            failed++;
+        }
+    }
+
+    if (step_budget_us >= 0) {
+        std::vector<float> step_values(values.size(), 0.0f);
+        double steps_per_frame;
+        uint64_t longest_us;
+        EI_IMPULSE_ERROR status = run_steps(frames, labels, (uint32_t)step_budget_us, step_values,
+                                            steps_per_frame, longest_us);
+        if (status != EI_IMPULSE_OK) {
+            printf("\nsteps of %ld us: error %d\n", step_budget_us, status);
+            return 1;
+        }
+        size_t mismatches = 0;
+        for (size_t f = 0; f < frames.size(); f++) {
+            if (labels[f] >= 0 && memcmp(&step_values[f * EI_CLASSIFIER_LABEL_COUNT],
+                    &values[f * EI_CLASSIFIER_LABEL_COUNT], sizeof(float) * EI_CLASSIFIER_LABEL_COUNT) != 0) {
+                printf("  %-40s scores differ in steps of %ld us\n", frames[f].path.c_str(), step_budget_us);
+                mismatches++;
+            }
+        }
+        printf("\nsteps of %ld us, %.1f steps per frame, longest %.2f ms, %s\n", step_budget_us, steps_per_frame,
+            longest_us / 1000.0, mismatches ? "scores differ" : "same scores");
+        if (mismatches) {
+            failed++;
+        }
+    }
+
+#if EI_CLASSIFIER_PROFILE_OPS
+    ei_model_profile_t profile;
+    if ((print_profile || profile_csv) && run_classifier_get_profile(&profile) == EI_IMPULSE_OK) {
+        if (print_profile) {
+            printf("\n");
+            ei_profile_print_summary(&profile);
+        }
+        if (profile_csv) {
+            FILE *f = fopen(profile_csv, "w");
+            if (!f) {
+                fprintf(stderr, "Cannot write %s\n", profile_csv);
+                return 1;
+            }
+            ei_profile_write_csv(&profile, write_file, f);
+            fclose(f);
+        }
+    }
+#endif
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,315 @@
+/* Host benchmark: JPEG frame to quantized model input
+ *
+ * Compares the two ways of turning a camera JPEG into the int8 input tensor:
+ *   full:   decode every pixel to RGB888, crop_and_interpolate_image(), quantize
+ *   scaled: DCT-domain decode at 1/2, 1/4 or 1/8 straight into the streaming
+ *           crop, resize and quantize pass (what run_classifier() does for
+ *           EI_IMAGE_SOURCE_JPEG)
+ *
+ * With -c, instead of being timed, each frame is decoded truncated and with
+ * flipped bytes, that many times each way, at full and at reduced scale, as a
+ * check that corrupt input is rejected or decoded to something without reading
+ * out of bounds or overflowing (run it in a build with
+ * -fsanitize=address,undefined).
+ *
+ * With -g, each frame is checked as the input of a grayscale model instead:
+ * its luma, cropped and resized to the model input, goes through
+ * extract_image_features_quantized() as it is and with every pixel repeated
+ * 2x2, which takes the streaming resize. The downscale of repeated pixels gives
+ * the pixels back, so both have to quantize to the same values, for the
+ * default parameters (1/255 scale, -128 zero point) and for torch scaling.
+ *
+ * Usage: jpeg_decode_benchmark [-n iterations] [-c corrupt_variants] [-g] frame.jpg [frame.jpg ...]
+ * Frames can be grabbed from a running device with
+ *   curl http://<esp32-ip>/snapshot -o frame.jpg
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/dsp/image/jpeg.hpp"
+#include "edge-impulse-sdk/dsp/image/processing.hpp"
+
+using namespace ei;
+using namespace ei::image;
+
+static const int dst_width = EI_CLASSIFIER_INPUT_WIDTH;
+static const int dst_height = EI_CLASSIFIER_INPUT_HEIGHT;
+
+typedef struct {
+    uint8_t *frame;
+    int width;
+    int pixel_size;
+} full_frame_t;
+
+static int copy_row(void *user, const uint8_t *row, int y)
+{
+    full_frame_t *f = (full_frame_t *)user;
+    const size_t row_size = (size_t)f->width * f->pixel_size;
+    memcpy(f->frame + (size_t)y * row_size, row, row_size);
+    return EIDSP_OK;
+}
+
+static int push_row(void *user, const uint8_t *row, int y)
+{
+    (void)y;
+    processing::ResizeQuantizer *resizer = (processing::ResizeQuantizer *)user;
+    int ret = resizer->push_row(row);
+    if (ret != EIDSP_OK) {
+        return ret;
+    }
+    return resizer->done() ? jpeg::JPEG_STOP : (int)EIDSP_OK;
+}
+
+static int run_full(const std::vector<uint8_t> &file, const jpeg::jpeg_info_t &info, int8_t *out)
+{
+    std::vector<uint8_t> frame((size_t)info.width * info.height * 3);
+    full_frame_t f = { frame.data(), info.width, 3 };
+
+    int ret = jpeg::decode(file.data(), file.size(), 1, 3, copy_row, &f);
+    if (ret != EIDSP_OK) {
+        return ret;
+    }
+    // in place, the intermediate crop does not fit a model sized buffer
+    ret = processing::crop_and_interpolate_image(
+        frame.data(), info.width, info.height, frame.data(), dst_width, dst_height, 3);
+    if (ret != EIDSP_OK) {
+        return ret;
+    }
+    for (size_t ix = 0; ix < (size_t)dst_width * dst_height * 3; ix++) {
+        out[ix] = (int8_t)(frame[ix] - 128);
+    }
+    return EIDSP_OK;
+}
+
+static int run_scaled(const std::vector<uint8_t> &file, const jpeg::jpeg_info_t &info, const int8_t *lut, int8_t *out)
+{
+    int scale = jpeg::choose_scale(info.width, info.height, dst_width, dst_height);
+    int scaled_width, scaled_height;
+    jpeg::scaled_size(info.width, info.height, scale, scaled_width, scaled_height);
+
+    processing::ResizeQuantizer resizer;
+    int ret = resizer.init(scaled_width, scaled_height, 3, out, dst_width, dst_height, 3,
+        EI_CLASSIFIER_RESIZE_FIT_SHORTEST, processing::RESIZE_INTERPOLATION_BILINEAR, lut);
+    if (ret != EIDSP_OK) {
+        return ret;
+    }
+    int crop_x, crop_width;
+    resizer.get_crop_columns(crop_x, crop_width);
+    return jpeg::decode(file.data(), file.size(), scale, 3, push_row, &resizer, crop_x, crop_width);
+}
+
+/**
+ * Decode truncated copies of the frame and copies with a few flipped bytes, at full
+ * scale and the way run_classifier() does. Copies whose header no longer gives the
+ * frame's size are not decoded, the full decode would allocate whatever size the
+ * corrupt header claims
+ */
+static void run_corrupt(const std::vector<uint8_t> &file, const jpeg::jpeg_info_t &info, const int8_t *lut,
+                        int variants, int &decoded, int &rejected)
+{
+    std::vector<uint8_t> frame((size_t)info.width * info.height * 3);
+    full_frame_t f = { frame.data(), info.width, 3 };
+    std::vector<int8_t> out((size_t)dst_width * dst_height * 3);
+    uint32_t seed = 1;
+    for (int v = 0; v < 2 * variants; v++) {
+        std::vector<uint8_t> copy(file);
+        if (v < variants) {
+            copy.resize(file.size() * (v + 1) / (variants + 1));
+        }
+        else {
+            for (int k = 0; k < 4; k++) {
+                seed = seed * 1664525u + 1013904223u;
+                copy[(seed >> 8) % copy.size()] ^= (uint8_t)(1u << (seed & 7));
+            }
+        }
+        jpeg::jpeg_info_t corrupt_info;
+        if (jpeg::get_info(copy.data(), copy.size(), &corrupt_info) != EIDSP_OK ||
+            corrupt_info.width != info.width || corrupt_info.height != info.height) {
+            rejected++;
+            continue;
+        }
+        int full_ret = jpeg::decode(copy.data(), copy.size(), 1, 3, copy_row, &f);
+        int scaled_ret = run_scaled(copy, corrupt_info, lut, out.data());
+        if (full_ret == EIDSP_OK && scaled_ret == EIDSP_OK) {
+            decoded++;
+        }
+        else {
+            rejected++;
+        }
+    }
+}
+
+/**
+ * Quantize the frame's luma for a grayscale model at the input size and from a
+ * copy twice that size, the way run_classifier() gets EI_IMAGE_SOURCE_GRAYSCALE
+ * images. Returns the number of values that differ, -1 if a step fails
+ */
+static int run_gray(const std::vector<uint8_t> &file, const jpeg::jpeg_info_t &info)
+{
+    std::vector<uint8_t> frame((size_t)info.width * info.height);
+    full_frame_t f = { frame.data(), info.width, 1 };
+    if (jpeg::decode(file.data(), file.size(), 1, 1, copy_row, &f) != EIDSP_OK ||
+        processing::crop_and_interpolate_image(
+            frame.data(), info.width, info.height, frame.data(), dst_width, dst_height, 1) != EIDSP_OK) {
+        return -1;
+    }
+    std::vector<uint8_t> twice((size_t)dst_width * dst_height * 4);
+    for (int y = 0; y < 2 * dst_height; y++) {
+        for (int x = 0; x < 2 * dst_width; x++) {
+            twice[(size_t)y * 2 * dst_width + x] = frame[(size_t)(y / 2) * dst_width + x / 2];
+        }
+    }
+
+    static const struct {
+        float scale;
+        float zero_point;
+        int image_scaling;
+    } params[] = {
+        { 0.003921568859368563f, -128, EI_CLASSIFIER_IMAGE_SCALING_NONE },
+        { 0.02f, 0, EI_CLASSIFIER_IMAGE_SCALING_TORCH },
+    };
+    ei_dsp_config_image_t config = { 0, 1, 1, nullptr, 0, "Grayscale" };
+    const uint32_t sizes[2] = { (uint32_t)dst_width, 2 * (uint32_t)dst_width };
+    const uint8_t *buffers[2] = { frame.data(), twice.data() };
+    std::vector<int8_t> out[2];
+    int differ = 0;
+    for (const auto &p : params) {
+        for (int k = 0; k < 2; k++) {
+            image_source_t image;
+            image.buffer = buffers[k];
+            image.width = sizes[k];
+            image.height = sizes[k] * dst_height / dst_width;
+            image.stride = 0;
+            image.format = EI_IMAGE_SOURCE_GRAYSCALE;
+            image.size = 0;
+            out[k].assign((size_t)dst_width * dst_height, 0);
+            matrix_i8_t features(1, (uint32_t)out[k].size(), out[k].data());
+            if (extract_image_features_quantized(&image, &features, dst_width, dst_height, &config,
+                    p.scale, p.zero_point, p.image_scaling) != EIDSP_OK) {
+                return -1;
+            }
+        }
+        for (size_t ix = 0; ix < out[0].size(); ix++) {
+            differ += out[0][ix] != out[1][ix];
+        }
+    }
+    return differ;
+}
+
+template<typename F>
+static double time_per_frame_ms(int iterations, F fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        if (fn() != EIDSP_OK) {
+            return -1;
+        }
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 100;
+    int variants = 0;
+    bool gray = false;
+    int first_file = 1;
+    while (first_file + 1 < argc && argv[first_file][0] == '-') {
+        if (strcmp(argv[first_file], "-g") == 0) {
+            gray = true;
+            first_file++;
+            continue;
+        }
+        if (strcmp(argv[first_file], "-n") == 0) iterations = atoi(argv[first_file + 1]);
+        else if (strcmp(argv[first_file], "-c") == 0) variants = atoi(argv[first_file + 1]);
+        else break;
+        first_file += 2;
+    }
+    if (first_file >= argc || iterations < 1 || variants < 0 || argv[first_file][0] == '-') {
+        fprintf(stderr, "Usage: %s [-n iterations] [-c corrupt_variants] [-g] frame.jpg [frame.jpg ...]\n", argv[0]);
+        return 1;
+    }
+
+    // same table extract_image_features_quantized() builds for a 1/255 scale, -128 zero point
+    int8_t lut[256 * 3];
+    for (int ix = 0; ix < 256 * 3; ix++) {
+        lut[ix] = (int8_t)((ix & 0xff) - 128);
+    }
+
+    int failed = 0;
+    for (int a = first_file; a < argc; a++) {
+        FILE *fp = fopen(argv[a], "rb");
+        if (!fp) {
+            fprintf(stderr, "%s: cannot open\n", argv[a]);
+            failed++;
+            continue;
+        }
+        std::vector<uint8_t> file;
+        uint8_t chunk[4096];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) {
+            file.insert(file.end(), chunk, chunk + n);
+        }
+        fclose(fp);
+
+        jpeg::jpeg_info_t info;
+        int ret = jpeg::get_info(file.data(), file.size(), &info);
+        if (ret != EIDSP_OK) {
+            fprintf(stderr, "%s: unsupported JPEG (%d)\n", argv[a], ret);
+            failed++;
+            continue;
+        }
+
+        if (variants) {
+            int decoded = 0, rejected = 0;
+            run_corrupt(file, info, lut, variants, decoded, rejected);
+            printf("%s: %d corrupt copies decoded, %d rejected\n", argv[a], decoded, rejected);
+            continue;
+        }
+
+        if (gray) {
+            int differ = run_gray(file, info);
+            if (differ < 0) {
+                fprintf(stderr, "%s: grayscale quantization failed\n", argv[a]);
+                failed++;
+            }
+            else {
+                printf("%s: grayscale input resized from %dx%d, %d values differ%s\n", argv[a], 2 * dst_width,
+                    2 * dst_height, differ, differ ? "  MISMATCH" : "");
+                failed += differ > 0;
+            }
+            continue;
+        }
+
+        std::vector<int8_t> full((size_t)dst_width * dst_height * 3);
+        std::vector<int8_t> scaled(full.size());
+        double full_ms = time_per_frame_ms(iterations, [&]() { return run_full(file, info, full.data()); });
+        double scaled_ms = time_per_frame_ms(iterations, [&]() { return run_scaled(file, info, lut, scaled.data()); });
+        if (full_ms < 0 || scaled_ms < 0) {
+            fprintf(stderr, "%s: decode failed\n", argv[a]);
+            failed++;
+            continue;
+        }
+
+        long sum = 0;
+        int max = 0;
+        for (size_t ix = 0; ix < full.size(); ix++) {
+            int d = abs(full[ix] - scaled[ix]);
+            sum += d;
+            max = d > max ? d : max;
+        }
+
+        printf("%s: %dx%d, %d component(s), decoded at 1/%d for %dx%d\n", argv[a], info.width, info.height,
+            info.components, jpeg::choose_scale(info.width, info.height, dst_width, dst_height), dst_width, dst_height);
+        printf("  full decode + crop_and_interpolate_image   %8.3f ms/frame\n", full_ms);
+        printf("  scaled decode + streaming resize/quantize  %8.3f ms/frame (%.2fx)\n", scaled_ms, full_ms / scaled_ms);
+        printf("  difference (int8 units): mean %.3f, max %d\n", (double)sum / full.size(), max);
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+/* Host benchmark: capture -> inference -> report pipeline
+ *
+ * Runs the stage logic of the firmware (src/pipeline.cpp) on pthreads, one
+ * thread per stage as the ESP32 runs one task per stage, with simulated stage
+ * times, and compares the frame rate against running the same stages one after
+ * the other the way loop() used to.
+ *
+ * Every captured frame fills its feature slot with a pattern derived from its
+ * sequence number, and the inference stage checks it, so a slot that is reused
+ * while still in the model, or a frame that is reported out of order, fails
+ * the run.
+ *
+ * Usage: pipeline_benchmark [-n frames] [-c capture_ms] [-i inference_ms] [-r report_ms]
+ *                           [-f fail_every]
+ */
+#include <atomic>
+#include <chrono>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "pipeline.h"
+
+typedef struct {
+    uint32_t capture_ms;
+    uint32_t inference_ms;
+    uint32_t report_ms;
+    uint32_t fail_every;        // every nth capture fails, 0 for none
+    std::atomic<uint32_t> captures;
+    std::atomic<uint32_t> corrupt;
+    std::atomic<uint32_t> out_of_order;
+    int64_t last_reported;      // report thread only
+} sim_t;
+
+static const size_t slot_size = 96 * 96 * 3;
+
+static void sleep_ms(uint32_t ms)
+{
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+
+static uint32_t now_ms(void *user)
+{
+    (void)user;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool capture(void *user, int8_t *features, size_t features_size, PipelineFrameInfo *info)
+{
+    sim_t *sim = (sim_t *)user;
+    uint32_t n = ++sim->captures;
+    sleep_ms(sim->capture_ms);
+    if (sim->fail_every && n % sim->fail_every == 0) {
+        return false;
+    }
+    memset(features, (int)(info->sequence & 0x7f), features_size);
+    info->dsp_us = sim->capture_ms * 1000;
+    return true;
+}
+
+static bool infer(void *user, const int8_t *features, size_t features_size, PipelinePrediction *prediction)
+{
+    sim_t *sim = (sim_t *)user;
+    int8_t expected = (int8_t)(prediction->sequence & 0x7f);
+    // check both ends, the model reads the slot while capture may write the other one
+    if (features[0] != expected || features[features_size - 1] != expected) {
+        sim->corrupt++;
+    }
+    sleep_ms(sim->inference_ms);
+    if (features[0] != expected || features[features_size - 1] != expected) {
+        sim->corrupt++;
+    }
+    prediction->label = 0;
+    prediction->detected = true;
+    prediction->confidence = 1.0f;
+    prediction->classification_us = sim->inference_ms * 1000;
+    return true;
+}
+
+static void report(void *user, const PipelinePrediction *prediction)
+{
+    sim_t *sim = (sim_t *)user;
+    if ((int64_t)prediction->sequence <= sim->last_reported) {
+        sim->out_of_order++;
+    }
+    sim->last_reported = prediction->sequence;
+    sleep_ms(sim->report_ms);
+}
+
+static void idle(void *user)
+{
+    (void)user;
+    sleep_ms(1);
+}
+
+static void *capture_thread(void *arg)
+{
+    ((Pipeline *)arg)->run_capture();
+    return NULL;
+}
+
+static void *inference_thread(void *arg)
+{
+    ((Pipeline *)arg)->run_inference();
+    return NULL;
+}
+
+static void *report_thread(void *arg)
+{
+    ((Pipeline *)arg)->run_report();
+    return NULL;
+}
+
+static void reset(sim_t *sim)
+{
+    sim->captures = 0;
+    sim->corrupt = 0;
+    sim->out_of_order = 0;
+    sim->last_reported = -1;
+}
+
+// The stages back to back on one thread, like the old loop()
+static double run_serial(const PipelineStages &stages, int8_t *slots, uint32_t frames)
+{
+    Pipeline pipeline(stages, slots, slot_size);
+    auto start = std::chrono::steady_clock::now();
+    while (pipeline.stats().reported < frames) {
+        pipeline.capture_step();
+        pipeline.inference_step();
+        pipeline.report_step();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return frames / elapsed.count();
+}
+
+static double run_pipelined(const PipelineStages &stages, int8_t *slots, uint32_t frames,
+    PipelineStats *stats)
+{
+    Pipeline pipeline(stages, slots, slot_size);
+    pthread_t threads[3];
+
+    auto start = std::chrono::steady_clock::now();
+    pthread_create(&threads[0], NULL, capture_thread, &pipeline);
+    pthread_create(&threads[1], NULL, inference_thread, &pipeline);
+    pthread_create(&threads[2], NULL, report_thread, &pipeline);
+    while (pipeline.stats().reported < frames) {
+        sleep_ms(1);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    pipeline.stop();
+    for (int ix = 0; ix < 3; ix++) {
+        pthread_join(threads[ix], NULL);
+    }
+    *stats = pipeline.stats();
+    return frames / elapsed.count();
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = 50;
+    sim_t sim;
+    sim.capture_ms = 20;
+    sim.inference_ms = 40;
+    sim.report_ms = 30;
+    sim.fail_every = 0;
+
+    for (int a = 1; a + 1 < argc; a += 2) {
+        uint32_t v = (uint32_t)atoi(argv[a + 1]);
+        if (strcmp(argv[a], "-n") == 0) frames = v;
+        else if (strcmp(argv[a], "-c") == 0) sim.capture_ms = v;
+        else if (strcmp(argv[a], "-i") == 0) sim.inference_ms = v;
+        else if (strcmp(argv[a], "-r") == 0) sim.report_ms = v;
+        else if (strcmp(argv[a], "-f") == 0) sim.fail_every = v;
+        else {
+            fprintf(stderr, "Usage: %s [-n frames] [-c capture_ms] [-i inference_ms] [-r report_ms] [-f fail_every]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1) {
+        fprintf(stderr, "Need at least one frame\n");
+        return 1;
+    }
+
+    const PipelineStages stages = { capture, infer, report, idle, now_ms, &sim };
+    std::vector<int8_t> slots(PIPELINE_SLOTS * slot_size);
+
+    printf("%u frames, capture %u ms, inference %u ms, report %u ms\n",
+        frames, sim.capture_ms, sim.inference_ms, sim.report_ms);
+
+    reset(&sim);
+    double serial_fps = run_serial(stages, slots.data(), frames);
+    printf("  serial     %8.2f frames/s\n", serial_fps);
+
+    reset(&sim);
+    PipelineStats stats;
+    double pipelined_fps = run_pipelined(stages, slots.data(), frames, &stats);
+    printf("  pipelined  %8.2f frames/s (%.2fx)\n", pipelined_fps, pipelined_fps / serial_fps);
+    printf("  captured %u (%u failed), classified %u, reported %u, dropped %u\n",
+        stats.captured, stats.capture_failed, stats.inferred, stats.reported, stats.dropped);
+    printf("  capture waited for a slot %u times, ready depth max %u, report depth max %u\n",
+        stats.capture_waits, stats.ready_max_depth, stats.report_max_depth);
+
+    if (sim.corrupt || sim.out_of_order) {
+        printf("FAILED: %u corrupted slots, %u predictions out of order\n",
+            (unsigned)sim.corrupt, (unsigned)sim.out_of_order);
+        return 1;
+    }
+    return 0;
+}
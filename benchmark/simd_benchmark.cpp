@@ -0,0 +1,447 @@
+/* Host benchmark: AVX2/NEON int8 kernels of the host build
+ *
+ * Runs the convolution, depthwise convolution, fully connected and add layers
+ * of the compiled model (the shapes of their tensors, random weights,
+ * activations and requantization) through the vectorized kernels in
+ * kernels/internal/optimized/integer_ops and through the reference ones they
+ * stand in for, and prints the time of both. The outputs have to match bit
+ * for bit. The three convolutions and the add of a fused INVERTED_RESIDUAL
+ * node are run as the layers they replace.
+ *
+ * Output size and padding are the ones the kernels get: the output tensor's
+ * and what prepare computes, so the windows of folded PAD and SAME layers run
+ * past the bottom or right edge of the input (marked with *). A few more
+ * shapes follow the model's: channel counts that leave a tail after the
+ * vectors, odd sizes with windows past every edge, and the asymmetric
+ * padding of a stride 2 SAME layer.
+ *
+ * Usage: simd_benchmark [-n iterations]
+ * Without EI_CLASSIFIER_TFLITE_ENABLE_SIMD (cmake -DEI_SIMD=OFF on x86-64)
+ * both sides are the reference kernels.
+ */
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#include "tflite-model/tflite_learn_864078_5_compiled.h"
+
+using namespace tflite;
+
+typedef enum {
+    LAYER_CONV,
+    LAYER_DEPTHWISE,
+    LAYER_FULLY_CONNECTED,
+    LAYER_ADD
+} layer_kind_t;
+
+typedef struct {
+    char name[48];
+    layer_kind_t kind;
+    int filter_wd, filter_ht;
+    int stride_wd, stride_ht;
+    int dilation_wd, dilation_ht;
+    int pad_wd, pad_ht;     // top and left, as prepare computes them
+    int input_wd, input_ht, in_channels;
+    int out_wd, out_ht, out_channels;
+    bool past_edge;         // windows run past the bottom or right edge
+} layer_t;
+
+static bool same_shape(const layer_t &a, const layer_t &b)
+{
+    return a.kind == b.kind && a.filter_wd == b.filter_wd && a.filter_ht == b.filter_ht &&
+        a.stride_wd == b.stride_wd && a.stride_ht == b.stride_ht && a.dilation_wd == b.dilation_wd &&
+        a.dilation_ht == b.dilation_ht && a.pad_wd == b.pad_wd && a.pad_ht == b.pad_ht &&
+        a.input_wd == b.input_wd && a.input_ht == b.input_ht && a.in_channels == b.in_channels &&
+        a.out_wd == b.out_wd && a.out_ht == b.out_ht && a.out_channels == b.out_channels;
+}
+
+// A convolution or depthwise convolution; out_wd and out_ht 0 for the size the
+// padding mode gives
+static layer_t conv_layer(layer_kind_t kind, int filter_wd, int filter_ht, int stride_wd, int stride_ht,
+                          int dilation_wd, int dilation_ht, TfLitePadding padding, int input_wd, int input_ht,
+                          int in_channels, int out_wd, int out_ht, int out_channels)
+{
+    layer_t layer = {};
+    layer.kind = kind;
+    layer.filter_wd = filter_wd;
+    layer.filter_ht = filter_ht;
+    layer.stride_wd = stride_wd;
+    layer.stride_ht = stride_ht;
+    layer.dilation_wd = dilation_wd;
+    layer.dilation_ht = dilation_ht;
+    layer.input_wd = input_wd;
+    layer.input_ht = input_ht;
+    layer.in_channels = in_channels;
+    layer.out_channels = out_channels;
+    int computed_ht, computed_wd;
+    TfLitePaddingValues pad = ComputePaddingHeightWidth(stride_ht, stride_wd, dilation_ht, dilation_wd,
+        input_ht, input_wd, filter_ht, filter_wd, padding, &computed_ht, &computed_wd);
+    layer.pad_wd = pad.width;
+    layer.pad_ht = pad.height;
+    layer.out_wd = out_wd > 0 ? out_wd : computed_wd;
+    layer.out_ht = out_ht > 0 ? out_ht : computed_ht;
+    layer.past_edge =
+        (layer.out_wd - 1) * stride_wd + (filter_wd - 1) * dilation_wd + 1 - layer.pad_wd > input_wd ||
+        (layer.out_ht - 1) * stride_ht + (filter_ht - 1) * dilation_ht + 1 - layer.pad_ht > input_ht;
+    snprintf(layer.name, sizeof(layer.name), "%s %dx%d/%d %dx%dx%d ->%dx%dx%d%s",
+        kind == LAYER_DEPTHWISE ? "dw" : "conv", filter_wd, filter_ht, stride_wd, input_wd, input_ht,
+        in_channels, layer.out_wd, layer.out_ht, layer.out_channels, layer.past_edge ? " *" : "");
+    return layer;
+}
+
+// batches rows of depth values to channels outputs each
+static layer_t fully_connected_layer(int batches, int depth, int channels)
+{
+    layer_t layer = {};
+    layer.kind = LAYER_FULLY_CONNECTED;
+    layer.input_wd = layer.out_wd = 1;
+    layer.input_ht = layer.out_ht = batches;
+    layer.in_channels = depth;
+    layer.out_channels = channels;
+    snprintf(layer.name, sizeof(layer.name), "fc %dx%d ->%d", batches, depth, channels);
+    return layer;
+}
+
+// Two tensors of wd x ht x channels added elementwise
+static layer_t add_layer(int wd, int ht, int channels)
+{
+    layer_t layer = {};
+    layer.kind = LAYER_ADD;
+    layer.input_wd = layer.out_wd = wd;
+    layer.input_ht = layer.out_ht = ht;
+    layer.in_channels = layer.out_channels = channels;
+    snprintf(layer.name, sizeof(layer.name), "add %dx%dx%d", wd, ht, channels);
+    return layer;
+}
+
+static void add_unique(std::vector<layer_t> &layers, const layer_t &layer)
+{
+    for (const layer_t &other : layers) {
+        if (same_shape(layer, other)) {
+            return;
+        }
+    }
+    layers.push_back(layer);
+}
+
+// Every distinct layer of the compiled model the vectorized kernels run
+static std::vector<layer_t> model_layers()
+{
+    std::vector<layer_t> layers;
+    for (size_t ix = 0; ix < tflite_learn_864078_5_nodes(); ix++) {
+        const char *op;
+        const void *params;
+        TfLiteTensor input, filter, output;
+        if (tflite_learn_864078_5_node_shape(ix, &op, &params, &input, &filter, &output) != kTfLiteOk) {
+            break;
+        }
+        // NHWC, filter OHWI (1HWC for depthwise)
+        if (strcmp(op, "CONV_2D") == 0) {
+            const TfLiteConvParams *conv = (const TfLiteConvParams *)params;
+            add_unique(layers, conv_layer(LAYER_CONV, filter.dims->data[2], filter.dims->data[1],
+                conv->stride_width, conv->stride_height, conv->dilation_width_factor,
+                conv->dilation_height_factor, conv->padding, input.dims->data[2], input.dims->data[1],
+                input.dims->data[3], output.dims->data[2], output.dims->data[1], output.dims->data[3]));
+        }
+        else if (strcmp(op, "DEPTHWISE_CONV_2D") == 0) {
+            const TfLiteDepthwiseConvParams *dw = (const TfLiteDepthwiseConvParams *)params;
+            add_unique(layers, conv_layer(LAYER_DEPTHWISE, filter.dims->data[2], filter.dims->data[1],
+                dw->stride_width, dw->stride_height, dw->dilation_width_factor, dw->dilation_height_factor,
+                dw->padding, input.dims->data[2], input.dims->data[1], input.dims->data[3],
+                output.dims->data[2], output.dims->data[1], output.dims->data[3]));
+        }
+        else if (strcmp(op, "INVERTED_RESIDUAL") == 0) {
+            // 1x1 expand, 3x3 depthwise (stride 1, SAME), 1x1 project, add
+            const int wd = input.dims->data[2], ht = input.dims->data[1];
+            const int expanded = filter.dims->data[0];
+            add_unique(layers, conv_layer(LAYER_CONV, 1, 1, 1, 1, 1, 1, kTfLitePaddingValid, wd, ht,
+                input.dims->data[3], 0, 0, expanded));
+            add_unique(layers, conv_layer(LAYER_DEPTHWISE, 3, 3, 1, 1, 1, 1, kTfLitePaddingSame, wd, ht,
+                expanded, 0, 0, expanded));
+            add_unique(layers, conv_layer(LAYER_CONV, 1, 1, 1, 1, 1, 1, kTfLitePaddingValid, wd, ht,
+                expanded, 0, 0, output.dims->data[3]));
+            add_unique(layers, add_layer(wd, ht, output.dims->data[3]));
+        }
+        else if (strcmp(op, "FULLY_CONNECTED") == 0) {
+            const int channels = filter.dims->data[0];
+            const int depth = filter.dims->data[1];
+            int outputs = 1;
+            for (int d = 0; d < output.dims->size; d++) {
+                outputs *= output.dims->data[d];
+            }
+            add_unique(layers, fully_connected_layer(outputs / channels, depth, channels));
+        }
+    }
+    return layers;
+}
+
+// Shapes the model does not have: channel counts with a tail after the 4 (dot
+// products) and 8 (requantization, depthwise) wide blocks, depths with a tail
+// after the 16 (AVX2) and 8 (NEON) wide loads, odd sizes with windows past
+// every edge, dilation and an FC over several batches
+static std::vector<layer_t> extra_layers()
+{
+    std::vector<layer_t> layers;
+    layers.push_back(conv_layer(LAYER_CONV, 3, 3, 2, 2, 1, 1, kTfLitePaddingSame, 13, 11, 3, 0, 0, 5));
+    layers.push_back(conv_layer(LAYER_CONV, 3, 3, 1, 1, 1, 1, kTfLitePaddingSame, 9, 7, 7, 0, 0, 11));
+    layers.push_back(conv_layer(LAYER_CONV, 1, 1, 1, 1, 1, 1, kTfLitePaddingValid, 5, 3, 21, 0, 0, 13));
+    layers.push_back(conv_layer(LAYER_CONV, 3, 3, 1, 1, 2, 2, kTfLitePaddingSame, 10, 9, 6, 0, 0, 9));
+    layers.push_back(conv_layer(LAYER_CONV, 3, 3, 2, 2, 1, 1, kTfLitePaddingValid, 12, 10, 8, 6, 5, 10));
+    layers.push_back(conv_layer(LAYER_DEPTHWISE, 3, 3, 1, 1, 1, 1, kTfLitePaddingSame, 9, 7, 12, 0, 0, 12));
+    layers.push_back(conv_layer(LAYER_DEPTHWISE, 3, 3, 2, 2, 1, 1, kTfLitePaddingSame, 11, 10, 3, 0, 0, 3));
+    layers.push_back(conv_layer(LAYER_DEPTHWISE, 3, 3, 2, 2, 1, 1, kTfLitePaddingValid, 12, 12, 19, 6, 6, 19));
+    layers.push_back(conv_layer(LAYER_DEPTHWISE, 5, 5, 1, 1, 1, 1, kTfLitePaddingSame, 7, 8, 35, 0, 0, 35));
+    layers.push_back(fully_connected_layer(3, 37, 9));
+    layers.push_back(fully_connected_layer(1, 200, 5));
+    layers.push_back(add_layer(13, 1, 1));
+    layers.push_back(add_layer(5, 3, 7));
+    return layers;
+}
+
+static void fill(std::vector<int8_t> &v)
+{
+    for (size_t ix = 0; ix < v.size(); ix++) {
+        v[ix] = (int8_t)(rand() & 0xff);
+    }
+}
+
+static int random_zero_point()
+{
+    return rand() % 256 - 128;
+}
+
+// Runs one kernel iterations times and returns the mean time in us
+template <typename F>
+static double time_us(int iterations, F run)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        run();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+// Requantization of a sum over depth products of random int8 values: a
+// multiplier in [0.5, 1) and a shift that leaves most outputs inside int8, so
+// both the rounding and the clamping get exercised
+static void random_requantization(int depth, int32_t *multiplier, int32_t *shift)
+{
+    const double spread = sqrt((double)depth) * 74.0 * 148.0 / 48.0;
+    *multiplier = (int32_t)((1u << 30) + ((uint32_t)rand() % (1u << 30)));
+    *shift = -(int32_t)lround(log2(spread)) + rand() % 3 - 1;
+}
+
+// Returns the number of outputs of the vectorized kernel that differ from the
+// reference one
+static size_t run_layer(const layer_t &layer, int iterations, double *ref_us, double *simd_us)
+{
+    const size_t output_size = (size_t)layer.out_wd * layer.out_ht * layer.out_channels;
+    std::vector<int8_t> input((size_t)layer.input_wd * layer.input_ht * layer.in_channels);
+    std::vector<int8_t> ref_out(output_size), simd_out(output_size);
+    fill(input);
+    const int32_t input_offset = -random_zero_point();
+    const int32_t output_offset = random_zero_point();
+    // every other layer with a ReLU6 style range
+    const int32_t activation_min = rand() % 2 ? -128 : std::max(-128, output_offset);
+    const int32_t activation_max = 127;
+
+    if (layer.kind == LAYER_CONV || layer.kind == LAYER_DEPTHWISE) {
+        const bool depthwise = layer.kind == LAYER_DEPTHWISE;
+        const int filter_in = depthwise ? 1 : layer.in_channels;
+        const int window = layer.filter_wd * layer.filter_ht * (depthwise ? 1 : layer.in_channels);
+        std::vector<int8_t> filter((size_t)layer.out_channels * layer.filter_wd * layer.filter_ht * filter_in);
+        std::vector<int32_t> bias(layer.out_channels), mult(layer.out_channels), shift(layer.out_channels);
+        fill(filter);
+        for (int ch = 0; ch < layer.out_channels; ch++) {
+            bias[ch] = rand() % 40001 - 20000;
+            random_requantization(window, &mult[ch], &shift[ch]);
+        }
+        const int32_t input_dims[4] = { 1, layer.input_ht, layer.input_wd, layer.in_channels };
+        const int32_t filter_dims[4] = { depthwise ? 1 : layer.out_channels, layer.filter_ht, layer.filter_wd,
+                                         depthwise ? layer.out_channels : layer.in_channels };
+        const int32_t bias_dims[1] = { layer.out_channels };
+        const int32_t output_dims[4] = { 1, layer.out_ht, layer.out_wd, layer.out_channels };
+        const RuntimeShape input_shape(4, input_dims), filter_shape(4, filter_dims);
+        const RuntimeShape bias_shape(1, bias_dims), output_shape(4, output_dims);
+
+        if (depthwise) {
+            DepthwiseParams params = {};
+            params.padding_type = PaddingType::kSame;
+            params.padding_values.width = layer.pad_wd;
+            params.padding_values.height = layer.pad_ht;
+            params.stride_width = layer.stride_wd;
+            params.stride_height = layer.stride_ht;
+            params.dilation_width_factor = layer.dilation_wd;
+            params.dilation_height_factor = layer.dilation_ht;
+            params.depth_multiplier = layer.out_channels / layer.in_channels;
+            params.input_offset = input_offset;
+            params.output_offset = output_offset;
+            params.quantized_activation_min = activation_min;
+            params.quantized_activation_max = activation_max;
+            *ref_us = time_us(iterations, [&]() {
+                reference_integer_ops::DepthwiseConvPerChannel(params, mult.data(), shift.data(), input_shape,
+                    input.data(), filter_shape, filter.data(), bias_shape, bias.data(), output_shape,
+                    ref_out.data());
+            });
+            *simd_us = time_us(iterations, [&]() {
+                optimized_integer_ops::DepthwiseConvPerChannel(params, mult.data(), shift.data(), input_shape,
+                    input.data(), filter_shape, filter.data(), bias_shape, bias.data(), output_shape,
+                    simd_out.data());
+            });
+        }
+        else {
+            ConvParams params = {};
+            params.padding_type = PaddingType::kSame;
+            params.padding_values.width = layer.pad_wd;
+            params.padding_values.height = layer.pad_ht;
+            params.stride_width = layer.stride_wd;
+            params.stride_height = layer.stride_ht;
+            params.dilation_width_factor = layer.dilation_wd;
+            params.dilation_height_factor = layer.dilation_ht;
+            params.input_offset = input_offset;
+            params.output_offset = output_offset;
+            params.quantized_activation_min = activation_min;
+            params.quantized_activation_max = activation_max;
+            *ref_us = time_us(iterations, [&]() {
+                reference_integer_ops::ConvPerChannel(params, mult.data(), shift.data(), input_shape,
+                    input.data(), filter_shape, filter.data(), bias_shape, bias.data(), output_shape,
+                    ref_out.data());
+            });
+            *simd_us = time_us(iterations, [&]() {
+                optimized_integer_ops::ConvPerChannel(params, mult.data(), shift.data(), input_shape,
+                    input.data(), filter_shape, filter.data(), bias_shape, bias.data(), output_shape,
+                    simd_out.data());
+            });
+        }
+    }
+    else if (layer.kind == LAYER_FULLY_CONNECTED) {
+        std::vector<int8_t> filter((size_t)layer.out_channels * layer.in_channels);
+        std::vector<int32_t> bias(layer.out_channels);
+        fill(filter);
+        for (int ch = 0; ch < layer.out_channels; ch++) {
+            bias[ch] = rand() % 40001 - 20000;
+        }
+        FullyConnectedParams params = {};
+        params.input_offset = input_offset;
+        params.weights_offset = 0;
+        params.output_offset = output_offset;
+        random_requantization(layer.in_channels, &params.output_multiplier, &params.output_shift);
+        params.quantized_activation_min = activation_min;
+        params.quantized_activation_max = activation_max;
+        const int32_t input_dims[2] = { layer.input_ht, layer.in_channels };
+        const int32_t filter_dims[2] = { layer.out_channels, layer.in_channels };
+        const int32_t bias_dims[1] = { layer.out_channels };
+        const int32_t output_dims[2] = { layer.out_ht, layer.out_channels };
+        const RuntimeShape input_shape(2, input_dims), filter_shape(2, filter_dims);
+        const RuntimeShape bias_shape(1, bias_dims), output_shape(2, output_dims);
+        *ref_us = time_us(iterations, [&]() {
+            reference_integer_ops::FullyConnected(params, input_shape, input.data(), filter_shape,
+                filter.data(), bias_shape, bias.data(), output_shape, ref_out.data());
+        });
+        *simd_us = time_us(iterations, [&]() {
+            optimized_integer_ops::FullyConnected(params, input_shape, input.data(), filter_shape,
+                filter.data(), bias_shape, bias.data(), output_shape, simd_out.data());
+        });
+    }
+    else {
+        // as the add kernel's prepare: both inputs rescaled to twice the larger
+        // input scale, with 20 bits of headroom
+        std::vector<int8_t> input2(input.size());
+        fill(input2);
+        const double scale1 = 0.01 + (rand() % 1000) / 10000.0;
+        const double scale2 = 0.01 + (rand() % 1000) / 10000.0;
+        const double output_scale = 0.01 + (rand() % 1000) / 10000.0;
+        const double twice_max = 2.0 * std::max(scale1, scale2);
+        ArithmeticParams params = {};
+        params.left_shift = 20;
+        params.input1_offset = input_offset;
+        params.input2_offset = -random_zero_point();
+        params.output_offset = output_offset;
+        QuantizeMultiplierSmallerThanOneExp(scale1 / twice_max, &params.input1_multiplier, &params.input1_shift);
+        QuantizeMultiplierSmallerThanOneExp(scale2 / twice_max, &params.input2_multiplier, &params.input2_shift);
+        QuantizeMultiplierSmallerThanOneExp(twice_max / ((1 << params.left_shift) * output_scale),
+            &params.output_multiplier, &params.output_shift);
+        params.quantized_activation_min = activation_min;
+        params.quantized_activation_max = activation_max;
+        const int32_t dims[1] = { (int32_t)input.size() };
+        const RuntimeShape shape(1, dims);
+        *ref_us = time_us(iterations, [&]() {
+            reference_integer_ops::Add(params, shape, input.data(), shape, input2.data(), shape, ref_out.data());
+        });
+        *simd_us = time_us(iterations, [&]() {
+            optimized_integer_ops::Add(params, shape, input.data(), shape, input2.data(), shape, simd_out.data());
+        });
+    }
+
+    size_t mismatches = 0;
+    for (size_t ix = 0; ix < output_size; ix++) {
+        mismatches += ref_out[ix] != simd_out[ix];
+    }
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20;
+
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-n") == 0 && a + 1 < argc) {
+            iterations = atoi(argv[++a]);
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    const std::vector<layer_t> layers = model_layers();
+    if (layers.empty()) {
+        printf("The model has no layers the vectorized kernels run\n");
+        return 1;
+    }
+    const std::vector<layer_t> extra = extra_layers();
+
+#if !EI_TFLITE_SIMD
+    printf("No vectorized kernels in this build, both sides are the reference kernels\n\n");
+#endif
+    srand(1);
+    printf("%-40s %10s %10s %8s %10s\n", "layer", "ref us", "simd us", "speedup", "differ");
+    double ref_total = 0, simd_total = 0;
+    int failed = 0;
+    for (size_t ix = 0; ix < layers.size() + extra.size(); ix++) {
+        if (ix == layers.size()) {
+            printf("%-40s %10.1f %10.1f %7.2fx\n\n", "model total", ref_total, simd_total,
+                ref_total / simd_total);
+        }
+        const layer_t &layer = ix < layers.size() ? layers[ix] : extra[ix - layers.size()];
+        double ref_us, simd_us;
+        size_t mismatches = run_layer(layer, iterations, &ref_us, &simd_us);
+        printf("%-40s %10.1f %10.1f %7.2fx %10u%s\n", layer.name, ref_us, simd_us, ref_us / simd_us,
+            (unsigned)mismatches, mismatches ? "  MISMATCH" : "");
+        if (ix < layers.size()) {
+            ref_total += ref_us;
+            simd_total += simd_us;
+        }
+        failed += mismatches > 0;
+    }
+    printf("* windows run past the bottom or right edge of the input\n");
+    if (failed) {
+        printf("%d layers differ from the reference\n", failed);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#ifndef FRAME_HUB_H
+#define FRAME_HUB_H
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Reference counted camera frames, shared by every consumer.
+ *
+ * One thread (the camera task) grabs each JPEG frame once and publishes it.
+ * Stream clients, snapshots and the capture stage of the pipeline all
+ * acquire() the latest frame, read it, and release() it; nobody else talks
+ * to the camera. A frame goes back to the pool when its last reference is
+ * gone. The hub keeps one reference on the latest frame itself, so there is
+ * always something to hand out.
+ *
+ * The JPEG is copied out of the camera buffer, which goes straight back to
+ * the driver, so slow stream clients never starve the camera (or inference)
+ * of framebuffers. When every pool frame is still in use, publishing skips
+ * the new frame.
+ *
+ * No Arduino dependency; the platform supplies the pool memory and the
+ * publishing thread (see src/main.cpp).
+ */
+
+#ifndef FRAME_HUB_FRAMES
+#define FRAME_HUB_FRAMES 5  // latest + 2 streams + capture stage + one being written
+#endif
+
+struct SharedFrame {
+    uint8_t *data;
+    size_t length;
+    uint16_t width;
+    uint16_t height;
+    uint32_t sequence;      // 1 for the first frame
+    uint32_t timestamp_ms;
+
+    // owned by the hub
+    size_t capacity;
+    uint32_t refs;
+};
+
+struct FrameHubStats {
+    uint32_t published;
+    uint32_t skipped_busy;      // every pool frame was referenced
+    uint32_t skipped_oversize;  // JPEG larger than a pool frame
+};
+
+class FrameHub {
+public:
+    // memory holds FRAME_HUB_FRAMES * frame_capacity bytes
+    FrameHub(uint8_t *memory, size_t frame_capacity);
+
+    // Publisher: a free frame to copy length bytes into, nullptr to skip this one
+    SharedFrame *publish_begin(size_t length);
+    // Publisher: make frame (filled by the caller) the latest
+    void publish_end(SharedFrame *frame, uint16_t width, uint16_t height, uint32_t timestamp_ms);
+
+    // Consumers: the latest frame if it is newer than sequence (0 for any), or nullptr
+    SharedFrame *acquire(uint32_t newer_than);
+    void release(SharedFrame *frame);
+
+    // Consumers: ask the publisher for a new frame even when nobody streams
+    void request() { requested_ = true; }
+    // Publisher: true once per request()
+    bool take_request() { return requested_.exchange(false); }
+
+    FrameHubStats stats() const;
+
+private:
+    FrameHub(const FrameHub &) = delete;
+    FrameHub &operator=(const FrameHub &) = delete;
+
+    mutable std::mutex mutex_;
+    SharedFrame frames_[FRAME_HUB_FRAMES];
+    SharedFrame *latest_;
+    uint32_t sequence_;
+    std::atomic<bool> requested_;
+
+    uint32_t published_;
+    uint32_t skipped_busy_;
+    uint32_t skipped_oversize_;
+};
+
+#endif // FRAME_HUB_H
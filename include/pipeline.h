@@ -0,0 +1,128 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "spsc_queue.h"
+
+/*
+ * Three stage capture -> inference -> report pipeline.
+ *
+ *   capture    grabs a frame and decodes/quantizes it into a free feature slot
+ *   inference  runs the model over the oldest filled slot, then frees it
+ *   report     sends predictions to the backend and drives the LED
+ *
+ * The stages talk through single-producer/single-consumer queues only, so each
+ * one can run in its own thread pinned to its own core. There are two feature
+ * slots: while the model works through one frame, the next one is decoded into
+ * the other. This file has no Arduino or FreeRTOS dependency; the platform
+ * supplies the stage work (PipelineStages) and the threads, see src/main.cpp
+ * for the ESP32 and benchmark/pipeline_benchmark.cpp for the pthreads build.
+ */
+
+#define PIPELINE_SLOTS 2
+
+struct PipelineFrameInfo {
+    uint32_t sequence;      // set by the pipeline
+    uint32_t captured_ms;   // set by the pipeline
+    uint32_t dsp_us;        // decode + resize + quantize, set by capture()
+};
+
+struct PipelinePrediction {
+    uint32_t sequence;
+    uint32_t captured_ms;
+    uint32_t classified_ms;
+    uint32_t dsp_us;
+    uint32_t classification_us;
+    int label;              // index of the best score, -1 if inference failed
+    bool detected;          // the best score is above CONFIDENCE_THRESHOLD
+    float confidence;       // probability of label, -1 when it was not needed
+    int error;              // EI_IMPULSE_ERROR of the inference
+};
+
+struct PipelineStages {
+    // Grab a frame and quantize it into features. False if there was no usable frame.
+    bool (*capture)(void *user, int8_t *features, size_t features_size, PipelineFrameInfo *info);
+    // Run the model. Fills label, detected, confidence, classification_us and error; false on error.
+    bool (*infer)(void *user, const int8_t *features, size_t features_size, PipelinePrediction *prediction);
+    // Hand a prediction to the outside world (network, LED, globals)
+    void (*report)(void *user, const PipelinePrediction *prediction);
+    // Called by a stage that has nothing to do, should sleep a little
+    void (*idle)(void *user);
+    // Monotonic milliseconds
+    uint32_t (*now_ms)(void *user);
+    void *user;
+};
+
+struct PipelineStats {
+    uint32_t captured;
+    uint32_t capture_failed;
+    uint32_t capture_waits;     // times capture found no free slot, inference is the bottleneck
+    uint32_t inferred;
+    uint32_t inference_failed;
+    uint32_t reported;
+    uint32_t dropped;           // report queue full, prediction thrown away
+    uint32_t ready_max_depth;
+    uint32_t report_max_depth;
+};
+
+class Pipeline {
+public:
+    // slot_memory holds PIPELINE_SLOTS * slot_size bytes
+    Pipeline(const PipelineStages &stages, int8_t *slot_memory, size_t slot_size);
+
+    // Minimum time between two captures, 0 to run as fast as the slowest stage
+    void set_interval(uint32_t interval_ms) { interval_ms_ = interval_ms; }
+    void set_paused(bool paused) { paused_ = paused; }
+    bool paused() const { return paused_; }
+
+    // One unit of work of a stage. False if there was nothing to do.
+    bool capture_step();
+    bool inference_step();
+    bool report_step();
+
+    // Thread bodies: run a stage until stop(), idling when it has nothing to do
+    void run_capture();
+    void run_inference();
+    void run_report();
+    void stop() { running_ = false; }
+
+    PipelineStats stats() const;
+
+private:
+    Pipeline(const Pipeline &) = delete;
+    Pipeline &operator=(const Pipeline &) = delete;
+
+    int8_t *slot(uint8_t ix) { return slot_memory_ + (size_t)ix * slot_size_; }
+
+    PipelineStages stages_;
+    int8_t *slot_memory_;
+    size_t slot_size_;
+    PipelineFrameInfo slot_info_[PIPELINE_SLOTS];
+
+    // slot indices, capture -> inference and back
+    SpscQueue<uint8_t, 4> ready_;
+    SpscQueue<uint8_t, 4> free_;
+    SpscQueue<PipelinePrediction, 8> predictions_;
+
+    std::atomic<uint32_t> interval_ms_;
+    std::atomic<bool> paused_;
+    std::atomic<bool> running_;
+    bool captured_once_;
+    bool waiting_;
+    int held_slot_;
+    uint32_t last_capture_ms_;
+    uint32_t sequence_;
+
+    std::atomic<uint32_t> captured_;
+    std::atomic<uint32_t> capture_failed_;
+    std::atomic<uint32_t> capture_waits_;
+    std::atomic<uint32_t> inferred_;
+    std::atomic<uint32_t> inference_failed_;
+    std::atomic<uint32_t> reported_;
+    std::atomic<uint32_t> dropped_;
+};
+
+#endif // PIPELINE_H
@@ -0,0 +1,72 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Bounded lock-free queue for exactly one producer and one consumer thread
+ * (FreeRTOS task or pthread). Capacity must be a power of two. push() and
+ * pop() never block; the caller decides whether to wait, drop or retry.
+ *
+ * head and tail are free running counters, only the producer writes head and
+ * only the consumer writes tail, so the release/acquire pairs below are all
+ * the synchronization there is.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : head(0), high_water(0), tail(0) {}
+
+    // Producer side. False if the queue is full.
+    bool push(const T &item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t used = h - tail.load(std::memory_order_acquire);
+        if (used == Capacity) {
+            return false;
+        }
+        items[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        if (used + 1 > high_water.load(std::memory_order_relaxed)) {
+            high_water.store(used + 1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side. False if the queue is empty.
+    bool pop(T &item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side, a snapshot that may be stale by the time it is used
+    size_t size() const {
+        return (size_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Deepest the queue has been, written by the producer
+    size_t max_depth() const { return high_water.load(std::memory_order_relaxed); }
+
+private:
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> high_water;
+    std::atomic<uint32_t> tail;
+    T items[Capacity];
+};
+
+#endif // SPSC_QUEUE_H
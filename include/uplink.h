@@ -0,0 +1,142 @@
+#ifndef UPLINK_H
+#define UPLINK_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "spsc_queue.h"
+
+/*
+ * Background prediction uplink.
+ *
+ * The report stage submit()s predictions into a fixed ring of compact binary
+ * records and never waits for the network. The uplink thread collects them
+ * into batches and hands each batch to the transport, which POSTs it to
+ * /api/predictions/batch over a kept-alive connection. A batch goes out when
+ * UPLINK_BATCH_MAX records are waiting or the oldest has waited
+ * UPLINK_FLUSH_MS. A batch that failed (no connection, 5xx) is retried, with
+ * backoff, before anything newer is sent; one the backend rejected (4xx)
+ * would fail the same way again, so it is dropped.
+ *
+ * Under backpressure (ring full), a prediction with the same label as the one
+ * held back before it is coalesced into it (count goes up, best confidence
+ * kept); a different label replaces it and the held one is dropped. Once the
+ * ring has drained, the uplink thread takes the held record itself, so the
+ * last prediction before the device goes quiet is sent too.
+ *
+ * Batch layout, little endian:
+ *   "WCB1", u8 version (1), u8 device id length, u8 label count, u8 record count,
+ *   u32 device ms at send time,
+ *   device id, then per label: u8 length + bytes,
+ *   per record (12 bytes): u32 sequence, u32 device ms, u16 confidence (x / 65535),
+ *   u8 label index, u8 count
+ *
+ * Like the pipeline this has no Arduino dependency, the platform supplies the
+ * transport and the thread (see src/main.cpp).
+ */
+
+#ifndef UPLINK_CAPACITY
+#define UPLINK_CAPACITY       32
+#endif
+#ifndef UPLINK_BATCH_MAX
+#define UPLINK_BATCH_MAX      16
+#endif
+#ifndef UPLINK_FLUSH_MS
+#define UPLINK_FLUSH_MS       1000
+#endif
+#define UPLINK_RETRY_MIN_MS   500
+#define UPLINK_RETRY_MAX_MS   8000
+
+#define UPLINK_BATCH_VERSION  1
+#define UPLINK_RECORD_SIZE    12
+
+struct UplinkRecord {
+    uint32_t sequence;
+    uint32_t device_ms;
+    uint16_t confidence;    // x / 65535
+    uint8_t label;
+    uint8_t count;          // predictions coalesced into this record
+};
+
+enum UplinkSendResult {
+    UPLINK_SENT,            // the backend took the batch
+    UPLINK_REJECTED,        // the backend refused the batch itself (4xx), do not send it again
+    UPLINK_FAILED,          // no answer or a server error, try again later
+};
+
+struct UplinkTransport {
+    // Send one batch
+    UplinkSendResult (*send)(void *user, const uint8_t *batch, size_t length);
+    // Nothing to send yet, should sleep a little
+    void (*idle)(void *user);
+    // Monotonic milliseconds
+    uint32_t (*now_ms)(void *user);
+    void *user;
+};
+
+struct UplinkStats {
+    uint32_t submitted;
+    uint32_t coalesced;
+    uint32_t dropped;           // records, including those of rejected batches
+    uint32_t sent;              // records, including coalesced ones
+    uint32_t batches;
+    uint32_t failures;          // failed send attempts
+    uint32_t max_depth;
+};
+
+class Uplink {
+public:
+    // labels must outlive the uplink; device_id and labels are cut to 255 bytes
+    Uplink(const UplinkTransport &transport, const char *device_id, const char *const *labels, uint8_t label_count);
+    ~Uplink();
+
+    // Producer side (one thread), never blocks
+    void submit(uint32_t sequence, uint32_t device_ms, int label, float confidence);
+
+    // Consumer side (one thread): send a batch if one is due. False if there was nothing to do.
+    bool flush_step();
+    // Thread body: flush until stop()
+    void run();
+    void stop() { running_ = false; }
+
+    UplinkStats stats() const;
+
+private:
+    Uplink(const Uplink &) = delete;
+    Uplink &operator=(const Uplink &) = delete;
+
+    size_t encode(uint32_t now);
+    bool claim_held(UplinkRecord &record);
+    void release_held(const UplinkRecord *record);
+    bool take_held(UplinkRecord &record);
+
+    UplinkTransport transport_;
+    SpscQueue<UplinkRecord, UPLINK_CAPACITY> ring_;
+
+    // the record held back while the ring is full. The producer writes it,
+    // the consumer may take it once the ring is empty. held_state_ is
+    // UPLINK_HELD | UPLINK_HELD_WRITING | a version in the bits above, so a
+    // take that raced with a write fails its compare and exchange
+    std::atomic<uint32_t> held_state_;
+    std::atomic<uint32_t> held_words_[3];
+
+    // consumer only: the batch being sent, kept until the backend takes it
+    UplinkRecord batch_[UPLINK_BATCH_MAX];
+    uint8_t batch_count_;
+    uint32_t oldest_ms_;
+    uint32_t retry_at_ms_;
+    uint32_t retry_delay_ms_;
+    uint8_t *buffer_;
+    size_t header_size_;
+
+    std::atomic<bool> running_;
+    std::atomic<uint32_t> submitted_;
+    std::atomic<uint32_t> coalesced_;
+    std::atomic<uint32_t> dropped_;
+    std::atomic<uint32_t> sent_;
+    std::atomic<uint32_t> batches_;
+    std::atomic<uint32_t> failures_;
+};
+
+#endif // UPLINK_H
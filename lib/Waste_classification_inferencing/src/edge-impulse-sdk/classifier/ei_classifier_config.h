@@ -95,6 +95,61 @@
     #define ESP_NN                                  1
 #endif
 
+// Vectorized int8 CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED and ADD
+// (tensorflow/lite/kernels/internal/optimized/integer_ops) in place of the
+// reference kernels, on hosts built for AVX2 (-mavx2) or 64-bit Arm with NEON.
+// Bit exact with the reference kernels.
+#ifndef EI_CLASSIFIER_TFLITE_ENABLE_SIMD
+    #if defined(__AVX2__) || (defined(__aarch64__) && defined(__ARM_NEON))
+        #define EI_CLASSIFIER_TFLITE_ENABLE_SIMD    1
+    #else
+        #define EI_CLASSIFIER_TFLITE_ENABLE_SIMD    0
+    #endif
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_SIMD
+
+// Workers that CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED and the fused
+// INVERTED_RESIDUAL split their output across (ei_parallel_run); 1 runs every
+// kernel on the calling thread
+#ifndef EI_CLASSIFIER_PARALLEL_WORKERS
+    #define EI_CLASSIFIER_PARALLEL_WORKERS          1
+#endif // EI_CLASSIFIER_PARALLEL_WORKERS
+
+// Images run_classifier_batch() runs through the model together, each on its
+// own copy of the model (one tensor arena per image), when no batch was opened
+// with run_classifier_open_batch()
+#ifndef EI_CLASSIFIER_BATCH_SIZE
+    #define EI_CLASSIFIER_BATCH_SIZE                4
+#endif // EI_CLASSIFIER_BATCH_SIZE
+
+// The EON model takes the op data of CONV_2D, DEPTHWISE_CONV_2D,
+// INVERTED_RESIDUAL, FULLY_CONNECTED, ADD and SOFTMAX (quantized multipliers
+// and shifts, padding, zero points) from constants in flash,
+// tflite-model/<model>_prepared.h, instead of working it out in init and
+// prepare into the tensor arena. Generic and ESP-NN kernels only.
+#ifndef EI_CLASSIFIER_PREPARED_OP_DATA
+    #define EI_CLASSIFIER_PREPARED_OP_DATA          0
+#endif // EI_CLASSIFIER_PREPARED_OP_DATA
+
+// Builds <model>_write_prepared(), which writes that header from a model that
+// went through init and prepare (benchmark/eon_prepare on the host)
+#ifndef EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+    #define EI_CLASSIFIER_PREPARED_OP_DATA_WRITER   0
+#endif // EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+
+// With the prepared op data, the filters of the CONV_2D and INVERTED_RESIDUAL
+// 1x1 convolutions that run on the ESP-NN kernels of the plain ESP32 come from
+// the header too, packed four output channels at a time with the input offset
+// folded into the bias (esp_nn_conv_packed.h). Costs a second copy of those
+// filters in flash. The writer always writes them, so one header serves both.
+#ifndef EI_CLASSIFIER_PREPACKED_WEIGHTS
+    #if EI_CLASSIFIER_PREPARED_OP_DATA && EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN == 1 && \
+        !defined(EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN_S3) && !defined(EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN_P4)
+        #define EI_CLASSIFIER_PREPACKED_WEIGHTS     1
+    #else
+        #define EI_CLASSIFIER_PREPACKED_WEIGHTS     0
+    #endif
+#endif // EI_CLASSIFIER_PREPACKED_WEIGHTS
+
 // no include checks in the compiler? then just include metadata and then ops_define (optional if on EON model)
 #ifndef __has_include
     #include "model-parameters/model_metadata.h"
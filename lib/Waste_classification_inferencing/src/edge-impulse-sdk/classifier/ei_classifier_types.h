@@ -229,6 +229,75 @@ typedef struct {
     int64_t anomaly_us;
 } ei_impulse_result_timing_t;
 
+/**
+ * @brief Totals of a `run_classifier_batch()` call.
+ *
+ * The per-image times are in the `timing` of every result; the model runs the
+ * images of a batch together, so each of them gets an equal share of its time.
+ */
+typedef struct {
+    /**
+     * Number of images classified
+     */
+    size_t images;
+
+    /**
+     * Wall clock time (in microseconds) of the whole call
+     */
+    int64_t total_us;
+
+    /**
+     * Sum (in microseconds) of the preprocessing (DSP) time of all images
+     */
+    int64_t dsp_us;
+
+    /**
+     * Sum (in microseconds) of the inference time of all images
+     */
+    int64_t classification_us;
+
+    /**
+     * Time (in microseconds) spent on post-processing the scores
+     */
+    int64_t postprocessing_us;
+
+    /**
+     * Images per second over `total_us`
+     */
+    float images_per_second;
+} ei_impulse_batch_timing_t;
+
+/**
+ * @brief Top-1 decision of `run_classifier_decide_quantized()`.
+ *
+ * Made on the quantized logits of the model (the input of its final softmax),
+ * which rank the labels as the probabilities do. The softmax only runs when the
+ * logits cannot tell whether the best label is above the threshold, or when the
+ * probabilities were asked for.
+ */
+typedef struct {
+    /**
+     * Index of the label with the highest score
+     */
+    int16_t label;
+
+    /**
+     * Whether the probability of `label` is above the threshold
+     */
+    bool above_threshold;
+
+    /**
+     * Whether the result holds the probabilities of every label
+     */
+    bool probabilities;
+
+    /**
+     * Quantized logit of `label` minus that of the second best label, 0 with a
+     * single label
+     */
+    int32_t margin;
+} ei_impulse_decision_t;
+
 /**
  * @brief Holds intermediate results of hr / hrv block
  *
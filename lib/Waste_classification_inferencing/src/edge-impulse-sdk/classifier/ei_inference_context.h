@@ -0,0 +1,219 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _EDGE_IMPULSE_INFERENCE_CONTEXT_H_
+#define _EDGE_IMPULSE_INFERENCE_CONTEXT_H_
+
+#include <new>
+#include <string.h>
+#include <type_traits>
+#include "model-parameters/model_metadata.h"
+#include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/dsp/memory.hpp"
+#include "edge-impulse-sdk/dsp/image/jpeg.hpp"
+#include "edge-impulse-sdk/dsp/image/processing.hpp"
+
+/**
+ * Compile-time sizes of an ei_inference_context_t. Define any of these before
+ * including the library to override them.
+ */
+
+// Output tensors of the learning block (classification has one)
+#ifndef EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS
+#if EI_CLASSIFIER_OBJECT_DETECTION == 1
+#define EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS     4
+#else
+#define EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS     1
+#endif
+#endif // EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS
+
+// Bytes for the values of all output tensors, enough to dequantize them to float
+#ifndef EI_INFERENCE_CONTEXT_OUTPUT_SIZE
+#define EI_INFERENCE_CONTEXT_OUTPUT_SIZE            (EI_CLASSIFIER_NN_OUTPUT_COUNT * sizeof(float))
+#endif
+
+// Widest image passed to run_classifier(), sizes the JPEG decoder and RGB565 row buffers
+#ifndef EI_INFERENCE_CONTEXT_MAX_IMAGE_WIDTH
+#define EI_INFERENCE_CONTEXT_MAX_IMAGE_WIDTH        640
+#endif
+
+// Scratch memory of the image DSP: the resize row buffers, plus either the JPEG
+// decoder or one RGB888 row expanded from RGB565
+#ifndef EI_INFERENCE_CONTEXT_SCRATCH_SIZE
+#define EI_INFERENCE_CONTEXT_SCRATCH_SIZE \
+    (EI_SCRATCH_ALIGN(ei::image::processing::ResizeQuantizer::max_buffer_size(EI_CLASSIFIER_INPUT_WIDTH, 3)) + \
+     ei::image::jpeg::max_decode_memory(EI_INFERENCE_CONTEXT_MAX_IMAGE_WIDTH, 3) + 2 * EI_SCRATCH_ALIGNMENT)
+#endif
+
+/**
+ * @brief Every buffer a run_classifier() call on an image needs, in one fixed
+ * block of memory sized at compile time from model_metadata.h
+ *
+ * Attach it to an impulse with run_classifier_set_context(). From then on,
+ * run_classifier() with an image_source_t takes the raw output array, the output
+ * tensors, the output matrices and the scratch memory of the image DSP (resize,
+ * JPEG decode) from the context instead of the heap. Together with an open
+ * session (run_classifier_open_session()) an inference does no heap operations
+ * at all. If something does not fit, the inference fails (EI_IMPULSE_DSP_ERROR
+ * or EI_IMPULSE_OUT_OF_MEMORY) and overflow_count() goes up; it never falls back
+ * to the heap.
+ *
+ * The object is large (see footprint()), give it static storage. One context
+ * serves one inference at a time.
+ */
+class ei_inference_context_t {
+public:
+    ei_inference_context_t()
+    {
+        memset(raw_outputs, 0, sizeof(raw_outputs));
+        memset(&scratch, 0, sizeof(scratch));
+        scratch.buffer = scratch_buffer;
+        scratch.size = sizeof(scratch_buffer);
+        output_used = 0;
+    }
+
+    /**
+     * @brief Bytes of memory the context occupies
+     */
+    static constexpr size_t footprint()
+    {
+        return sizeof(ei_inference_context_t);
+    }
+
+    /**
+     * @brief Most scratch memory a single inference has used so far,
+     * out of EI_INFERENCE_CONTEXT_SCRATCH_SIZE
+     */
+    size_t scratch_peak() const
+    {
+        return scratch.peak;
+    }
+
+    /**
+     * @brief Number of allocations that did not fit the context
+     */
+    uint32_t overflow_count() const
+    {
+        return scratch.failed;
+    }
+
+    /**
+     * @brief Empty the context and route the image DSP scratch allocations to it
+     */
+    void begin()
+    {
+        memset(raw_outputs, 0, sizeof(raw_outputs));
+        output_used = 0;
+        ei_scratch_install(&scratch);
+    }
+
+    /**
+     * @brief Route scratch allocations back to the heap
+     */
+    void end()
+    {
+        ei_scratch_install(nullptr);
+    }
+
+    /**
+     * @brief Construct the matrix for output tensor ix over context memory
+     *
+     * @tparam T matrix_t, matrix_i8_t or matrix_u8_t
+     * @return nullptr if it does not fit
+     */
+    template<typename T>
+    T *output_matrix(uint32_t ix, size_t cols)
+    {
+        typedef typename std::remove_pointer<decltype(T::buffer)>::type value_t;
+
+        size_t bytes = EI_SCRATCH_ALIGN(cols * sizeof(value_t));
+        if (ix >= EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS || bytes > sizeof(output_buffer) - output_used) {
+            scratch.failed++;
+            return nullptr;
+        }
+        value_t *values = reinterpret_cast<value_t*>(output_buffer + output_used);
+        output_used += bytes;
+        // the matrix does not own values, so it never has to be destructed
+        return ::new (&matrices[ix]) T(1, cols, values);
+    }
+
+    /**
+     * @brief True if matrix was handed out by output_matrix(), and must not be deleted
+     */
+    bool owns(const void *matrix) const
+    {
+        return matrix >= (const void*)&matrices[0] &&
+            matrix < (const void*)&matrices[EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS];
+    }
+
+    ei_feature_t raw_outputs[EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS];
+    TfLiteTensor output_tensors[EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS];
+
+private:
+    ei_inference_context_t(const ei_inference_context_t&) = delete;
+    ei_inference_context_t& operator=(const ei_inference_context_t&) = delete;
+
+    typename std::aligned_union<0, ei::matrix_t, ei::matrix_i8_t, ei::matrix_u8_t>::type
+        matrices[EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS];
+    alignas(EI_SCRATCH_ALIGNMENT) uint8_t output_buffer[EI_SCRATCH_ALIGN(EI_INFERENCE_CONTEXT_OUTPUT_SIZE)];
+    size_t output_used;
+    alignas(EI_SCRATCH_ALIGNMENT) uint8_t scratch_buffer[EI_INFERENCE_CONTEXT_SCRATCH_SIZE];
+    ei_scratch_arena_t scratch;
+};
+
+/**
+ * @brief Keeps a context (if any) active for the lifetime of the object
+ */
+class ei_inference_context_scope_t {
+public:
+    ei_inference_context_scope_t(ei_inference_context_t *context)
+        : context(context)
+    {
+        if (context) {
+            context->begin();
+        }
+    }
+
+    ~ei_inference_context_scope_t()
+    {
+        if (context) {
+            context->end();
+        }
+    }
+
+private:
+    ei_inference_context_t *context;
+};
+
+#endif // _EDGE_IMPULSE_INFERENCE_CONTEXT_H_
@@ -0,0 +1,291 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _EDGE_IMPULSE_MODEL_PROFILE_H_
+#define _EDGE_IMPULSE_MODEL_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+/**
+ * Per-operator profiling of EON compiled models.
+ *
+ * Off by default. Build with -DEI_CLASSIFIER_PROFILE_OPS=1 and the compiled
+ * graph records, for every node: the operator, its first input and output
+ * shape, the arena it took while being prepared, and the time (and CPU
+ * cycles, where there is a cycle counter) of every invoke. Times add up
+ * until the profile is reset; allocations are recorded again on every init.
+ * Read it with run_classifier_get_profile().
+ */
+#ifndef EI_CLASSIFIER_PROFILE_OPS
+#define EI_CLASSIFIER_PROFILE_OPS 0
+#endif
+
+#define EI_PROFILE_MAX_DIMS 4
+
+typedef struct {
+    const char *op;             // builtin operator, e.g. "CONV_2D"
+    uint16_t node;              // index in the graph
+    uint8_t input_dims_count;
+    uint8_t output_dims_count;
+    int32_t input_dims[EI_PROFILE_MAX_DIMS];
+    int32_t output_dims[EI_PROFILE_MAX_DIMS];
+    uint32_t persistent_bytes;  // arena taken by init and prepare, scratch buffers included
+    uint32_t scratch_bytes;     // of which scratch buffers
+    uint32_t runs;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint64_t total_cycles;      // 0 without a cycle counter
+} ei_node_profile_t;
+
+typedef struct {
+    const ei_node_profile_t *nodes;
+    size_t node_count;
+    uint32_t invokes;
+    size_t arena_size;          // tensor arena
+    size_t activation_bytes;    // arena planned for tensors
+    size_t persistent_bytes;    // arena taken by op data and scratch buffers
+    size_t overflow_bytes;      // persistent buffers that did not fit and went to the heap
+    size_t fast_arena_size;     // EI_TENSOR_ARENA_FAST_SIZE, 0 without a fast arena
+    size_t fast_arena_bytes;    // of which used by scratch buffers and tensors
+    uint64_t fast_access_bytes; // expected tensor bytes read and written per invoke in the fast arena
+    uint64_t slow_access_bytes; // and in the tensor arena
+    size_t staging_size;        // EI_WEIGHT_STAGING_SIZE, 0 without weight staging
+    uint64_t staged_nodes;      // nodes that ran on constants copied ahead of time, over all invokes
+    uint64_t staged_bytes;      // and the bytes copied for them
+    uint64_t staging_wait_us;   // time spent waiting for those copies
+} ei_model_profile_t;
+
+/**
+ * Free running CPU cycle counter, 0 where there is none. Only differences
+ * are meaningful, and only over less than one wrap.
+ */
+static inline uint32_t ei_profile_read_cycles(void) {
+#if defined(__XTENSA__)
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+typedef void (*ei_profile_write_fn)(void *user, const char *text);
+
+__attribute__((unused)) static int ei_profile_format_dims(char *buf, size_t size, const int32_t *dims, uint8_t count) {
+    int n = 0;
+    for (uint8_t ix = 0; ix < count && n < (int)size; ix++) {
+        n += snprintf(buf + n, size - n, ix ? "x%d" : "%d", (int)dims[ix]);
+    }
+    return n;
+}
+
+/**
+ * @brief      Write the profile as CSV, one line per node
+ *
+ * @param      profile  Profile from run_classifier_get_profile()
+ * @param      write    Called with every line
+ * @param      user     Passed to write
+ */
+__attribute__((unused)) static void ei_profile_write_csv(const ei_model_profile_t *profile,
+                                                         ei_profile_write_fn write,
+                                                         void *user) {
+    char line[192];
+    char input[48];
+    char output[48];
+
+    write(user, "node,op,input,output,persistent_bytes,scratch_bytes,runs,last_us,mean_us,max_us,mean_cycles\n");
+    for (size_t ix = 0; ix < profile->node_count; ix++) {
+        const ei_node_profile_t *n = &profile->nodes[ix];
+        uint32_t runs = n->runs ? n->runs : 1;
+        ei_profile_format_dims(input, sizeof(input), n->input_dims, n->input_dims_count);
+        ei_profile_format_dims(output, sizeof(output), n->output_dims, n->output_dims_count);
+        snprintf(line, sizeof(line), "%u,%s,%s,%s,%u,%u,%u,%u,%u,%u,%u\n",
+            (unsigned)n->node, n->op, input, output,
+            (unsigned)n->persistent_bytes, (unsigned)n->scratch_bytes, (unsigned)n->runs,
+            (unsigned)n->last_us, (unsigned)(n->total_us / runs), (unsigned)n->max_us,
+            (unsigned)(n->total_cycles / runs));
+        write(user, line);
+    }
+}
+
+/**
+ * @brief      Write a flame style summary: time per operator type, then the
+ *             slowest nodes, each with a bar for its share of the invoke,
+ *             then arena use
+ *
+ * @param      profile  Profile from run_classifier_get_profile()
+ * @param      write    Called with every line
+ * @param      user     Passed to write
+ */
+__attribute__((unused)) static void ei_profile_write_summary(const ei_model_profile_t *profile,
+                                                             ei_profile_write_fn write,
+                                                             void *user) {
+    const int bar_width = 30;
+    const size_t max_ops = 16;
+    const size_t top_nodes = 10;
+    char line[192];
+    char bar[32];
+
+    uint64_t total_us = 0;
+    const char *ops[max_ops];
+    uint64_t op_us[max_ops];
+    uint32_t op_nodes[max_ops];
+    size_t op_count = 0;
+
+    for (size_t ix = 0; ix < profile->node_count; ix++) {
+        const ei_node_profile_t *n = &profile->nodes[ix];
+        total_us += n->total_us;
+
+        size_t op = 0;
+        while (op < op_count && ops[op] != n->op) {
+            op++;
+        }
+        if (op == op_count) {
+            if (op_count == max_ops) {
+                continue;
+            }
+            ops[op] = n->op;
+            op_us[op] = 0;
+            op_nodes[op] = 0;
+            op_count++;
+        }
+        op_us[op] += n->total_us;
+        op_nodes[op]++;
+    }
+    if (total_us == 0) {
+        total_us = 1;
+    }
+    uint32_t invokes = profile->invokes ? profile->invokes : 1;
+
+    snprintf(line, sizeof(line), "%u invokes, %u us mean\n",
+        (unsigned)profile->invokes, (unsigned)(total_us / invokes));
+    write(user, line);
+
+    write(user, "By operator:\n");
+    bool listed[max_ops] = { false };
+    for (size_t rank = 0; rank < op_count; rank++) {
+        size_t best = op_count;
+        for (size_t op = 0; op < op_count; op++) {
+            if (!listed[op] && (best == op_count || op_us[op] > op_us[best])) {
+                best = op;
+            }
+        }
+        listed[best] = true;
+        int width = (int)(op_us[best] * bar_width / total_us);
+        for (int b = 0; b < bar_width; b++) {
+            bar[b] = b < width ? '#' : ' ';
+        }
+        bar[bar_width] = '\0';
+        snprintf(line, sizeof(line), "  %-20s %3u nodes %8u us %5.1f%% |%s|\n",
+            ops[best], (unsigned)op_nodes[best], (unsigned)(op_us[best] / invokes),
+            op_us[best] * 100.0 / total_us, bar);
+        write(user, line);
+    }
+
+    write(user, "Slowest nodes:\n");
+    size_t shown[top_nodes];
+    size_t shown_count = 0;
+    for (size_t rank = 0; rank < top_nodes && rank < profile->node_count; rank++) {
+        size_t best = profile->node_count;
+        for (size_t ix = 0; ix < profile->node_count; ix++) {
+            bool taken = false;
+            for (size_t s = 0; s < shown_count; s++) {
+                taken |= shown[s] == ix;
+            }
+            if (!taken && (best == profile->node_count || profile->nodes[ix].total_us > profile->nodes[best].total_us)) {
+                best = ix;
+            }
+        }
+        shown[shown_count++] = best;
+
+        const ei_node_profile_t *n = &profile->nodes[best];
+        char output[48];
+        ei_profile_format_dims(output, sizeof(output), n->output_dims, n->output_dims_count);
+        int width = (int)(n->total_us * bar_width / total_us);
+        for (int b = 0; b < bar_width; b++) {
+            bar[b] = b < width ? '#' : ' ';
+        }
+        bar[bar_width] = '\0';
+        snprintf(line, sizeof(line), "  #%-3u %-20s %-14s %6u us %5.1f%% |%s|\n",
+            (unsigned)n->node, n->op, output, (unsigned)(n->total_us / invokes),
+            n->total_us * 100.0 / total_us, bar);
+        write(user, line);
+    }
+
+    snprintf(line, sizeof(line), "Arena: %u bytes, %u tensors, %u op data and scratch, %u overflowed to the heap\n",
+        (unsigned)profile->arena_size, (unsigned)profile->activation_bytes,
+        (unsigned)profile->persistent_bytes, (unsigned)profile->overflow_bytes);
+    write(user, line);
+    if (profile->fast_arena_size) {
+        uint64_t access = profile->fast_access_bytes + profile->slow_access_bytes;
+        snprintf(line, sizeof(line), "Fast arena: %u of %u bytes, %u KB of %u KB tensor traffic per invoke (%.0f%%)\n",
+            (unsigned)profile->fast_arena_bytes, (unsigned)profile->fast_arena_size,
+            (unsigned)(profile->fast_access_bytes / 1024), (unsigned)(access / 1024),
+            access ? profile->fast_access_bytes * 100.0 / access : 0.0);
+        write(user, line);
+    }
+    if (profile->staging_size) {
+        snprintf(line, sizeof(line), "Weight staging: 2 x %u bytes, %u nodes and %u KB of constants per invoke, %u us waiting per invoke\n",
+            (unsigned)profile->staging_size, (unsigned)(profile->staged_nodes / invokes),
+            (unsigned)(profile->staged_bytes / invokes / 1024), (unsigned)(profile->staging_wait_us / invokes));
+        write(user, line);
+    }
+}
+
+__attribute__((unused)) static void ei_profile_printf(void *user, const char *text) {
+    (void)user;
+    ei_printf("%s", text);
+}
+
+/**
+ * @brief      Print the profile as CSV with ei_printf()
+ */
+__attribute__((unused)) static void ei_profile_print_csv(const ei_model_profile_t *profile) {
+    ei_profile_write_csv(profile, ei_profile_printf, nullptr);
+}
+
+/**
+ * @brief      Print the profile summary with ei_printf()
+ */
+__attribute__((unused)) static void ei_profile_print_summary(const ei_model_profile_t *profile) {
+    ei_profile_write_summary(profile, ei_profile_printf, nullptr);
+}
+
+#endif // _EDGE_IMPULSE_MODEL_PROFILE_H_
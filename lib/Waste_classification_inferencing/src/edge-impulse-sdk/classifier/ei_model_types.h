@@ -38,6 +38,7 @@
 #include <stdint.h>
 
 #include "edge-impulse-sdk/classifier/ei_classifier_types.h"
+#include "edge-impulse-sdk/classifier/ei_model_profile.h"
 #include "edge-impulse-sdk/dsp/ei_dsp_handle.h"
 #include "edge-impulse-sdk/dsp/numpy.hpp"
 #if EI_CLASSIFIER_USE_FULL_TFLITE || (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_AKIDA) || (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_MEMRYX)
@@ -125,6 +126,7 @@
 
 struct ei_impulse;
 class ei_impulse_handle_t;
+class ei_inference_context_t;
 
 typedef struct {
     uint16_t implementation_version;
@@ -304,6 +306,32 @@ typedef struct {
     TfLiteStatus (*model_reset)(void (*free)(void* ptr));
     TfLiteStatus (*model_input)(int, TfLiteTensor*);
     TfLiteStatus (*model_output)(int, TfLiteTensor*);
+    // type and quantization of an input, without setting the model up; nullptr
+    // when the model cannot do that
+    TfLiteStatus (*model_input_quantization)(int, TfLiteTensor*);
+    // independent copies of the model, for inference on several threads
+    TfLiteStatus (*model_instance_init)(void**, void*(*alloc_fnc)(size_t, size_t));
+    TfLiteStatus (*model_instance_invoke)(void*);
+    TfLiteStatus (*model_instance_invoke_batch)(void**, size_t);
+    TfLiteStatus (*model_instance_reset)(void*, void (*free)(void* ptr));
+    TfLiteStatus (*model_instance_input)(void*, int, TfLiteTensor*);
+    TfLiteStatus (*model_instance_output)(void*, int, TfLiteTensor*);
+    // the model up to the input of its final softmax (the logits), then the
+    // softmax alone, on an instance or on the model (nullptr); nullptr when
+    // the model does not end in a softmax
+    TfLiteStatus (*model_invoke_logits)(void*);
+    TfLiteStatus (*model_logits)(void*, TfLiteTensor*);
+    TfLiteStatus (*model_invoke_softmax)(void*);
+    // an inference run a few nodes at a time (start, then step until done),
+    // on an instance or on the model; nullptr when the model cannot do that
+    TfLiteStatus (*model_invoke_start)(void*, bool);
+    TfLiteStatus (*model_invoke_step)(void*, size_t, uint32_t, bool*);
+    TfLiteStatus (*model_invoke_abort)(void*);
+    TfLiteStatus (*model_invoke_completed)(void*, bool*);
+#if EI_CLASSIFIER_PROFILE_OPS
+    TfLiteStatus (*model_profile)(ei_model_profile_t*);
+    TfLiteStatus (*model_profile_reset)();
+#endif
 } ei_config_tflite_eon_graph_t;
 
 typedef struct {
@@ -474,6 +502,11 @@ public:
         : state(impulse)
         , impulse(impulse)
         , post_processing_state(nullptr)
+        , context(nullptr)
+        , model_instance(nullptr)
+        , batch_instances(nullptr)
+        , batch_size(0)
+        , session_open(false)
 #if EI_CLASSIFIER_FREEFORM_OUTPUT
         , freeform_outputs(nullptr)
 #endif //EI_CLASSIFIER_FREEFORM_OUTPUT
@@ -482,6 +515,11 @@ public:
     ei_impulse_state_t state;
     const ei_impulse_t *impulse;
     void** post_processing_state;
+    ei_inference_context_t *context; // buffers for image inference, nullptr to use the heap
+    void *model_instance; // own copy of the EON model, see run_classifier_open_instance()
+    void **batch_instances; // copies of the EON model, one per image, see run_classifier_open_batch()
+    size_t batch_size;
+    bool session_open; // the model stays set up between calls, see run_classifier_open_session()
 #if EI_CLASSIFIER_FREEFORM_OUTPUT == 1
     ei::matrix_t *freeform_outputs;
 #endif // EI_CLASSIFIER_FREEFORM_OUTPUT
@@ -40,6 +40,7 @@
 
 #include "ei_run_dsp.h"
 #include "ei_classifier_types.h"
+#include "ei_inference_context.h"
 #include "ei_signal_with_axes.h"
 #include "postprocessing/ei_postprocessing.h"
 #include "edge-impulse-sdk/classifier/ei_data_normalization.h"
@@ -158,7 +159,15 @@ extern "C" EI_IMPULSE_ERROR run_inference(
         }
 #endif
 
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+        // the graph of an open session is not set up and released around the call
+        EI_IMPULSE_ERROR res = block.infer_fn == run_nn_inference ?
+            run_nn_inference_session(impulse, fmatrix, ix, (uint32_t*)block.input_block_ids, block.input_block_ids_size, result, block.config,
+                handle->session_open, debug) :
+            block.infer_fn(impulse, fmatrix, ix, (uint32_t*)block.input_block_ids, block.input_block_ids_size, result, block.config, debug);
+#else
         EI_IMPULSE_ERROR res = block.infer_fn(impulse, fmatrix, ix, (uint32_t*)block.input_block_ids, block.input_block_ids_size, result, block.config, debug);
+#endif
         if (res != EI_IMPULSE_OK) {
             return res;
         }
@@ -182,25 +191,14 @@ extern "C" EI_IMPULSE_ERROR run_inference(
 }
 
 /**
- * @brief      Process a complete impulse
+ * @brief      Clear a result struct and point it at the classification slots
  *
- * @param      impulse  struct with information about model and DSP
- * @param      signal   Sample data
+ * @param      handle   struct with information about model and DSP
  * @param      result   Output classifier results
- * @param      handle   Handle from open_impulse. nullptr for backward compatibility
- * @param[in]  debug    Debug output enable
- *
- * @return     The ei impulse error.
  */
-extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
-                                            signal_t *signal,
-                                            ei_impulse_result_t *result,
-                                            bool debug = false)
+static void init_impulse_result(ei_impulse_handle_t *handle, ei_impulse_result_t *result)
 {
-    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (signal  == nullptr)) {
-        return EI_IMPULSE_INFERENCE_ERROR;
-    }
-
+    (void)handle; // only the heap allocated classification slots need it
     memset(result, 0, sizeof(ei_impulse_result_t));
 
 #if EI_IMPULSE_RESULT_CLASSIFICATION_IS_STATICALLY_ALLOCATED == 0
@@ -230,6 +228,29 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
 
     result->classification = classification_results.data();
 #endif // EI_IMPULSE_RESULT_CLASSIFICATION_IS_STATICALLY_ALLOCATED == 0
+}
+
+/**
+ * @brief      Process a complete impulse
+ *
+ * @param      impulse  struct with information about model and DSP
+ * @param      signal   Sample data
+ * @param      result   Output classifier results
+ * @param      handle   Handle from open_impulse. nullptr for backward compatibility
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
+                                            signal_t *signal,
+                                            ei_impulse_result_t *result,
+                                            bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (signal  == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+    init_impulse_result(handle, result);
 
     uint8_t num_results = handle->impulse->output_tensors_size;
 
@@ -242,7 +263,12 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
     // Shortcut for quantized image models
     ei_learning_block_t block = handle->impulse->learning_blocks[0];
     if (can_run_classifier_image_quantized(handle->impulse, block) == EI_IMPULSE_OK) {
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+        EI_IMPULSE_ERROR res = run_nn_inference_image_quantized_session(handle->impulse, signal, 0, result, block.config,
+            handle->session_open, debug);
+#else
         EI_IMPULSE_ERROR res = run_classifier_image_quantized(handle->impulse, signal, result, debug);
+#endif
         if (res != EI_IMPULSE_OK) {
             return res;
         }
@@ -407,6 +433,199 @@ extern "C" EI_IMPULSE_ERROR init_impulse(ei_impulse_handle_t *handle) {
     return EI_IMPULSE_OK;
 }
 
+/**
+ * @brief      Keep the compiled graphs of an impulse initialized between calls
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR open_impulse_session(ei_impulse_handle_t *handle) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (handle->session_open) {
+        return EI_IMPULSE_OK;
+    }
+    const ei_impulse_t *impulse = handle->impulse;
+    for (size_t ix = 0; ix < impulse->learning_blocks_size; ix++) {
+        ei_learning_block_t block = impulse->learning_blocks[ix];
+        if (block.infer_fn != run_nn_inference) {
+            continue;
+        }
+        EI_IMPULSE_ERROR res = run_nn_open_session(block.config);
+        if (res != EI_IMPULSE_OK) {
+            // release the blocks opened so far
+            for (size_t open_ix = 0; open_ix < ix; open_ix++) {
+                if (impulse->learning_blocks[open_ix].infer_fn == run_nn_inference) {
+                    run_nn_close_session(impulse->learning_blocks[open_ix].config);
+                }
+            }
+            return res;
+        }
+    }
+    handle->session_open = true;
+#endif
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Release the compiled graphs kept alive by open_impulse_session()
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR close_impulse_session(ei_impulse_handle_t *handle) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+    EI_IMPULSE_ERROR res = EI_IMPULSE_OK;
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (!handle->session_open) {
+        return EI_IMPULSE_OK;
+    }
+    handle->session_open = false;
+    const ei_impulse_t *impulse = handle->impulse;
+    for (size_t ix = 0; ix < impulse->learning_blocks_size; ix++) {
+        ei_learning_block_t block = impulse->learning_blocks[ix];
+        if (block.infer_fn != run_nn_inference) {
+            continue;
+        }
+        // keep going so every block gets released
+        EI_IMPULSE_ERROR block_res = run_nn_close_session(block.config);
+        if (block_res != EI_IMPULSE_OK) {
+            res = block_res;
+        }
+    }
+#endif
+    return res;
+}
+
+/**
+ * @brief      Give a handle its own copy of the compiled graph
+ *
+ * Image inferences on the handle (process_impulse_image(),
+ * process_impulse_quantized()) then run on that copy, so handles with an
+ * instance each can classify at the same time on different threads.
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR open_impulse_instance(ei_impulse_handle_t *handle) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (handle->model_instance) {
+        return EI_IMPULSE_OK;
+    }
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    return run_nn_open_instance(block.config, &handle->model_instance);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Release the copy of the graph from open_impulse_instance()
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR close_impulse_instance(ei_impulse_handle_t *handle) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    EI_IMPULSE_ERROR res = run_nn_close_instance(handle->impulse->learning_blocks[0].config, handle->model_instance);
+    handle->model_instance = nullptr;
+    return res;
+#else
+    return EI_IMPULSE_OK;
+#endif
+}
+
+/**
+ * @brief      Release the copies of the graph from open_impulse_batch()
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR close_impulse_batch(ei_impulse_handle_t *handle) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+    EI_IMPULSE_ERROR res = EI_IMPULSE_OK;
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    for (size_t ix = 0; ix < handle->batch_size; ix++) {
+        EI_IMPULSE_ERROR instance_res = run_nn_close_instance(handle->impulse->learning_blocks[0].config,
+            handle->batch_instances[ix]);
+        if (instance_res != EI_IMPULSE_OK) {
+            res = instance_res;
+        }
+    }
+#endif
+    ei_free(handle->batch_instances);
+    handle->batch_instances = nullptr;
+    handle->batch_size = 0;
+    return res;
+}
+
+/**
+ * @brief      Give a handle size copies of the compiled graph, for batches
+ *             of up to size images (process_impulse_batch())
+ *
+ * @param      handle  struct with information about model and DSP
+ * @param      size    Images per batch
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR open_impulse_batch(ei_impulse_handle_t *handle, size_t size) {
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (size == 0) {
+        return EI_IMPULSE_INVALID_SIZE;
+    }
+    if (handle->batch_size == size) {
+        return EI_IMPULSE_OK;
+    }
+    close_impulse_batch(handle);
+
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    handle->batch_instances = (void**)ei_calloc(size, sizeof(void*));
+    if (!handle->batch_instances) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+    handle->batch_size = size;
+    for (size_t ix = 0; ix < size; ix++) {
+        res = run_nn_open_instance(block.config, &handle->batch_instances[ix]);
+        if (res != EI_IMPULSE_OK) {
+            close_impulse_batch(handle);
+            return res;
+        }
+    }
+    return EI_IMPULSE_OK;
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
 /**
  * @brief      Process a complete impulse for continuous inference
  *
@@ -624,78 +843,589 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(ei_impulse_handle_t *hand
     return ei_impulse_error;
 }
 
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
 /**
- * Check if the current impulse could be used by 'run_classifier_image_quantized'
+ * Point result->_raw_outputs at the output features of one call, those of
+ * context or new ones owned by raw_results_ptr, all cleared
  */
-__attribute__((unused)) static EI_IMPULSE_ERROR can_run_classifier_image_quantized(const ei_impulse_t *impulse, ei_learning_block_t block_ptr) {
+static EI_IMPULSE_ERROR init_impulse_raw_outputs(ei_impulse_handle_t *handle,
+                                                 ei_inference_context_t *context,
+                                                 std::unique_ptr<ei_feature_t[]> &raw_results_ptr,
+                                                 ei_impulse_result_t *result)
+{
+    uint8_t num_results = handle->impulse->output_tensors_size;
 
-    if (impulse->inferencing_engine != EI_CLASSIFIER_TFLITE
-        && impulse->inferencing_engine != EI_CLASSIFIER_TENSAIFLOW
-        && impulse->inferencing_engine != EI_CLASSIFIER_DRPAI
-        && impulse->inferencing_engine != EI_CLASSIFIER_ONNX_TIDL
-        && impulse->inferencing_engine != EI_CLASSIFIER_ATON) // check later
-    {
-        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    if (context) {
+        if (num_results > EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS) {
+            return EI_IMPULSE_OUT_OF_MEMORY;
+        }
+        result->_raw_outputs = context->raw_outputs;
+    }
+    else {
+        raw_results_ptr.reset(new ei_feature_t[num_results]);
+        result->_raw_outputs = raw_results_ptr.get();
     }
+    memset(result->_raw_outputs, 0, sizeof(ei_feature_t) * num_results);
+    return EI_IMPULSE_OK;
+}
 
-    // visual anomaly also needs to go through the normal path
-    if (impulse->has_anomaly){
-        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+/**
+ * Run the model and postprocessing over an image, or over features that
+ * process_impulse_quantize_image() produced (image is nullptr then)
+ */
+static EI_IMPULSE_ERROR process_impulse_image_quantized(ei_impulse_handle_t *handle,
+                                                        const image_source_t *image,
+                                                        const int8_t *features,
+                                                        ei_impulse_result_t *result,
+                                                        bool debug)
+{
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
     }
 
-        // Check if we have tflite graph
-    if (block_ptr.infer_fn != run_nn_inference) {
-        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    init_impulse_result(handle, result);
+
+    // with a context all buffers of this call come from it, see run_classifier_set_context()
+    ei_inference_context_t *context = handle->context;
+    ei_inference_context_scope_t context_scope(context);
+    std::unique_ptr<ei_feature_t[]> raw_results_ptr;
+    res = init_impulse_raw_outputs(handle, context, raw_results_ptr, result);
+    if (res != EI_IMPULSE_OK) {
+        return res;
     }
 
-    // Check if we have a quantized NN Input layer (input is always quantized for DRP-AI)
-    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)block_ptr.config;
-    if (block_config->quantized != 1) {
-        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    if (features) {
+        res = run_nn_inference_quantized_features(handle->impulse, features, 0, result, block.config, context,
+            handle->model_instance, handle->session_open, debug);
+    }
+    else {
+        res = run_nn_inference_image_source(handle->impulse, image, 0, result, block.config, context,
+            handle->model_instance, handle->session_open, debug);
     }
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    return run_postprocessing(handle, result);
+}
+#endif
 
-    // And if we have one DSP block which operates on images...
-    if (impulse->dsp_blocks_size != 1 || impulse->dsp_blocks[0].extract_fn != extract_image_features) {
-        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+/**
+ * @brief      Process a complete impulse on a raw 8-bit image
+ *
+ * @param      handle   struct with information about model and DSP
+ * @param      image    Image, cropped and resized to the input size of the impulse when needed
+ * @param      result   Output classifier results
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_image(ei_impulse_handle_t *handle,
+                                                  const image_source_t *image,
+                                                  ei_impulse_result_t *result,
+                                                  bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (image  == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
     }
 
-    return EI_IMPULSE_OK;
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    return process_impulse_image_quantized(handle, image, nullptr, result, debug);
+#else
+    // raw images are only quantized directly into EON compiled int8 models
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
 }
 
-#if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_ONNX_TIDL || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_ATON)
-
 /**
- * Special function to run the classifier on images, only works on TFLite models (either interpreter, EON, tensaiflow, drpai, tidl, memryx)
- * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
- * returns EI_IMPULSE_OK.
+ * @brief      Run only the DSP of an image impulse: crop, resize and quantize
+ *             a raw 8-bit image into the input features of the model
+ *
+ * @param      handle         struct with information about model and DSP
+ * @param      image          Image, cropped and resized to the input size of the impulse when needed
+ * @param      features       Receives EI_CLASSIFIER_NN_INPUT_FRAME_SIZE quantized features
+ * @param      features_size  Size of features in bytes
+ * @param      context        Scratch memory of the DSP, nullptr for the heap. Not the context
+ *                            attached to handle if an inference can run at the same time
+ * @param[out] dsp_us         DSP time, can be nullptr
+ *
+ * @return     The ei impulse error.
  */
-extern "C" EI_IMPULSE_ERROR run_classifier_image_quantized(
-    const ei_impulse_t *impulse,
-    signal_t *signal,
-    ei_impulse_result_t *result,
-    bool debug = false)
+extern "C" EI_IMPULSE_ERROR process_impulse_quantize_image(ei_impulse_handle_t *handle,
+                                                           const image_source_t *image,
+                                                           int8_t *features,
+                                                           size_t features_size,
+                                                           ei_inference_context_t *context,
+                                                           uint64_t *dsp_us)
 {
-    return run_nn_inference_image_quantized(impulse, signal, 0, result, impulse->learning_blocks[0].config, debug);
-}
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (image  == nullptr) || (features == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
 
-#endif // #if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI)
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    if (features_size != handle->impulse->nn_input_frame_size) {
+        return EI_IMPULSE_INVALID_SIZE;
+    }
+    return run_nn_quantize_image(handle->impulse, image, features, block.config, context, handle->model_instance,
+        handle->session_open, dsp_us);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
 
-#if EI_CLASSIFIER_LOAD_IMAGE_SCALING
-static const float torch_mean[] = { 0.485, 0.456, 0.406 };
-static const float torch_std[] = { 0.229, 0.224, 0.225 };
-// This is ordered BGR
-static const float tao_mean[] = { 103.939, 116.779, 123.68 };
+/**
+ * @brief      Run the model and postprocessing over features from
+ *             process_impulse_quantize_image()
+ *
+ * @param      handle         struct with information about model and DSP
+ * @param      features       Quantized input features
+ * @param      features_size  Size of features in bytes
+ * @param      result         Output classifier results, timing.dsp_us only covers copying the features
+ * @param[in]  debug          Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_quantized(ei_impulse_handle_t *handle,
+                                                      const int8_t *features,
+                                                      size_t features_size,
+                                                      ei_impulse_result_t *result,
+                                                      bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (features == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
 
-EI_IMPULSE_ERROR ei_scale_fmatrix(ei_learning_block_t *block, ei::matrix_t *fmatrix) {
-    if (block->image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
-        // @todo; could we write some faster vector math here?
-        for (size_t ix = 0; ix < fmatrix->rows * fmatrix->cols; ix += 3) {
-            fmatrix->buffer[ix + 0] = (fmatrix->buffer[ix + 0] - torch_mean[0]) / torch_std[0];
-            fmatrix->buffer[ix + 1] = (fmatrix->buffer[ix + 1] - torch_mean[1]) / torch_std[1];
-            fmatrix->buffer[ix + 2] = (fmatrix->buffer[ix + 2] - torch_mean[2]) / torch_std[2];
-        }
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (features_size != handle->impulse->nn_input_frame_size) {
+        return EI_IMPULSE_INVALID_SIZE;
     }
-    else if (block->image_scaling == EI_CLASSIFIER_IMAGE_SCALING_0_255) {
+    return process_impulse_image_quantized(handle, nullptr, features, result, debug);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Decide on the top label of features that
+ *             process_impulse_quantize_image() produced, on the quantized
+ *             logits of the model, see run_nn_decide_quantized_features()
+ *
+ * @param      handle         struct with information about model and DSP
+ * @param      features       Quantized input features
+ * @param      features_size  Size of features in bytes
+ * @param      threshold      Probability the top label has to be above
+ * @param      probabilities  Also fill result when the top label is above threshold
+ * @param      decision       Output decision
+ * @param      result         Output timing, and classifier results when decision->probabilities
+ * @param[in]  debug          Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_decide_quantized(ei_impulse_handle_t *handle,
+                                                             const int8_t *features,
+                                                             size_t features_size,
+                                                             float threshold,
+                                                             bool probabilities,
+                                                             ei_impulse_decision_t *decision,
+                                                             ei_impulse_result_t *result,
+                                                             bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (features == nullptr) ||
+        (decision == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (features_size != handle->impulse->nn_input_frame_size) {
+        return EI_IMPULSE_INVALID_SIZE;
+    }
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    if (handle->impulse->postprocessing_blocks_size != 1 ||
+        handle->impulse->postprocessing_blocks[0].postprocess_fn != &process_classification_i8) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    init_impulse_result(handle, result);
+
+    ei_inference_context_t *context = handle->context;
+    ei_inference_context_scope_t context_scope(context);
+    std::unique_ptr<ei_feature_t[]> raw_results_ptr;
+    res = init_impulse_raw_outputs(handle, context, raw_results_ptr, result);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    res = run_nn_decide_quantized_features(handle->impulse, features, threshold, probabilities, 0, decision, result,
+        block.config, context, handle->model_instance, handle->session_open, debug);
+    if (res != EI_IMPULSE_OK || !decision->probabilities) {
+        return res;
+    }
+    return run_postprocessing(handle, result);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Start an inference over features that
+ *             process_impulse_quantize_image() produced, which
+ *             process_impulse_step() then runs a few layers at a time, see
+ *             run_nn_start_quantized_features()
+ *
+ * @param      handle         struct with information about model and DSP, with an
+ *                            open session or instance
+ * @param      features       Quantized input features, copied into the model
+ * @param      features_size  Size of features in bytes
+ * @param      result         Output classifier results, timing.dsp_us only covers copying the features
+ * @param[in]  debug          Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_start_quantized(ei_impulse_handle_t *handle,
+                                                            const int8_t *features,
+                                                            size_t features_size,
+                                                            ei_impulse_result_t *result,
+                                                            bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (features == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (features_size != handle->impulse->nn_input_frame_size) {
+        return EI_IMPULSE_INVALID_SIZE;
+    }
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    init_impulse_result(handle, result);
+
+    return run_nn_start_quantized_features(handle->impulse, features, result, block.config, handle->model_instance,
+        handle->session_open, debug);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Run the next layers of the inference process_impulse_start_quantized()
+ *             started, see run_nn_step()
+ *
+ * @param      handle     struct with information about model and DSP
+ * @param      max_nodes  Most layers to run, 0 for no limit
+ * @param      budget_us  No new layer once this much time has gone by, 0 for no limit
+ * @param[out] done       Whether the model has run to the end
+ * @param      result     The result of process_impulse_start_quantized(), timing adds up
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_step(ei_impulse_handle_t *handle,
+                                                 size_t max_nodes,
+                                                 uint32_t budget_us,
+                                                 bool *done,
+                                                 ei_impulse_result_t *result)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (done == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    return run_nn_step(max_nodes, budget_us, done, result, handle->impulse->learning_blocks[0].config,
+        handle->model_instance);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Once process_impulse_step() is done: the outputs and the
+ *             postprocessing, as from process_impulse_quantized()
+ *
+ * @param      handle  struct with information about model and DSP
+ * @param      result  The result of the steps, output classifier results
+ * @param[in]  debug   Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_finish_quantized(ei_impulse_handle_t *handle,
+                                                             ei_impulse_result_t *result,
+                                                             bool debug = false)
+{
+    (void)debug; // the steps have run already, nothing left to print
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    ei_inference_context_t *context = handle->context;
+    ei_inference_context_scope_t context_scope(context);
+    std::unique_ptr<ei_feature_t[]> raw_results_ptr;
+    EI_IMPULSE_ERROR res = init_impulse_raw_outputs(handle, context, raw_results_ptr, result);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    res = run_nn_finish_quantized(0, result, handle->impulse->learning_blocks[0].config, context,
+        handle->model_instance);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    return run_postprocessing(handle, result);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Once process_impulse_step() is done: decide on the top label as
+ *             process_impulse_decide_quantized() does
+ *
+ * @param      handle         struct with information about model and DSP
+ * @param      threshold      Probability the top label has to be above
+ * @param      probabilities  Also fill result when the top label is above threshold
+ * @param      decision       Output decision
+ * @param      result         The result of the steps, classifier results when decision->probabilities
+ * @param[in]  debug          Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_finish_decide_quantized(ei_impulse_handle_t *handle,
+                                                                    float threshold,
+                                                                    bool probabilities,
+                                                                    ei_impulse_decision_t *decision,
+                                                                    ei_impulse_result_t *result,
+                                                                    bool debug = false)
+{
+    (void)debug; // the steps have run already, nothing left to print
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (result  == nullptr) || (decision == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    if (handle->impulse->postprocessing_blocks_size != 1 ||
+        handle->impulse->postprocessing_blocks[0].postprocess_fn != &process_classification_i8) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    ei_inference_context_t *context = handle->context;
+    ei_inference_context_scope_t context_scope(context);
+    std::unique_ptr<ei_feature_t[]> raw_results_ptr;
+    EI_IMPULSE_ERROR res = init_impulse_raw_outputs(handle, context, raw_results_ptr, result);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    res = run_nn_finish_decide_quantized(handle->impulse, threshold, probabilities, 0, decision, result,
+        handle->impulse->learning_blocks[0].config, context, handle->model_instance);
+    if (res != EI_IMPULSE_OK || !decision->probabilities) {
+        return res;
+    }
+    return run_postprocessing(handle, result);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Drop the inference process_impulse_step() is working through
+ *
+ * @param      handle  struct with information about model and DSP
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_abort(ei_impulse_handle_t *handle)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    return run_nn_abort(handle->impulse->learning_blocks[0].config, handle->model_instance);
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * @brief      Process a complete impulse over count images at once, from
+ *             signals or from images (the other one is nullptr)
+ *
+ * The images run in batches of the size of open_impulse_batch(), or of up to
+ * EI_CLASSIFIER_BATCH_SIZE when no batch is open. Scores are those of
+ * process_impulse() / process_impulse_image() on every image alone.
+ *
+ * @param      handle   struct with information about model and DSP
+ * @param      signals  count signals, or nullptr
+ * @param      images   count images, or nullptr
+ * @param      count    Number of images
+ * @param      results  count output classifier results
+ * @param[out] timing   Totals of the call, can be nullptr
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_batch(ei_impulse_handle_t *handle,
+                                                  signal_t *signals,
+                                                  const image_source_t *images,
+                                                  size_t count,
+                                                  ei_impulse_result_t *results,
+                                                  ei_impulse_batch_timing_t *timing,
+                                                  bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse  == nullptr) || (results  == nullptr) ||
+        ((signals == nullptr) == (images == nullptr))) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    ei_learning_block_t block = handle->impulse->learning_blocks[0];
+    EI_IMPULSE_ERROR res = can_run_classifier_image_quantized(handle->impulse, block);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    const uint64_t start_us = ei_read_timer_us();
+    ei_impulse_batch_timing_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    // without a batch of the caller, one for this call only
+    const bool own_batch = (handle->batch_size == 0);
+    if (own_batch && count > 0) {
+        res = open_impulse_batch(handle, count < EI_CLASSIFIER_BATCH_SIZE ? count : EI_CLASSIFIER_BATCH_SIZE);
+        if (res != EI_IMPULSE_OK) {
+            return res;
+        }
+    }
+
+    const uint8_t num_results = handle->impulse->output_tensors_size;
+    std::unique_ptr<ei_feature_t[]> raw_results_ptr(new ei_feature_t[num_results * handle->batch_size]);
+
+    for (size_t first = 0; first < count && res == EI_IMPULSE_OK; first += handle->batch_size) {
+        const size_t n = (count - first) < handle->batch_size ? (count - first) : handle->batch_size;
+        memset(raw_results_ptr.get(), 0, sizeof(ei_feature_t) * num_results * n);
+        for (size_t ix = 0; ix < n; ix++) {
+            init_impulse_result(handle, &results[first + ix]);
+            results[first + ix]._raw_outputs = &raw_results_ptr[ix * num_results];
+        }
+
+        res = run_nn_inference_batch(handle->impulse, signals ? &signals[first] : nullptr,
+            images ? &images[first] : nullptr, n, &results[first], block.config,
+            handle->batch_instances, debug);
+
+        const uint64_t postprocessing_start_us = ei_read_timer_us();
+        for (size_t ix = 0; ix < n && res == EI_IMPULSE_OK; ix++) {
+            res = run_postprocessing(handle, &results[first + ix]);
+            // the raw outputs only live until the next batch
+            results[first + ix]._raw_outputs = nullptr;
+            totals.dsp_us += results[first + ix].timing.dsp_us;
+            totals.classification_us += results[first + ix].timing.classification_us;
+        }
+        totals.postprocessing_us += ei_read_timer_us() - postprocessing_start_us;
+        if (res == EI_IMPULSE_OK) {
+            totals.images += n;
+        }
+    }
+
+    if (own_batch) {
+        close_impulse_batch(handle);
+    }
+
+    totals.total_us = ei_read_timer_us() - start_us;
+    totals.images_per_second = totals.total_us > 0 ? (float)totals.images * 1000000.0f / (float)totals.total_us : 0.0f;
+    if (timing) {
+        *timing = totals;
+    }
+    return res;
+#else
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+#endif
+}
+
+/**
+ * Check if the current impulse could be used by 'run_classifier_image_quantized'
+ */
+__attribute__((unused)) static EI_IMPULSE_ERROR can_run_classifier_image_quantized(const ei_impulse_t *impulse, ei_learning_block_t block_ptr) {
+
+    if (impulse->inferencing_engine != EI_CLASSIFIER_TFLITE
+        && impulse->inferencing_engine != EI_CLASSIFIER_TENSAIFLOW
+        && impulse->inferencing_engine != EI_CLASSIFIER_DRPAI
+        && impulse->inferencing_engine != EI_CLASSIFIER_ONNX_TIDL
+        && impulse->inferencing_engine != EI_CLASSIFIER_ATON) // check later
+    {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    // visual anomaly also needs to go through the normal path
+    if (impulse->has_anomaly){
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+        // Check if we have tflite graph
+    if (block_ptr.infer_fn != run_nn_inference) {
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+    // Check if we have a quantized NN Input layer (input is always quantized for DRP-AI)
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)block_ptr.config;
+    if (block_config->quantized != 1) {
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+    // And if we have one DSP block which operates on images...
+    if (impulse->dsp_blocks_size != 1 || impulse->dsp_blocks[0].extract_fn != extract_image_features) {
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+    return EI_IMPULSE_OK;
+}
+
+#if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_ONNX_TIDL || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_ATON)
+
+/**
+ * Special function to run the classifier on images, only works on TFLite models (either interpreter, EON, tensaiflow, drpai, tidl, memryx)
+ * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
+ * returns EI_IMPULSE_OK.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_image_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return run_nn_inference_image_quantized(impulse, signal, 0, result, impulse->learning_blocks[0].config, debug);
+}
+
+#endif // #if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI)
+
+#if EI_CLASSIFIER_LOAD_IMAGE_SCALING
+static const float torch_mean[] = { 0.485, 0.456, 0.406 };
+static const float torch_std[] = { 0.229, 0.224, 0.225 };
+// This is ordered BGR
+static const float tao_mean[] = { 103.939, 116.779, 123.68 };
+
+EI_IMPULSE_ERROR ei_scale_fmatrix(ei_learning_block_t *block, ei::matrix_t *fmatrix) {
+    if (block->image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+        // @todo; could we write some faster vector math here?
+        for (size_t ix = 0; ix < fmatrix->rows * fmatrix->cols; ix += 3) {
+            fmatrix->buffer[ix + 0] = (fmatrix->buffer[ix + 0] - torch_mean[0]) / torch_std[0];
+            fmatrix->buffer[ix + 1] = (fmatrix->buffer[ix + 1] - torch_mean[1]) / torch_std[1];
+            fmatrix->buffer[ix + 2] = (fmatrix->buffer[ix + 2] - torch_mean[2]) / torch_std[2];
+        }
+    }
+    else if (block->image_scaling == EI_CLASSIFIER_IMAGE_SCALING_0_255) {
         int scale_res = numpy::scale(fmatrix, 255.0f);
         if (scale_res != EIDSP_OK) {
             ei_printf("ERR: Failed to scale matrix (%d)\n", scale_res);
@@ -873,43 +1603,204 @@ __attribute__((unused)) void run_classifier_deinit(ei_impulse_handle_t *handle)
 }
 
 /**
- * @brief Run preprocessing (DSP) on new slice of raw features. Add output features
- *  to rolling matrix and run inference on full sample.
- *
- * Accepts a new slice of features give by the callback defined in the `signal` parameter.
- * It performs preprocessing (DSP) on this new slice of features and appends the output to
- * a sliding window of pre-processed features (stored in a static features matrix). The matrix
- * stores the new slice and as many old slices as necessary to make up one full sample for
- * performing inference.
- *
- * `run_classifier_init()` must be called before making any calls to
- * `run_classifier_continuous().`
- *
- * For example, if you are doing keyword spotting on 1-second slices of audio and you want to
- * perform inference 4 times per second (given by `EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW`), you
- * would collect 0.25 seconds of audio and call run_classifier_continuous(). The function would
- * compute the Mel-Frequency Cepstral Coefficients (MFCCs) for that 0.25 second slice of audio,
- * drop the oldest 0.25 seconds' worth of MFCCs from its internal matrix, and append the newest
- * slice of MFCCs. This process allows the library to keep track of the pre-processed features
- * (e.g. MFCCs) in the window instead of the entire set of raw features (e.g. raw audio data),
- * which can potentially save a lot of space in RAM. After updating the static matrix,
- * inference is performed using the whole matrix, which acts as a sliding window of
- * pre-processed features.
+ * @brief Initialize the model once and keep it resident between inferences.
  *
- * Additionally, a moving average filter (MAF) can be enabled for `run_classifier_continuous()`,
- * which averages (arithmetic mean) the last *n* inference results for each class. *n* is
- * `EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW / 2`. In our example above, if we enabled the MAF, the
- * values in `result` would contain predictions averaged from the previous 2 inferences.
+ * By default every call to `run_classifier()` allocates the tensor arena, prepares
+ * every operator, runs the model and frees the arena again. After this call the
+ * arena and the prepared operators stay alive, so subsequent calls only quantize
+ * the input and invoke the graph. Results are identical to the default path.
  *
- * To learn more about `run_classifier_continuous()`, see
- * [this guide](https://docs.edgeimpulse.com/docs/tutorials/advanced-inferencing/continuous-audio-sampling)
- * on continuous audio sampling. While the guide is written for audio signals, the concepts of continuous sampling and inference can be extrapolated to any time-series data.
+ * Only has an effect on EON compiled models; a no-op otherwise.
  *
  * **Blocking**: yes
  *
- * **Example**: [nano_ble33_sense_microphone_continuous.ino](https://github.com/edgeimpulse/example-lacuna-ls200/blob/main/nano_ble33_sense_microphone_continous/nano_ble33_sense_microphone_continuous.ino)
- *
- * @param[in] signal  Pointer to a signal_t struct that contains the number of elements in the
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_OK`
+ *  if the model was initialized successfully.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_open_session(void)
+{
+    return open_impulse_session(&ei_default_impulse);
+}
+
+/**
+ * @brief Initialize the model once and keep it resident between inferences.
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_open_session(ei_impulse_handle_t *handle)
+{
+    return open_impulse_session(handle);
+}
+
+/**
+ * @brief Release the model kept resident by `run_classifier_open_session()`.
+ *
+ * Frees the tensor arena. Later calls to `run_classifier()` fall back to
+ * initializing and releasing the model on every call.
+ *
+ * **Blocking**: yes
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_close_session(void)
+{
+    return close_impulse_session(&ei_default_impulse);
+}
+
+/**
+ * @brief Release the model kept resident by `run_classifier_open_session()`.
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_close_session(ei_impulse_handle_t *handle)
+{
+    return close_impulse_session(handle);
+}
+
+/**
+ * @brief Give a handle its own copy of the model, for inference on several threads.
+ *
+ * Sets up an arena and the op data of every operator for `handle` alone; image
+ * inferences on it (`run_classifier()` with an `image_source_t`,
+ * `run_classifier_quantize_image()`, `run_classifier_quantized()`) use that copy.
+ * Each thread then classifies on its own handle, made with
+ * `ei_impulse_handle_t handle(&impulse)` and, for heap-free inference, its own
+ * context (`run_classifier_set_context()`). Costs one tensor arena per handle.
+ * Only EON compiled int8 image models.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_open_instance(ei_impulse_handle_t *handle)
+{
+    return open_impulse_instance(handle);
+}
+
+/**
+ * @brief Release the copy of the model from `run_classifier_open_instance()`.
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_close_instance(ei_impulse_handle_t *handle)
+{
+    return close_impulse_instance(handle);
+}
+
+/**
+ * @brief Give a handle copies of the model for `run_classifier_batch()` batches of `size` images.
+ *
+ * Without an open batch, every `run_classifier_batch()` call sets up and releases
+ * copies for up to `EI_CLASSIFIER_BATCH_SIZE` images itself. Costs one tensor arena
+ * per image. Only EON compiled int8 image models.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in]   handle struct with information about model and DSP
+ * @param[in]   size Images per batch
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_open_batch(ei_impulse_handle_t *handle, size_t size)
+{
+    return open_impulse_batch(handle, size);
+}
+
+/**
+ * @brief Release the copies of the model from `run_classifier_open_batch()`.
+ *
+ * @param[in]   handle struct with information about model and DSP
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_close_batch(ei_impulse_handle_t *handle)
+{
+    return close_impulse_batch(handle);
+}
+
+/**
+ * @brief Take the buffers of image inferences from a fixed context instead of the heap.
+ *
+ * After this call, `run_classifier()` with an `image_source_t` uses the raw output
+ * array, output tensors, output matrices and DSP scratch memory of `context`. With
+ * an open session (`run_classifier_open_session()`) an inference then does no heap
+ * operations at all. See `ei_inference_context_t` for the sizes.
+ *
+ * **Blocking**: no
+ *
+ * @param[in]   context Context to use, must stay valid while attached. nullptr to go back to the heap.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_set_context(ei_inference_context_t *context)
+{
+    ei_default_impulse.context = context;
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief Take the buffers of image inferences from a fixed context instead of the heap.
+ *
+ * @param[in]   handle struct with information about model and DSP
+ * @param[in]   context Context to use, nullptr to go back to the heap.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_set_context(ei_impulse_handle_t *handle, ei_inference_context_t *context)
+{
+    if (!handle) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+    handle->context = context;
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief Run preprocessing (DSP) on new slice of raw features. Add output features
+ *  to rolling matrix and run inference on full sample.
+ *
+ * Accepts a new slice of features give by the callback defined in the `signal` parameter.
+ * It performs preprocessing (DSP) on this new slice of features and appends the output to
+ * a sliding window of pre-processed features (stored in a static features matrix). The matrix
+ * stores the new slice and as many old slices as necessary to make up one full sample for
+ * performing inference.
+ *
+ * `run_classifier_init()` must be called before making any calls to
+ * `run_classifier_continuous().`
+ *
+ * For example, if you are doing keyword spotting on 1-second slices of audio and you want to
+ * perform inference 4 times per second (given by `EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW`), you
+ * would collect 0.25 seconds of audio and call run_classifier_continuous(). The function would
+ * compute the Mel-Frequency Cepstral Coefficients (MFCCs) for that 0.25 second slice of audio,
+ * drop the oldest 0.25 seconds' worth of MFCCs from its internal matrix, and append the newest
+ * slice of MFCCs. This process allows the library to keep track of the pre-processed features
+ * (e.g. MFCCs) in the window instead of the entire set of raw features (e.g. raw audio data),
+ * which can potentially save a lot of space in RAM. After updating the static matrix,
+ * inference is performed using the whole matrix, which acts as a sliding window of
+ * pre-processed features.
+ *
+ * Additionally, a moving average filter (MAF) can be enabled for `run_classifier_continuous()`,
+ * which averages (arithmetic mean) the last *n* inference results for each class. *n* is
+ * `EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW / 2`. In our example above, if we enabled the MAF, the
+ * values in `result` would contain predictions averaged from the previous 2 inferences.
+ *
+ * To learn more about `run_classifier_continuous()`, see
+ * [this guide](https://docs.edgeimpulse.com/docs/tutorials/advanced-inferencing/continuous-audio-sampling)
+ * on continuous audio sampling. While the guide is written for audio signals, the concepts of continuous sampling and inference can be extrapolated to any time-series data.
+ *
+ * **Blocking**: yes
+ *
+ * **Example**: [nano_ble33_sense_microphone_continuous.ino](https://github.com/edgeimpulse/example-lacuna-ls200/blob/main/nano_ble33_sense_microphone_continous/nano_ble33_sense_microphone_continuous.ino)
+ *
+ * @param[in] signal  Pointer to a signal_t struct that contains the number of elements in the
  *  slice of raw features (e.g. `EI_CLASSIFIER_SLICE_SIZE`) and a pointer to a callback that reads
  *  in the slice of raw features.
  * @param[out] result Pointer to an `ei_impulse_result_t` struct that contains the various output
@@ -1051,6 +1942,580 @@ __attribute__((unused)) EI_IMPULSE_ERROR run_classifier(
     return process_impulse(impulse, signal, result, debug);
 }
 
+/**
+ * @brief Run the classifier over a raw 8-bit image.
+ *
+ * Overloaded function [run_classifier()](#run_classifier-1) that defaults to the single impulse.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] image Pointer to an `image_source_t` struct that describes an RGB888, RGB565,
+ *  grayscale or JPEG buffer. Frames of another size than the impulse input are cropped and
+ *  resized on the fly, row by row.
+ * @param[out] result  Pointer to an ei_impulse_result_t struct that will contain the various output
+ *  results from inference after `run_classifier()` returns.
+ * @param[in] debug Print internal preprocessing and inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_OK` if inference
+ *  completed successfully.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier(
+    const image_source_t *image,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_image(&ei_default_impulse, image, result, debug);
+}
+
+/**
+ * @brief Run the classifier over a raw 8-bit image.
+ *
+ * Pixels are quantized straight from `image` into the input tensor of the model, without
+ * the float pages that a `signal_t` callback goes through. Only available for quantized
+ * (int8) image models compiled with EON; returns `EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE`
+ * or `EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES` otherwise.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ * @param[in] image Pointer to an `image_source_t` struct that describes an RGB888, RGB565,
+ *  grayscale or JPEG buffer. Frames of another size than the impulse input are cropped and
+ *  resized on the fly, row by row.
+ * @param[out] result  Pointer to an ei_impulse_result_t struct that will contain the various output
+ *  results from inference after `run_classifier()` returns.
+ * @param[in] debug Print internal preprocessing and inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_OK` if inference
+ *  completed successfully.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier(
+    ei_impulse_handle_t *impulse,
+    const image_source_t *image,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_image(impulse, image, result, debug);
+}
+
+/**
+ * @brief Run the classifier over several raw 8-bit images at once.
+ *
+ * The images go through the model together, layer by layer, so the weights of a
+ * layer are read once per batch instead of once per image; with
+ * `EI_CLASSIFIER_PARALLEL_WORKERS` above 1 the images of a batch are spread over
+ * the workers. Batches are as large as `run_classifier_open_batch()` set, or
+ * `EI_CLASSIFIER_BATCH_SIZE`. Every result holds the same scores as
+ * `run_classifier()` on that image alone. Only EON compiled int8 image models.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ * @param[in] images `count` images, as for `run_classifier()`.
+ * @param[out] results `count` results.
+ * @param[in] count Number of images.
+ * @param[out] timing Images per second and time per stage of the call, can be nullptr.
+ * @param[in] debug Print internal preprocessing and inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_batch(
+    ei_impulse_handle_t *impulse,
+    const image_source_t *images,
+    ei_impulse_result_t *results,
+    size_t count,
+    ei_impulse_batch_timing_t *timing = nullptr,
+    bool debug = false)
+{
+    return process_impulse_batch(impulse, nullptr, images, count, results, timing, debug);
+}
+
+/**
+ * @brief Run the classifier over several raw 8-bit images at once.
+ *
+ * Overloaded function [run_classifier_batch()](#run_classifier_batch) that defaults to the single impulse.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_batch(
+    const image_source_t *images,
+    ei_impulse_result_t *results,
+    size_t count,
+    ei_impulse_batch_timing_t *timing = nullptr,
+    bool debug = false)
+{
+    return process_impulse_batch(&ei_default_impulse, nullptr, images, count, results, timing, debug);
+}
+
+/**
+ * @brief Run the classifier over several signals at once.
+ *
+ * As the `image_source_t` overload, for image impulses fed through a `signal_t`.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_batch(
+    ei_impulse_handle_t *impulse,
+    signal_t *signals,
+    ei_impulse_result_t *results,
+    size_t count,
+    ei_impulse_batch_timing_t *timing = nullptr,
+    bool debug = false)
+{
+    return process_impulse_batch(impulse, signals, nullptr, count, results, timing, debug);
+}
+
+/**
+ * @brief Run the classifier over several signals at once.
+ *
+ * Overloaded function [run_classifier_batch()](#run_classifier_batch) that defaults to the single impulse.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_batch(
+    signal_t *signals,
+    ei_impulse_result_t *results,
+    size_t count,
+    ei_impulse_batch_timing_t *timing = nullptr,
+    bool debug = false)
+{
+    return process_impulse_batch(&ei_default_impulse, signals, nullptr, count, results, timing, debug);
+}
+
+/**
+ * @brief Run only the preprocessing of the classifier: crop, resize and quantize a raw
+ * 8-bit image into the input features of the model.
+ *
+ * Together with `run_classifier_quantized()` this splits `run_classifier()` in two, so
+ * the next frame can be decoded on one core while the model runs on another. The input
+ * tensor is not touched; `features` belongs to the caller. EON compiled models read the
+ * input quantization from constant data, so this never touches the model and can run
+ * while another thread sets it up, invokes or releases it. Other models are initialized
+ * for every call unless a session is open (`run_classifier_open_session()`).
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] image Pointer to an `image_source_t` struct that describes an RGB888, RGB565,
+ *  grayscale or JPEG buffer.
+ * @param[out] features Buffer of `EI_CLASSIFIER_NN_INPUT_FRAME_SIZE` bytes.
+ * @param[in] features_size Size of `features` in bytes.
+ * @param[in] context Context for the scratch memory of the DSP, or nullptr for the heap. Must
+ *  not be the context attached with `run_classifier_set_context()` while an inference runs.
+ * @param[out] dsp_us Time spent, can be nullptr.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_quantize_image(
+    const image_source_t *image,
+    int8_t *features,
+    size_t features_size,
+    ei_inference_context_t *context,
+    uint64_t *dsp_us)
+{
+    return process_impulse_quantize_image(&ei_default_impulse, image, features, features_size, context, dsp_us);
+}
+
+/**
+ * @brief Run only the preprocessing of the classifier, see
+ * [run_classifier_quantize_image()](#run_classifier_quantize_image).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_quantize_image(
+    ei_impulse_handle_t *impulse,
+    const image_source_t *image,
+    int8_t *features,
+    size_t features_size,
+    ei_inference_context_t *context,
+    uint64_t *dsp_us)
+{
+    return process_impulse_quantize_image(impulse, image, features, features_size, context, dsp_us);
+}
+
+/**
+ * @brief Run the model over features from `run_classifier_quantize_image()`.
+ *
+ * The features are copied into the input tensor first, so the buffer can be refilled
+ * as soon as this returns. Buffers come from the context attached with
+ * `run_classifier_set_context()`, as for `run_classifier()` with an image.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] features Quantized input features.
+ * @param[in] features_size Size of `features` in bytes, `EI_CLASSIFIER_NN_INPUT_FRAME_SIZE`.
+ * @param[out] result Pointer to an ei_impulse_result_t struct that will contain the various output
+ *  results from inference after `run_classifier_quantized()` returns. `timing.dsp_us` only
+ *  covers copying the features.
+ * @param[in] debug Print internal inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_OK` if inference
+ *  completed successfully.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_quantized(
+    const int8_t *features,
+    size_t features_size,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_quantized(&ei_default_impulse, features, features_size, result, debug);
+}
+
+/**
+ * @brief Run the model over features from `run_classifier_quantize_image()`, see
+ * [run_classifier_quantized()](#run_classifier_quantized).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_quantized(
+    ei_impulse_handle_t *impulse,
+    const int8_t *features,
+    size_t features_size,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_quantized(impulse, features, features_size, result, debug);
+}
+
+/**
+ * @brief Decide whether the top label of features from `run_classifier_quantize_image()`
+ * is above a probability threshold, without the float probabilities.
+ *
+ * The model runs as far as the input of its final softmax, the logits, which rank
+ * the labels as the probabilities do. The margin between the two best quantized logits
+ * settles most frames against the threshold, which is mapped into the quantized
+ * domain once per call. The softmax only runs for the frames close to the threshold,
+ * and, with `probabilities`, for the frames above it; then `result` holds the
+ * probabilities of every label, as from `run_classifier_quantized()`. Only for
+ * classifiers with int8 outputs.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] features Quantized input features.
+ * @param[in] features_size Size of `features` in bytes, `EI_CLASSIFIER_NN_INPUT_FRAME_SIZE`.
+ * @param[in] threshold Probability that the top label has to be above.
+ * @param[in] probabilities Fill `result` with the probabilities when the top label is
+ *  above `threshold`.
+ * @param[out] decision The top label, whether it is above `threshold` and whether
+ *  `result` holds the probabilities.
+ * @param[out] result Timing, and the probabilities when `decision->probabilities`.
+ * @param[in] debug Print internal inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_decide_quantized(
+    const int8_t *features,
+    size_t features_size,
+    float threshold,
+    bool probabilities,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_decide_quantized(&ei_default_impulse, features, features_size, threshold, probabilities,
+        decision, result, debug);
+}
+
+/**
+ * @brief Decide on the top label of features from `run_classifier_quantize_image()`, see
+ * [run_classifier_decide_quantized()](#run_classifier_decide_quantized).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_decide_quantized(
+    ei_impulse_handle_t *impulse,
+    const int8_t *features,
+    size_t features_size,
+    float threshold,
+    bool probabilities,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_decide_quantized(impulse, features, features_size, threshold, probabilities, decision,
+        result, debug);
+}
+
+/**
+ * @brief Start classifying features from `run_classifier_quantize_image()` a few
+ * layers at a time.
+ *
+ * `run_classifier_step()` then runs the model in slices, of a number of layers or of
+ * a time budget, and picks up where the last slice stopped; between the slices the
+ * caller is free to do other work, or to drop the frame with `run_classifier_abort()`.
+ * Once a step reports `done`, `run_classifier_finish_quantized()` gives the results of
+ * `run_classifier_quantized()` and `run_classifier_finish_decide_quantized()` the
+ * decision of `run_classifier_decide_quantized()`. The model has to stay set up
+ * between the calls: open a session first (`run_classifier_open_session()`). Nothing
+ * else may run on the model until the inference is finished or aborted; starting
+ * another one drops it.
+ *
+ * **Blocking**: only to copy the features
+ *
+ * @param[in] features Quantized input features, copied into the model.
+ * @param[in] features_size Size of `features` in bytes, `EI_CLASSIFIER_NN_INPUT_FRAME_SIZE`.
+ * @param[out] result Passed on to every step and to the finish call. `timing.dsp_us` only
+ *  covers copying the features, `timing.classification_us` adds up over the steps.
+ * @param[in] debug Print internal inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. `EI_IMPULSE_INFERENCE_ERROR`
+ *  without an open session.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_start_quantized(
+    const int8_t *features,
+    size_t features_size,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_start_quantized(&ei_default_impulse, features, features_size, result, debug);
+}
+
+/**
+ * @brief Start classifying features a few layers at a time, see
+ * [run_classifier_start_quantized()](#run_classifier_start_quantized).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information, with an open session or instance.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_start_quantized(
+    ei_impulse_handle_t *impulse,
+    const int8_t *features,
+    size_t features_size,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_start_quantized(impulse, features, features_size, result, debug);
+}
+
+/**
+ * @brief Run the next layers of the inference `run_classifier_start_quantized()` started.
+ *
+ * At least one layer runs. A layer is never split, so a step can take longer than
+ * `budget_us` by the time of its last layer. A canceled impulse drops the inference.
+ *
+ * **Blocking**: for the layers of this step
+ *
+ * @param[in] max_nodes Most layers to run, 0 for no limit.
+ * @param[in] budget_us No new layer starts once this much time has gone by, 0 for no limit.
+ * @param[out] done Whether the model has run to the end; then finish it.
+ * @param[in,out] result The result passed to `run_classifier_start_quantized()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_step(
+    size_t max_nodes,
+    uint32_t budget_us,
+    bool *done,
+    ei_impulse_result_t *result)
+{
+    return process_impulse_step(&ei_default_impulse, max_nodes, budget_us, done, result);
+}
+
+/**
+ * @brief Run the next layers of a stepped inference, see
+ * [run_classifier_step()](#run_classifier_step).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_step(
+    ei_impulse_handle_t *impulse,
+    size_t max_nodes,
+    uint32_t budget_us,
+    bool *done,
+    ei_impulse_result_t *result)
+{
+    return process_impulse_step(impulse, max_nodes, budget_us, done, result);
+}
+
+/**
+ * @brief Finish a stepped inference once `run_classifier_step()` is done: the results
+ * of `run_classifier_quantized()` on the same features.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in,out] result The result passed to the steps, gets the classifier results.
+ * @param[in] debug Print internal inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. `EI_IMPULSE_INFERENCE_ERROR`
+ *  when no stepped inference is done: still stepping, aborted or never started.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_finish_quantized(
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_finish_quantized(&ei_default_impulse, result, debug);
+}
+
+/**
+ * @brief Finish a stepped inference, see
+ * [run_classifier_finish_quantized()](#run_classifier_finish_quantized).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_finish_quantized(
+    ei_impulse_handle_t *impulse,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_finish_quantized(impulse, result, debug);
+}
+
+/**
+ * @brief Finish a stepped inference once `run_classifier_step()` is done with the
+ * decision of `run_classifier_decide_quantized()` on the same features.
+ *
+ * The steps stop at the logits, so the softmax only runs here when the decision
+ * needs it.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] threshold Probability that the top label has to be above.
+ * @param[in] probabilities Fill `result` with the probabilities when the top label is
+ *  above `threshold`.
+ * @param[out] decision The top label, whether it is above `threshold` and whether
+ *  `result` holds the probabilities.
+ * @param[in,out] result The result passed to the steps, gets the probabilities when
+ *  `decision->probabilities`.
+ * @param[in] debug Print internal inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. `EI_IMPULSE_INFERENCE_ERROR`
+ *  when no stepped inference is done: still stepping, aborted or never started.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_finish_decide_quantized(
+    float threshold,
+    bool probabilities,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_finish_decide_quantized(&ei_default_impulse, threshold, probabilities, decision, result,
+        debug);
+}
+
+/**
+ * @brief Finish a stepped inference with a decision, see
+ * [run_classifier_finish_decide_quantized()](#run_classifier_finish_decide_quantized).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_finish_decide_quantized(
+    ei_impulse_handle_t *impulse,
+    float threshold,
+    bool probabilities,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return process_impulse_finish_decide_quantized(impulse, threshold, probabilities, decision, result, debug);
+}
+
+/**
+ * @brief Drop the inference `run_classifier_step()` is working through, for instance
+ * because its frame went stale. The model is free for the next one.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_abort(void)
+{
+    return process_impulse_abort(&ei_default_impulse);
+}
+
+/**
+ * @brief Drop a stepped inference, see [run_classifier_abort()](#run_classifier_abort).
+ *
+ * @param[in] impulse Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_abort(ei_impulse_handle_t *impulse)
+{
+    return process_impulse_abort(impulse);
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+/**
+ * @brief      Read or clear the per-operator profile of the EON compiled
+ *             learning block of an impulse
+ *
+ * @param      handle   struct with information about model and DSP
+ * @param      profile  Receives the profile, nullptr to clear it instead
+ *
+ * @return     The ei impulse error.
+ */
+__attribute__((unused)) static EI_IMPULSE_ERROR process_impulse_profile(ei_impulse_handle_t *handle,
+                                                                        ei_model_profile_t *profile)
+{
+    if ((handle == nullptr) || (handle->impulse == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    for (size_t ix = 0; ix < handle->impulse->learning_blocks_size; ix++) {
+        const ei_learning_block_t &block = handle->impulse->learning_blocks[ix];
+        if (block.infer_fn != run_nn_inference) {
+            continue;
+        }
+        const ei_learning_block_config_tflite_graph_t *config = (const ei_learning_block_config_tflite_graph_t *)block.config;
+        const ei_config_tflite_eon_graph_t *graph = (const ei_config_tflite_eon_graph_t *)config->graph_config;
+        if (!graph->model_profile || !graph->model_profile_reset) {
+            break;
+        }
+        TfLiteStatus status = profile ? graph->model_profile(profile) : graph->model_profile_reset();
+        return status == kTfLiteOk ? EI_IMPULSE_OK : EI_IMPULSE_TFLITE_ERROR;
+    }
+#endif
+    return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+}
+
+/**
+ * @brief Per-operator profile of the model, when built with `EI_CLASSIFIER_PROFILE_OPS=1`.
+ *
+ * For every node of the EON compiled graph: operator, first input and output shape,
+ * arena taken while preparing it, and the time and CPU cycles of its invokes since the
+ * last `run_classifier_reset_profile()`. Print it with `ei_profile_print_summary()` or
+ * `ei_profile_print_csv()`, or write it elsewhere with `ei_profile_write_summary()` /
+ * `ei_profile_write_csv()`. The table is updated in place by the next inference.
+ *
+ * @param[out] profile Receives the profile.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum,
+ *  `EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE` for models that are not EON compiled.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_get_profile(ei_model_profile_t *profile)
+{
+    if (profile == nullptr) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+    return process_impulse_profile(&ei_default_impulse, profile);
+}
+
+/**
+ * @brief Clear the times of the per-operator profile, see
+ * [run_classifier_get_profile()](#run_classifier_get_profile).
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum.
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_reset_profile(void)
+{
+    return process_impulse_profile(&ei_default_impulse, nullptr);
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
+
 #if EI_CLASSIFIER_FREEFORM_OUTPUT
 /**
  * Set the location for freeform outputs. For impulses with freeform output the application needs to allocate
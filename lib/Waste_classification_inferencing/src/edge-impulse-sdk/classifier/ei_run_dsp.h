@@ -40,7 +40,16 @@
 #include "edge-impulse-sdk/dsp/speechpy/speechpy.hpp"
 #include "edge-impulse-sdk/classifier/ei_signal_with_range.h"
 #include "edge-impulse-sdk/dsp/ei_flatten.h"
+#include "edge-impulse-sdk/dsp/image/processing.hpp"
+#include "edge-impulse-sdk/dsp/image/jpeg.hpp"
 #include "model-parameters/model_metadata.h"
+#include <atomic>
+
+// filter used when an image_source_t has to be resized to the model input,
+// 0 = bilinear, 1 = area (box filter, better for large downscale factors)
+#ifndef EI_DSP_IMAGE_RESIZE_INTERPOLATION
+#define EI_DSP_IMAGE_RESIZE_INTERPOLATION 0
+#endif
 
 #if EI_CLASSIFIER_HR_ENABLED
 #if EI_CLASSIFIER_HR_LIB
@@ -1262,20 +1271,167 @@ __attribute__((unused)) int extract_drpai_features_quantized(signal_t *signal, m
 
 #if (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_DRPAI)
 
+/**
+ * Quantize one pixel into the model input. Writes 3 values for RGB models or
+ * 1 value for grayscale models, and returns the next output position.
+ */
+static inline int8_t *quantize_image_pixel(int32_t r, int32_t g, int32_t b, int16_t channel_count, bool fast_path,
+                                           float scale, float zero_point, int image_scaling, int8_t *out) {
+    static const int32_t iRedToGray = (int32_t)(0.299f * 65536.0f);
+    static const int32_t iGreenToGray = (int32_t)(0.587f * 65536.0f);
+    static const int32_t iBlueToGray = (int32_t)(0.114f * 65536.0f);
+
+    static const float torch_mean[] = { 0.485, 0.456, 0.406 };
+    static const float torch_std[] = { 0.229, 0.224, 0.225 };
+
+    if (fast_path) {
+        if (channel_count == 3) {
+            *out++ = static_cast<int8_t>(r + zero_point);
+            *out++ = static_cast<int8_t>(g + zero_point);
+            *out++ = static_cast<int8_t>(b + zero_point);
+        }
+        else {
+            // ITU-R 601-2 luma transform
+            // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+            int32_t gray = (iRedToGray * r) + (iGreenToGray * g) + (iBlueToGray * b);
+            gray >>= 16; // scale down to int8_t
+            gray += zero_point;
+            if (gray < - 128) gray = -128;
+            else if (gray > 127) gray = 127;
+            *out++ = static_cast<int8_t>(gray);
+        }
+        return out;
+    }
+
+    float fr = static_cast<float>(r);
+    float fg = static_cast<float>(g);
+    float fb = static_cast<float>(b);
+
+    if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+        fr /= 255.0f;
+        fg /= 255.0f;
+        fb /= 255.0f;
+    }
+    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+        fr /= 255.0f;
+        fg /= 255.0f;
+        fb /= 255.0f;
+
+        fr = (fr - torch_mean[0]) / torch_std[0];
+        fg = (fg - torch_mean[1]) / torch_std[1];
+        fb = (fb - torch_mean[2]) / torch_std[2];
+    }
+    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
+        fr -= 128.0f;
+        fg -= 128.0f;
+        fb -= 128.0f;
+    }
+
+    if (channel_count == 3) {
+        *out++ = static_cast<int8_t>(round(fr / scale) + zero_point);
+        *out++ = static_cast<int8_t>(round(fg / scale) + zero_point);
+        *out++ = static_cast<int8_t>(round(fb / scale) + zero_point);
+    }
+    else {
+        // ITU-R 601-2 luma transform
+        // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+        float v = (0.299f * fr) + (0.587f * fg) + (0.114f * fb);
+        *out++ = static_cast<int8_t>(round(v / scale) + zero_point);
+    }
+    return out;
+}
+
+/**
+ * quantize_image_pixel() of every 8-bit value for one scale, zero point and
+ * image scaling, so pixels are quantized with table lookups
+ */
+typedef struct {
+    float scale;
+    float zero_point;
+    int image_scaling;
+    int8_t rgb[256 * 3]; // RGB models, rgb[channel * 256 + value]
+    int8_t gray[256]; // grayscale models fed grayscale pixels
+    bool rgb_is_offset; // rgb[c * 256 + v] == v - 128 for every entry
+    bool gray_is_offset;
+} ei_image_quantize_lut_t;
+
+// tables of the first parameters quantized with (the model input's), built
+// once by whichever thread gets there first: 0 empty, 1 building, 2 ready
+static ei_image_quantize_lut_t image_quantize_lut;
+static std::atomic<int> image_quantize_lut_state(0);
+
+static void build_image_quantize_lut(float scale, float zero_point, int image_scaling, bool fast_path,
+                                     ei_image_quantize_lut_t *lut) {
+    lut->scale = scale;
+    lut->zero_point = zero_point;
+    lut->image_scaling = image_scaling;
+    lut->rgb_is_offset = true;
+    lut->gray_is_offset = true;
+    for (int v = 0; v < 256; v++) {
+        int8_t q[3];
+        quantize_image_pixel(v, v, v, 3, fast_path, scale, zero_point, image_scaling, q);
+        quantize_image_pixel(v, v, v, 1, fast_path, scale, zero_point, image_scaling, &lut->gray[v]);
+        for (int c = 0; c < 3; c++) {
+            lut->rgb[c * 256 + v] = q[c];
+            lut->rgb_is_offset &= q[c] == (int8_t)(v - 128);
+        }
+        lut->gray_is_offset &= lut->gray[v] == (int8_t)(v - 128);
+    }
+}
+
+/**
+ * Tables for these parameters, nullptr when out of memory. The model input's
+ * are built on the first frame and kept; any other set is built for this call
+ * into scratch memory. Hand the result back to release_image_quantize_lut().
+ */
+static const ei_image_quantize_lut_t *get_image_quantize_lut(float scale, float zero_point, int image_scaling,
+                                                             bool fast_path) {
+    int state = image_quantize_lut_state.load(std::memory_order_acquire);
+    if (state == 2) {
+        if (image_quantize_lut.scale == scale && image_quantize_lut.zero_point == zero_point &&
+            image_quantize_lut.image_scaling == image_scaling) {
+            return &image_quantize_lut;
+        }
+    }
+    else if (state == 0 && image_quantize_lut_state.compare_exchange_strong(state, 1, std::memory_order_acquire)) {
+        build_image_quantize_lut(scale, zero_point, image_scaling, fast_path, &image_quantize_lut);
+        image_quantize_lut_state.store(2, std::memory_order_release);
+        return &image_quantize_lut;
+    }
+
+    ei_image_quantize_lut_t *lut = (ei_image_quantize_lut_t*)ei_scratch_malloc(sizeof(ei_image_quantize_lut_t));
+    if (lut) {
+        build_image_quantize_lut(scale, zero_point, image_scaling, fast_path, lut);
+    }
+    return lut;
+}
+
+static void release_image_quantize_lut(const ei_image_quantize_lut_t *lut) {
+    if (lut != &image_quantize_lut) {
+        ei_scratch_free((void*)lut);
+    }
+}
+
 __attribute__((unused)) int extract_image_features_quantized(signal_t *signal, matrix_i8_t *output_matrix, void *config_ptr, float scale, float zero_point, const float frequency,
                                                              int image_scaling) {
     ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
 
     int16_t channel_count = strcmp(config.channels, "Grayscale") == 0 ? 1 : 3;
 
-    size_t output_ix = 0;
+    // input scaled 0..1 with zero point -128 maps every pixel byte onto an int8 without rounding
+    const bool fast_path = scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE;
 
-    const int32_t iRedToGray = (int32_t)(0.299f * 65536.0f);
-    const int32_t iGreenToGray = (int32_t)(0.587f * 65536.0f);
-    const int32_t iBlueToGray = (int32_t)(0.114f * 65536.0f);
+    // grayscale models convert the RGB pixels to luma first, so only RGB
+    // models quantize through the tables
+    const ei_image_quantize_lut_t *lut = nullptr;
+    if (channel_count == 3) {
+        lut = get_image_quantize_lut(scale, zero_point, image_scaling, fast_path);
+        if (!lut) {
+            EIDSP_ERR(EIDSP_OUT_OF_MEM);
+        }
+    }
 
-    static const float torch_mean[] = { 0.485, 0.456, 0.406 };
-    static const float torch_std[] = { 0.229, 0.224, 0.225 };
+    int8_t *out = output_matrix->buffer;
 
 #if defined(EI_DSP_IMAGE_BUFFER_STATIC_SIZE)
     const size_t page_size = EI_DSP_IMAGE_BUFFER_STATIC_SIZE;
@@ -1294,107 +1450,259 @@ __attribute__((unused)) int extract_image_features_quantized(signal_t *signal, m
         matrix_t input_matrix(elements_to_read, config.axes);
 #endif
         if (!input_matrix.buffer) {
+            if (lut) {
+                release_image_quantize_lut(lut);
+            }
             EIDSP_ERR(EIDSP_OUT_OF_MEM);
         }
         signal->get_data(ix, elements_to_read, input_matrix.buffer);
 
-        for (size_t jx = 0; jx < elements_to_read; jx++) {
-            uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
+        if (lut) {
+            for (size_t jx = 0; jx < elements_to_read; jx++) {
+                uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
 
-            if (channel_count == 3) {
-                // fast code path
-                if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                    int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
-                    int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
-                    int32_t b = static_cast<int32_t>(pixel & 0xff);
-
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(r + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(g + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(b + zero_point);
+                *out++ = lut->rgb[pixel >> 16 & 0xff];
+                *out++ = lut->rgb[256 + (pixel >> 8 & 0xff)];
+                *out++ = lut->rgb[512 + (pixel & 0xff)];
+            }
+        }
+        else {
+            for (size_t jx = 0; jx < elements_to_read; jx++) {
+                uint32_t pixel = static_cast<uint32_t>(input_matrix.buffer[jx]);
+
+                out = quantize_image_pixel(
+                    static_cast<int32_t>(pixel >> 16 & 0xff),
+                    static_cast<int32_t>(pixel >> 8 & 0xff),
+                    static_cast<int32_t>(pixel & 0xff),
+                    channel_count, fast_path, scale, zero_point, image_scaling, out);
+            }
+        }
+
+        bytes_left -= elements_to_read;
+
+    }
+    if (lut) {
+        release_image_quantize_lut(lut);
+    }
+    return EIDSP_OK;
+}
+
+/**
+ * Row callback of the JPEG decoder, feeds the resizer until every output row is written
+ */
+static int push_jpeg_row(void *user, const uint8_t *row, int y) {
+    (void)y;
+    ei::image::processing::ResizeQuantizer *resizer = (ei::image::processing::ResizeQuantizer*)user;
+    int ret = resizer->push_row(row);
+    if (ret != EIDSP_OK) {
+        return ret;
+    }
+    return resizer->done() ? ei::image::jpeg::JPEG_STOP : (int)EIDSP_OK;
+}
+
+/**
+ * Crop, resize and quantize through the tables, see extract_image_features_quantized()
+ */
+static int quantize_image_source(const image_source_t *image, matrix_i8_t *output_matrix, int dst_width, int dst_height,
+                                 int16_t channel_count, size_t pixel_size, size_t stride, bool fast_path,
+                                 float scale, float zero_point, int image_scaling, const ei_image_quantize_lut_t *lut) {
+    if (image->format == EI_IMAGE_SOURCE_JPEG ||
+        image->width != (uint32_t)dst_width || image->height != (uint32_t)dst_height) {
+#ifdef EI_CLASSIFIER_RESIZE_MODE
+        const int resize_mode = EI_CLASSIFIER_RESIZE_MODE;
+#else
+        const int resize_mode = EI_CLASSIFIER_RESIZE_FIT_SHORTEST;
+#endif
+        // grayscale models quantize luma like a gray pixel, the resizer finds
+        // out itself whether the table is a plain offset
+        const int8_t *resize_lut = channel_count == 1 ? lut->gray : lut->rgb;
+
+        if (image->format == EI_IMAGE_SOURCE_JPEG) {
+            ei::image::jpeg::jpeg_info_t info;
+            int ret = ei::image::jpeg::get_info(image->buffer, image->size, &info);
+            if (ret != EIDSP_OK) {
+                return ret;
+            }
+
+            int jpeg_scale = ei::image::jpeg::choose_scale(info.width, info.height, dst_width, dst_height,
+                resize_mode != EI_CLASSIFIER_RESIZE_SQUASH);
+            int scaled_width, scaled_height;
+            ei::image::jpeg::scaled_size(info.width, info.height, jpeg_scale, scaled_width, scaled_height);
+
+            ei::image::processing::ResizeQuantizer resizer;
+            ret = resizer.init(scaled_width, scaled_height, pixel_size,
+                output_matrix->buffer, dst_width, dst_height, channel_count, resize_mode,
+                (ei::image::processing::RESIZE_INTERPOLATION)EI_DSP_IMAGE_RESIZE_INTERPOLATION, resize_lut);
+            if (ret != EIDSP_OK) {
+                return ret;
+            }
+
+            // blocks outside the crop are entropy decoded only
+            int crop_x, crop_width;
+            resizer.get_crop_columns(crop_x, crop_width);
+            return ei::image::jpeg::decode(image->buffer, image->size, jpeg_scale, (int)pixel_size,
+                push_jpeg_row, &resizer, crop_x, crop_width);
+        }
+
+        ei::image::processing::ResizeQuantizer resizer;
+        int ret = resizer.init(image->width, image->height, pixel_size == 1 ? 1 : 3,
+            output_matrix->buffer, dst_width, dst_height, channel_count, resize_mode,
+            (ei::image::processing::RESIZE_INTERPOLATION)EI_DSP_IMAGE_RESIZE_INTERPOLATION, resize_lut);
+        if (ret != EIDSP_OK) {
+            return ret;
+        }
+
+        // RGB565 rows are expanded one at a time
+        uint8_t *rgb_row = nullptr;
+        if (image->format == EI_IMAGE_SOURCE_RGB565) {
+            rgb_row = (uint8_t*)ei_scratch_malloc(image->width * 3);
+            if (!rgb_row) {
+                return EIDSP_OUT_OF_MEM;
+            }
+        }
+
+        for (uint32_t y = 0; y < image->height && !resizer.done(); y++) {
+            const uint8_t *row = image->buffer + y * stride;
+            if (rgb_row) {
+                for (uint32_t x = 0; x < image->width; x++) {
+                    uint16_t pixel = (uint16_t)((row[2 * x] << 8) | row[2 * x + 1]);
+                    uint8_t r = (pixel >> 11) & 0x1f;
+                    uint8_t g = (pixel >> 5) & 0x3f;
+                    uint8_t b = pixel & 0x1f;
+                    rgb_row[3 * x] = (r << 3) | (r >> 2);
+                    rgb_row[3 * x + 1] = (g << 2) | (g >> 4);
+                    rgb_row[3 * x + 2] = (b << 3) | (b >> 2);
+                }
+                row = rgb_row;
+            }
+            ret = resizer.push_row(row);
+            if (ret != EIDSP_OK) {
+                break;
+            }
+        }
+
+        if (rgb_row) {
+            ei_scratch_free(rgb_row);
+        }
+        return ret;
+    }
+
+    int8_t *out = output_matrix->buffer;
+
+    for (uint32_t y = 0; y < image->height; y++) {
+        const uint8_t *row = image->buffer + y * stride;
+
+        if (channel_count == 1 && image->format != EI_IMAGE_SOURCE_GRAYSCALE) {
+            // luma of the RGB values comes before quantization, no table for that
+            for (uint32_t x = 0; x < image->width; x++) {
+                int32_t r, g, b;
+                if (image->format == EI_IMAGE_SOURCE_RGB888) {
+                    r = row[3 * x];
+                    g = row[3 * x + 1];
+                    b = row[3 * x + 2];
                 }
-                // slow code path
                 else {
-                    float r = static_cast<float>(pixel >> 16 & 0xff);
-                    float g = static_cast<float>(pixel >> 8 & 0xff);
-                    float b = static_cast<float>(pixel & 0xff);
-
-                    if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-
-                        r = (r - torch_mean[0]) / torch_std[0];
-                        g = (g - torch_mean[1]) / torch_std[1];
-                        b = (b - torch_mean[2]) / torch_std[2];
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
-                        r -= 128.0f;
-                        g -= 128.0f;
-                        b -= 128.0f;
-                    }
+                    uint16_t pixel = (uint16_t)((row[2 * x] << 8) | row[2 * x + 1]);
+                    // expand to 8 bits by replicating the high bits into the low bits
+                    r = (pixel >> 11) & 0x1f;
+                    g = (pixel >> 5) & 0x3f;
+                    b = pixel & 0x1f;
+                    r = (r << 3) | (r >> 2);
+                    g = (g << 2) | (g >> 4);
+                    b = (b << 3) | (b >> 2);
+                }
+                out = quantize_image_pixel(r, g, b, 1, fast_path, scale, zero_point, image_scaling, out);
+            }
+            continue;
+        }
 
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(r / scale) + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(g / scale) + zero_point);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(b / scale) + zero_point);
+        switch (image->format) {
+            case EI_IMAGE_SOURCE_RGB888: {
+                ei::image::processing::quantize_with_lut(row, out, image->width * 3, 3, lut->rgb, lut->rgb_is_offset);
+                out += image->width * 3;
+                break;
+            }
+            case EI_IMAGE_SOURCE_RGB565: {
+                for (uint32_t x = 0; x < image->width; x++, row += 2) {
+                    uint16_t pixel = (uint16_t)((row[0] << 8) | row[1]);
+                    // expand to 8 bits by replicating the high bits into the low bits
+                    uint8_t r = (pixel >> 11) & 0x1f;
+                    uint8_t g = (pixel >> 5) & 0x3f;
+                    uint8_t b = pixel & 0x1f;
+                    *out++ = lut->rgb[(r << 3) | (r >> 2)];
+                    *out++ = lut->rgb[256 + ((g << 2) | (g >> 4))];
+                    *out++ = lut->rgb[512 + ((b << 3) | (b >> 2))];
                 }
+                break;
             }
-            else {
-                // fast code path
-                if (scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                    int32_t r = static_cast<int32_t>(pixel >> 16 & 0xff);
-                    int32_t g = static_cast<int32_t>(pixel >> 8 & 0xff);
-                    int32_t b = static_cast<int32_t>(pixel & 0xff);
-
-                    // ITU-R 601-2 luma transform
-                    // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
-                    int32_t gray = (iRedToGray * r) + (iGreenToGray * g) + (iBlueToGray * b);
-                    gray >>= 16; // scale down to int8_t
-                    gray += zero_point;
-                    if (gray < - 128) gray = -128;
-                    else if (gray > 127) gray = 127;
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(gray);
+            default: {
+                if (channel_count == 1) {
+                    ei::image::processing::quantize_with_lut(row, out, image->width, 1, lut->gray, lut->gray_is_offset);
+                    out += image->width;
                 }
-                // slow code path
                 else {
-                    float r = static_cast<float>(pixel >> 16 & 0xff);
-                    float g = static_cast<float>(pixel >> 8 & 0xff);
-                    float b = static_cast<float>(pixel & 0xff);
-
-                    if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-                    }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
-                        r /= 255.0f;
-                        g /= 255.0f;
-                        b /= 255.0f;
-
-                        r = (r - torch_mean[0]) / torch_std[0];
-                        g = (g - torch_mean[1]) / torch_std[1];
-                        b = (b - torch_mean[2]) / torch_std[2];
+                    for (uint32_t x = 0; x < image->width; x++) {
+                        const uint8_t v = row[x];
+                        *out++ = lut->rgb[v];
+                        *out++ = lut->rgb[256 + v];
+                        *out++ = lut->rgb[512 + v];
                     }
-                    else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
-                        r -= 128.0f;
-                        g -= 128.0f;
-                        b -= 128.0f;
-                    }
-
-                    // ITU-R 601-2 luma transform
-                    // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
-                    float v = (0.299f * r) + (0.587f * g) + (0.114f * b);
-                    output_matrix->buffer[output_ix++] = static_cast<int8_t>(round(v / scale) + zero_point);
                 }
+                break;
             }
         }
+    }
 
-        bytes_left -= elements_to_read;
+    return EIDSP_OK;
+}
 
+/**
+ * Quantize a raw 8-bit image straight into the model input, without paging
+ * the pixels through a float buffer. Images with the model input size are
+ * copied as is; any other size is cropped (EI_CLASSIFIER_RESIZE_MODE), resized
+ * and quantized in one streaming pass. JPEG images are decoded row by row into
+ * that pass, at the smallest DCT scale that still covers the model input.
+ * Every 8-bit value is quantized once per scale, zero point and image scaling
+ * (get_image_quantize_lut()), pixels are table lookups.
+ */
+__attribute__((unused)) int extract_image_features_quantized(const image_source_t *image, matrix_i8_t *output_matrix, int dst_width, int dst_height,
+                                                             void *config_ptr, float scale, float zero_point, int image_scaling) {
+    ei_dsp_config_image_t *config = (ei_dsp_config_image_t*)config_ptr;
+
+    int16_t channel_count = strcmp(config->channels, "Grayscale") == 0 ? 1 : 3;
+
+    const bool fast_path = scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE;
+
+    size_t pixel_size = 0;
+    switch (image->format) {
+        case EI_IMAGE_SOURCE_RGB888: pixel_size = 3; break;
+        case EI_IMAGE_SOURCE_RGB565: pixel_size = 2; break;
+        case EI_IMAGE_SOURCE_GRAYSCALE: pixel_size = 1; break;
+        // decoded rows, only luma for grayscale models
+        case EI_IMAGE_SOURCE_JPEG: pixel_size = channel_count == 1 ? 1 : 3; break;
+        default:
+            EIDSP_ERR(EIDSP_PARAMETER_INVALID);
+    }
+
+    if (image->buffer == nullptr) {
+        EIDSP_ERR(EIDSP_INPUT_MATRIX_EMPTY);
+    }
+    if ((size_t)dst_width * dst_height * channel_count != output_matrix->rows * output_matrix->cols) {
+        EIDSP_ERR(EIDSP_MATRIX_SIZE_MISMATCH);
+    }
+
+    const size_t stride = image->stride != 0 ? image->stride : image->width * pixel_size;
+
+    const ei_image_quantize_lut_t *lut = get_image_quantize_lut(scale, zero_point, image_scaling, fast_path);
+    if (!lut) {
+        EIDSP_ERR(EIDSP_OUT_OF_MEM);
+    }
+
+    int ret = quantize_image_source(image, output_matrix, dst_width, dst_height, channel_count, pixel_size, stride,
+        fast_path, scale, zero_point, image_scaling, lut);
+    release_image_quantize_lut(lut);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
     }
     return EIDSP_OK;
 }
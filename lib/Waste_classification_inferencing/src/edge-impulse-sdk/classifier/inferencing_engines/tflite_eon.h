@@ -43,10 +43,59 @@
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/tflite_helper.h"
 #include "edge-impulse-sdk/classifier/ei_run_dsp.h"
+#include "edge-impulse-sdk/classifier/ei_inference_context.h"
+#include "edge-impulse-sdk/classifier/postprocessing/ei_postprocessing_common.h"
+
+/**
+ * Point outputs at the output tensors of block_config, of an instance or of
+ * the model (instance is nullptr)
+ */
+static EI_IMPULSE_ERROR inference_tflite_outputs(
+    ei_learning_block_config_tflite_graph_t *block_config,
+    void *instance,
+    TfLiteTensor *outputs) {
+
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    for (uint8_t i = 0; i < block_config->output_tensors_size; i++) {
+        int index = block_config->output_tensors_indices[i];
+        TfLiteStatus status = instance ? graph_config->model_instance_output(instance, index, &outputs[i]) :
+            graph_config->model_output(index, &outputs[i]);
+        if (status != kTfLiteOk) {
+            return EI_IMPULSE_TFLITE_ERROR;
+        }
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Release the model after inference, unless a session keeps it alive
+ *
+ * @param   block_config    Learning block config
+ * @param   instance        Model instance, nullptr for the model itself
+ * @param   session_open    The handle has a session open on the model (run_nn_open_session())
+ *
+ * @return  kTfLiteOk if successful
+ */
+static TfLiteStatus inference_tflite_teardown(
+    ei_learning_block_config_tflite_graph_t *block_config,
+    void *instance = nullptr,
+    bool session_open = false) {
+
+    // instances live until run_nn_close_instance()
+    if (instance || session_open) {
+        return kTfLiteOk;
+    }
+
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+    return graph_config->model_reset(ei_aligned_free);
+}
 
 /**
  * Setup the TFLite runtime
  *
+ * @param      instance           Model instance from run_nn_open_instance(), nullptr for the model itself
+ * @param      session_open       The handle has a session open on the model
  * @param      ctx_start_us       Pointer to the start time
  * @param      input              Pointer to input tensor
  * @param      output             Pointer to output tensor
@@ -56,6 +105,8 @@
  */
 static EI_IMPULSE_ERROR inference_tflite_setup(
     ei_learning_block_config_tflite_graph_t *block_config,
+    void *instance,
+    bool session_open,
     uint64_t *ctx_start_us,
     TfLiteTensor* input,
     TfLiteTensor** output_arg,
@@ -63,35 +114,39 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
 
     *ctx_start_us = ei_read_timer_us();
 
-    TfLiteTensor *outputs = *output_arg;
     ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
 
-    TfLiteStatus init_status = graph_config->model_init(ei_aligned_calloc);
-    if (init_status != kTfLiteOk) {
-        ei_printf("Failed to initialize the model (error code %d)\n", init_status);
-        return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+    // an instance, or the model with an open session, is already set up and all kernels are prepared
+    if (!instance && !session_open) {
+        TfLiteStatus init_status = graph_config->model_init(ei_aligned_calloc);
+        if (init_status != kTfLiteOk) {
+            ei_printf("Failed to initialize the model (error code %d)\n", init_status);
+            // init may have allocated the arena before failing
+            graph_config->model_reset(ei_aligned_free);
+            return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+        }
     }
 
     TfLiteStatus status;
 
-    status = graph_config->model_input(0, input);
+    status = instance ? graph_config->model_instance_input(instance, 0, input) :
+        graph_config->model_input(0, input);
     if (status != kTfLiteOk) {
+        inference_tflite_teardown(block_config, instance, session_open);
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
-    for (uint8_t i = 0; i < block_config->output_tensors_size; i++) {
-        status = graph_config->model_output(block_config->output_tensors_indices[i], &outputs[i]);
-        if (status != kTfLiteOk) {
-            return EI_IMPULSE_TFLITE_ERROR;
-        }
+    EI_IMPULSE_ERROR res = inference_tflite_outputs(block_config, instance, *output_arg);
+    if (res != EI_IMPULSE_OK) {
+        inference_tflite_teardown(block_config, instance, session_open);
     }
-
-    return EI_IMPULSE_OK;
+    return res;
 }
 
 /**
  * Run TFLite model
  *
+ * @param   instance        Model instance, nullptr for the model itself
  * @param   ctx_start_us    Start time of the setup function (see above)
  * @param   output          Output tensor
  * @param   interpreter     TFLite interpreter (non-compiled models)
@@ -104,6 +159,7 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
 static EI_IMPULSE_ERROR inference_tflite_run(
     const ei_impulse_t *impulse,
     ei_learning_block_config_tflite_graph_t *block_config,
+    void *instance,
     uint64_t ctx_start_us,
     TfLiteTensor** outputs,
     uint8_t* tensor_arena,
@@ -112,7 +168,9 @@ static EI_IMPULSE_ERROR inference_tflite_run(
 
     ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
 
-    if (graph_config->model_invoke() != kTfLiteOk) {
+    TfLiteStatus status = instance ? graph_config->model_instance_invoke(instance) :
+        graph_config->model_invoke();
+    if (status != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
@@ -156,6 +214,8 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
 
     EI_IMPULSE_ERROR init_res = inference_tflite_setup(
         block_config,
+        nullptr,
+        false,
         &ctx_start_us,
         &input,
         &outputs,
@@ -180,7 +240,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
         return output_res;
     }
 
-    if (graph_config->model_reset(ei_aligned_free) != kTfLiteOk) {
+    if (inference_tflite_teardown(block_config) != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
     ei_free(outputs);
@@ -191,13 +251,14 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
 /**
  * @brief      Do neural network inferencing over a feature matrix
  *
- * @param      fmatrix  Processed matrix
- * @param      result   Output classifier results
- * @param[in]  debug    Debug output enable
+ * @param      fmatrix       Processed matrix
+ * @param      result        Output classifier results
+ * @param[in]  session_open  The handle has a session open on the model (run_nn_open_session())
+ * @param[in]  debug         Debug output enable
  *
  * @return     The ei impulse error.
  */
-EI_IMPULSE_ERROR run_nn_inference(
+EI_IMPULSE_ERROR run_nn_inference_session(
     const ei_impulse_t *impulse,
     ei_feature_t *fmatrix,
     uint32_t learn_block_index,
@@ -205,22 +266,28 @@ EI_IMPULSE_ERROR run_nn_inference(
     uint32_t input_block_ids_size,
     ei_impulse_result_t *result,
     void *config_ptr,
+    bool session_open,
     bool debug = false)
 {
     ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
-    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
 
     TfLiteTensor input;
     TfLiteTensor *outputs;
 
     // allocate outputs
     outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
+    if (!outputs) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+    ei_unique_ptr_t p_outputs(outputs, ei_free);
 
     uint64_t ctx_start_us = ei_read_timer_us();
     ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
 
     EI_IMPULSE_ERROR init_res = inference_tflite_setup(
         block_config,
+        nullptr,
+        session_open,
         &ctx_start_us,
         &input,
         &outputs,
@@ -241,12 +308,14 @@ EI_IMPULSE_ERROR run_nn_inference(
                                                    impulse->learning_blocks_size);
 
     if (input_res != EI_IMPULSE_OK) {
+        inference_tflite_teardown(block_config, nullptr, session_open);
         return input_res;
     }
 
     EI_IMPULSE_ERROR run_res = inference_tflite_run(
         impulse,
         block_config,
+        nullptr,
         ctx_start_us,
         &outputs,
         tensor_arena, result, debug);
@@ -288,6 +357,7 @@ EI_IMPULSE_ERROR run_nn_inference(
             }
             default: {
                 ei_printf("ERR: Cannot handle output type (%d)\n", output->type);
+                inference_tflite_teardown(block_config, nullptr, session_open);
                 return EI_IMPULSE_OUTPUT_TENSOR_WAS_NULL;
             }
         }
@@ -295,8 +365,7 @@ EI_IMPULSE_ERROR run_nn_inference(
         result->_raw_outputs[learn_block_index + output_ix].blockId = block_config->block_id + output_ix;
     }
 
-    graph_config->model_reset(ei_aligned_free);
-    ei_free(outputs);
+    inference_tflite_teardown(block_config, nullptr, session_open);
 
     if (run_res != EI_IMPULSE_OK) {
         return run_res;
@@ -305,55 +374,79 @@ EI_IMPULSE_ERROR run_nn_inference(
     return EI_IMPULSE_OK;
 }
 
-#if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
 /**
- * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
- * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
- * returns EI_IMPULSE_OK.
+ * @brief      Do neural network inferencing over a feature matrix, the model
+ *             is set up and released around the call
+ *
+ * @param      fmatrix  Processed matrix
+ * @param      result   Output classifier results
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
  */
-EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+EI_IMPULSE_ERROR run_nn_inference(
     const ei_impulse_t *impulse,
-    signal_t *signal,
+    ei_feature_t *fmatrix,
     uint32_t learn_block_index,
+    uint32_t* input_block_ids,
+    uint32_t input_block_ids_size,
     ei_impulse_result_t *result,
     void *config_ptr,
-    bool debug = false) {
-
-    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
-    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
-
-    uint64_t ctx_start_us;
-    TfLiteTensor input;
-    TfLiteTensor *outputs;
-
-    // allocate outputs
-    outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
-
-    ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
-
-    EI_IMPULSE_ERROR init_res = inference_tflite_setup(
-        block_config,
-        &ctx_start_us,
-        &input,
-        &outputs,
-        p_tensor_arena);
+    bool debug = false)
+{
+    return run_nn_inference_session(impulse, fmatrix, learn_block_index, input_block_ids, input_block_ids_size,
+        result, config_ptr, false, debug);
+}
 
-    if (init_res != EI_IMPULSE_OK) {
-        return init_res;
+#if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
+/**
+ * Matrix for the values of an output tensor, from the context if there is one
+ */
+template<typename T>
+static T *alloc_output_matrix(ei_inference_context_t *context, uint32_t output_ix, size_t output_size) {
+    if (context) {
+        return context->output_matrix<T>(output_ix, output_size);
     }
+    return new T(1, output_size);
+}
 
-    if (input.type != TfLiteType::kTfLiteInt8 && input.type != TfLiteType::kTfLiteUInt8) {
+/**
+ * Crop, resize and quantize the pixels of signal (packed into floats) or image
+ * (raw bytes) into the input tensor, or copy features that run_nn_quantize_image()
+ * produced. The DSP time goes to result.
+ */
+static EI_IMPULSE_ERROR inference_tflite_fill_input_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    const image_source_t *image,
+    const int8_t *features,
+    TfLiteTensor *input,
+    ei_impulse_result_t *result,
+    bool debug) {
+
+    if (input->type != TfLiteType::kTfLiteInt8 && input->type != TfLiteType::kTfLiteUInt8) {
         return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
     }
 
     uint64_t dsp_start_us = ei_read_timer_us();
 
     // features matrix maps around the input tensor to not allocate any memory
-    ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, input.data.int8);
+    ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, input->data.int8);
 
     // run DSP process and quantize automatically
-    int ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input.params.scale, input.params.zero_point,
-        impulse->frequency, impulse->learning_blocks[0].image_scaling);
+    int ret;
+    if (features) {
+        memcpy(features_matrix.buffer, features, impulse->nn_input_frame_size);
+        ret = EIDSP_OK;
+    }
+    else if (image) {
+        ret = extract_image_features_quantized(image, &features_matrix, impulse->input_width, impulse->input_height,
+            impulse->dsp_blocks[0].config, input->params.scale, input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+    }
+    else {
+        ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input->params.scale, input->params.zero_point,
+            impulse->frequency, impulse->learning_blocks[0].image_scaling);
+    }
 
     if (ret != EIDSP_OK) {
         ei_printf("ERR: Failed to run DSP process (%d)\n", ret);
@@ -370,22 +463,25 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     if (debug) {
         ei_printf("Features (%d ms.): ", result->timing.dsp);
         for (size_t ix = 0; ix < features_matrix.cols; ix++) {
-            ei_printf_float((features_matrix.buffer[ix] - input.params.zero_point) * input.params.scale);
+            ei_printf_float((features_matrix.buffer[ix] - input->params.zero_point) * input->params.scale);
             ei_printf(" ");
         }
         ei_printf("\n");
     }
 
-    ctx_start_us = ei_read_timer_us();
+    return EI_IMPULSE_OK;
+}
 
-    EI_IMPULSE_ERROR run_res = inference_tflite_run(
-        impulse,
-        block_config,
-        ctx_start_us,
-        &outputs,
-        static_cast<uint8_t*>(p_tensor_arena.get()),
-        result,
-        debug);
+/**
+ * Copy the output tensors into result->_raw_outputs, the matrices come from
+ * context if it is not nullptr
+ */
+static EI_IMPULSE_ERROR inference_tflite_copy_outputs(
+    ei_learning_block_config_tflite_graph_t *block_config,
+    TfLiteTensor *outputs,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    ei_inference_context_t *context) {
 
     for (uint32_t output_ix = 0; output_ix < block_config->output_tensors_size; output_ix++) {
         TfLiteTensor* output = &outputs[output_ix];
@@ -395,31 +491,47 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
             output_size *= output->dims->data[dim_num];
         }
 
+        ei_feature_t *raw_output = &result->_raw_outputs[learn_block_index + output_ix];
         switch (output->type) {
             case kTfLiteFloat32: {
-                result->_raw_outputs[learn_block_index + output_ix].matrix = new matrix_t(1, output_size);
-                memcpy(result->_raw_outputs[learn_block_index + output_ix].matrix->buffer, output->data.f, output->bytes);
+                raw_output->matrix = alloc_output_matrix<matrix_t>(context, output_ix, output_size);
+                if (!raw_output->matrix) {
+                    return EI_IMPULSE_OUT_OF_MEMORY;
+                }
+                memcpy(raw_output->matrix->buffer, output->data.f, output->bytes);
                 break;
             }
             case kTfLiteInt8: {
                 if (block_config->dequantize_output) {
-                    result->_raw_outputs[learn_block_index + output_ix].matrix = new matrix_t(1, output_size);
-                    fill_output_matrix_from_tensor(output, result->_raw_outputs[learn_block_index + output_ix].matrix);
+                    raw_output->matrix = alloc_output_matrix<matrix_t>(context, output_ix, output_size);
+                    if (!raw_output->matrix) {
+                        return EI_IMPULSE_OUT_OF_MEMORY;
+                    }
+                    fill_output_matrix_from_tensor(output, raw_output->matrix);
                 }
                 else {
-                    result->_raw_outputs[learn_block_index + output_ix].matrix_i8 = new matrix_i8_t(1, output_size);
-                    memcpy(result->_raw_outputs[learn_block_index + output_ix].matrix_i8->buffer, output->data.int8, output->bytes);
+                    raw_output->matrix_i8 = alloc_output_matrix<matrix_i8_t>(context, output_ix, output_size);
+                    if (!raw_output->matrix_i8) {
+                        return EI_IMPULSE_OUT_OF_MEMORY;
+                    }
+                    memcpy(raw_output->matrix_i8->buffer, output->data.int8, output->bytes);
                 }
                 break;
             }
             case kTfLiteUInt8: {
                 if (block_config->dequantize_output) {
-                    result->_raw_outputs[learn_block_index + output_ix].matrix = new matrix_t(1, output_size);
-                    fill_output_matrix_from_tensor(output, result->_raw_outputs[learn_block_index + output_ix].matrix);
+                    raw_output->matrix = alloc_output_matrix<matrix_t>(context, output_ix, output_size);
+                    if (!raw_output->matrix) {
+                        return EI_IMPULSE_OUT_OF_MEMORY;
+                    }
+                    fill_output_matrix_from_tensor(output, raw_output->matrix);
                 }
                 else {
-                    result->_raw_outputs[learn_block_index + output_ix].matrix_u8 = new matrix_u8_t(1, output_size);
-                    memcpy(result->_raw_outputs[learn_block_index + output_ix].matrix_u8->buffer, output->data.uint8, output->bytes);
+                    raw_output->matrix_u8 = alloc_output_matrix<matrix_u8_t>(context, output_ix, output_size);
+                    if (!raw_output->matrix_u8) {
+                        return EI_IMPULSE_OUT_OF_MEMORY;
+                    }
+                    memcpy(raw_output->matrix_u8->buffer, output->data.uint8, output->bytes);
                 }
                 break;
             }
@@ -429,19 +541,839 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
             }
         }
 
-        result->_raw_outputs[learn_block_index + output_ix].blockId = block_config->block_id + output_ix;
+        raw_output->blockId = block_config->block_id + output_ix;
     }
 
-    graph_config->model_reset(ei_aligned_free);
-    ei_free(outputs);
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Output tensors of block_config, from context if it is not nullptr, otherwise
+ * from the heap (owned by p_outputs)
+ */
+static EI_IMPULSE_ERROR inference_tflite_alloc_outputs(
+    ei_learning_block_config_tflite_graph_t *block_config,
+    ei_inference_context_t *context,
+    TfLiteTensor **outputs,
+    ei_unique_ptr_t& p_outputs) {
+
+    if (context) {
+        if (block_config->output_tensors_size > EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS) {
+            ei_printf("ERR: Model has %d output tensors, EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS is %d\n",
+                (int)block_config->output_tensors_size, (int)EI_INFERENCE_CONTEXT_MAX_OUTPUT_TENSORS);
+            return EI_IMPULSE_OUT_OF_MEMORY;
+        }
+        *outputs = context->output_tensors;
+    }
+    else {
+        *outputs = (TfLiteTensor*)ei_malloc(block_config->output_tensors_size * sizeof(TfLiteTensor));
+        if (!*outputs) {
+            return EI_IMPULSE_OUT_OF_MEMORY;
+        }
+        p_outputs.reset(*outputs);
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Quantize an image into the input tensor and run the model. The pixels come
+ * either from signal (packed into floats) or from image (raw bytes), or were
+ * already quantized into features by run_nn_quantize_image(). With a context,
+ * the output tensors and matrices come from it instead of the heap. With an
+ * instance (run_nn_open_instance()), that copy of the model runs. session_open
+ * keeps the model set up after the call (run_nn_open_session()).
+ */
+static EI_IMPULSE_ERROR inference_tflite_image_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    const image_source_t *image,
+    const int8_t *features,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance,
+    bool session_open,
+    bool debug) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+
+    uint64_t ctx_start_us;
+    TfLiteTensor input;
+    TfLiteTensor *outputs;
+
+    ei_unique_ptr_t p_outputs(nullptr, ei_free);
+    EI_IMPULSE_ERROR alloc_res = inference_tflite_alloc_outputs(block_config, context, &outputs, p_outputs);
+    if (alloc_res != EI_IMPULSE_OK) {
+        return alloc_res;
+    }
 
+    ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
+
+    EI_IMPULSE_ERROR init_res = inference_tflite_setup(
+        block_config,
+        instance,
+        session_open,
+        &ctx_start_us,
+        &input,
+        &outputs,
+        p_tensor_arena);
+
+    if (init_res != EI_IMPULSE_OK) {
+        return init_res;
+    }
+
+    EI_IMPULSE_ERROR fill_res = inference_tflite_fill_input_quantized(impulse, signal, image, features, &input, result, debug);
+    if (fill_res != EI_IMPULSE_OK) {
+        inference_tflite_teardown(block_config, instance, session_open);
+        return fill_res;
+    }
+
+    ctx_start_us = ei_read_timer_us();
+
+    EI_IMPULSE_ERROR run_res = inference_tflite_run(
+        impulse,
+        block_config,
+        instance,
+        ctx_start_us,
+        &outputs,
+        static_cast<uint8_t*>(p_tensor_arena.get()),
+        result,
+        debug);
+
+    EI_IMPULSE_ERROR output_res = inference_tflite_copy_outputs(block_config, outputs, learn_block_index, result, context);
+
+    inference_tflite_teardown(block_config, instance, session_open);
+
+    if (output_res != EI_IMPULSE_OK) {
+        return output_res;
+    }
     if (run_res != EI_IMPULSE_OK) {
         return run_res;
     }
 
     return EI_IMPULSE_OK;
 }
-#endif // EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
+
+/**
+ * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
+ * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
+ * returns EI_IMPULSE_OK.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool debug = false) {
+
+    return inference_tflite_image_quantized(impulse, signal, nullptr, nullptr, learn_block_index, result, config_ptr, nullptr, nullptr,
+        false, debug);
+}
+
+/**
+ * Like run_nn_inference_image_quantized(), session_open keeps the model set up
+ * after the call (run_nn_open_session()).
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_quantized_session(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool session_open,
+    bool debug = false) {
+
+    return inference_tflite_image_quantized(impulse, signal, nullptr, nullptr, learn_block_index, result, config_ptr, nullptr, nullptr,
+        session_open, debug);
+}
+
+/**
+ * Like run_nn_inference_image_quantized(), but reads the pixels straight from a
+ * raw 8-bit image. Images of another size are cropped and resized on the fly.
+ * The outputs go to context if it is not nullptr. instance is a model from
+ * run_nn_open_instance(), or nullptr. session_open keeps the model set up.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_source(
+    const ei_impulse_t *impulse,
+    const image_source_t *image,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance,
+    bool session_open,
+    bool debug = false) {
+
+    return inference_tflite_image_quantized(impulse, nullptr, image, nullptr, learn_block_index, result, config_ptr, context, instance,
+        session_open, debug);
+}
+
+/**
+ * Run only the DSP half of run_nn_inference_image_source(): crop, resize and
+ * quantize image into features (impulse->nn_input_frame_size bytes) with the
+ * quantization of the input tensor. Does not touch the tensor arena, so it can
+ * run while another thread invokes the model. Scratch memory comes from context
+ * if it is not nullptr. The input quantization comes from the constant data of
+ * the model when it has model_input_quantization, otherwise from instance, or
+ * from the model, which is set up for this unless session_open.
+ */
+EI_IMPULSE_ERROR run_nn_quantize_image(
+    const ei_impulse_t *impulse,
+    const image_source_t *image,
+    int8_t *features,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance,
+    bool session_open,
+    uint64_t *dsp_us) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    TfLiteTensor input;
+    TfLiteStatus status;
+    if (graph_config->model_input_quantization) {
+        // constant data, never races the model being set up, invoked or reset on another thread
+        status = graph_config->model_input_quantization(0, &input);
+    }
+    else {
+        // without a session the model is set up just for this, which must not
+        // overlap an inference on the model
+        if (!instance && !session_open) {
+            if (graph_config->model_init(ei_aligned_calloc) != kTfLiteOk) {
+                graph_config->model_reset(ei_aligned_free);
+                return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+            }
+        }
+        status = instance ? graph_config->model_instance_input(instance, 0, &input) :
+            graph_config->model_input(0, &input);
+        inference_tflite_teardown(block_config, instance, session_open);
+    }
+    if (status != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+    if (input.type != TfLiteType::kTfLiteInt8 && input.type != TfLiteType::kTfLiteUInt8) {
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+    uint64_t dsp_start_us = ei_read_timer_us();
+
+    ei_inference_context_scope_t context_scope(context);
+    ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, features);
+    int ret = extract_image_features_quantized(image, &features_matrix, impulse->input_width, impulse->input_height,
+        impulse->dsp_blocks[0].config, input.params.scale, input.params.zero_point, impulse->learning_blocks[0].image_scaling);
+    if (ret != EIDSP_OK) {
+        ei_printf("ERR: Failed to run DSP process (%d)\n", ret);
+        return EI_IMPULSE_DSP_ERROR;
+    }
+
+    if (dsp_us) {
+        *dsp_us = ei_read_timer_us() - dsp_start_us;
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Like run_nn_inference_image_source(), for features that run_nn_quantize_image()
+ * produced. They are copied into the input tensor, so the caller can fill the
+ * next buffer while the model runs. The outputs go to context if it is not nullptr,
+ * instance is a model from run_nn_open_instance() or nullptr, session_open keeps
+ * the model set up.
+ */
+EI_IMPULSE_ERROR run_nn_inference_quantized_features(
+    const ei_impulse_t *impulse,
+    const int8_t *features,
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance,
+    bool session_open,
+    bool debug = false) {
+
+    return inference_tflite_image_quantized(impulse, nullptr, nullptr, features, learn_block_index, result, config_ptr, context, instance,
+        session_open, debug);
+}
+
+/**
+ * Decide on the top label (ei_classification_decide_i8()) of a model that ran
+ * as far as its logits, or in full when it has none. The softmax then runs
+ * into output when the logits leave open whether that label is above
+ * threshold, or, with probabilities, when it is (decision->probabilities).
+ */
+static EI_IMPULSE_ERROR inference_tflite_decide(
+    const ei_impulse_t *impulse,
+    ei_config_tflite_eon_graph_t *graph_config,
+    void *instance,
+    float threshold,
+    bool probabilities,
+    TfLiteTensor *output,
+    ei_impulse_decision_t *decision) {
+
+    ei_classification_thresholds_i8_t thresholds;
+    bool settled = false;
+    bool softmax = true;
+    if (graph_config->model_invoke_logits) {
+        TfLiteTensor logits;
+        if (graph_config->model_logits(instance, &logits) != kTfLiteOk) {
+            return EI_IMPULSE_TFLITE_ERROR;
+        }
+        ei_classification_thresholds_i8(threshold, impulse->label_count, logits.params.scale,
+            output->params.scale, output->params.zero_point, &thresholds);
+        settled = ei_classification_decide_i8(logits.data.int8, impulse->label_count, &thresholds, decision);
+        softmax = !settled || (probabilities && decision->above_threshold);
+        if (softmax && graph_config->model_invoke_softmax(instance) != kTfLiteOk) {
+            return EI_IMPULSE_TFLITE_ERROR;
+        }
+    }
+    else {
+        ei_classification_thresholds_i8(threshold, impulse->label_count, 0,
+            output->params.scale, output->params.zero_point, &thresholds);
+        ei_classification_decide_i8(output->data.int8, impulse->label_count, &thresholds, decision);
+    }
+
+    if (!settled) {
+        decision->above_threshold = output->data.int8[decision->label] > thresholds.probability_threshold;
+    }
+    decision->probabilities = softmax && probabilities;
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Like run_nn_inference_quantized_features(), but only decides on the top label
+ * (ei_classification_decide_i8()): the model runs as far as the logits, the
+ * input of its final softmax. The softmax runs when the logits leave open
+ * whether that label is above threshold, or, with probabilities, when it is;
+ * with probabilities the outputs then go to result (decision->probabilities).
+ * A model without a final softmax runs in full and decides on its output.
+ */
+EI_IMPULSE_ERROR run_nn_decide_quantized_features(
+    const ei_impulse_t *impulse,
+    const int8_t *features,
+    float threshold,
+    bool probabilities,
+    uint32_t learn_block_index,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance,
+    bool session_open,
+    bool debug = false) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    uint64_t ctx_start_us;
+    TfLiteTensor input;
+    TfLiteTensor *outputs;
+
+    ei_unique_ptr_t p_outputs(nullptr, ei_free);
+    EI_IMPULSE_ERROR res = inference_tflite_alloc_outputs(block_config, context, &outputs, p_outputs);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
+    res = inference_tflite_setup(block_config, instance, session_open, &ctx_start_us, &input, &outputs, p_tensor_arena);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    res = inference_tflite_fill_input_quantized(impulse, nullptr, nullptr, features, &input, result, debug);
+    if (res != EI_IMPULSE_OK) {
+        inference_tflite_teardown(block_config, instance, session_open);
+        return res;
+    }
+
+    ctx_start_us = ei_read_timer_us();
+
+    // the probabilities of the (only) output; outputs[0] is valid before the
+    // softmax runs, only its data is not
+    TfLiteTensor *output = &outputs[0];
+    if (output->type != kTfLiteInt8) {
+        inference_tflite_teardown(block_config, instance, session_open);
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    TfLiteStatus status;
+    if (graph_config->model_invoke_logits) {
+        status = graph_config->model_invoke_logits(instance);
+    }
+    else {
+        status = instance ? graph_config->model_instance_invoke(instance) : graph_config->model_invoke();
+    }
+    if (status != kTfLiteOk) {
+        inference_tflite_teardown(block_config, instance, session_open);
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    res = inference_tflite_decide(impulse, graph_config, instance, threshold, probabilities, output, decision);
+    if (res != EI_IMPULSE_OK) {
+        inference_tflite_teardown(block_config, instance, session_open);
+        return res;
+    }
+
+    result->timing.classification_us = ei_read_timer_us() - ctx_start_us;
+    result->timing.classification = (int)(result->timing.classification_us / 1000);
+
+    if (decision->probabilities) {
+        res = inference_tflite_copy_outputs(block_config, outputs, learn_block_index, result, context);
+    }
+
+    inference_tflite_teardown(block_config, instance, session_open);
+
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    if (ei_run_impulse_check_canceled() == EI_IMPULSE_CANCELED) {
+        return EI_IMPULSE_CANCELED;
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Copy features that run_nn_quantize_image() produced into the input tensor and
+ * start an inference that run_nn_step() runs a few nodes at a time, as far as
+ * the logits when the model has them. The model has to stay set up between the
+ * calls: an instance, or the model with an open session (run_nn_open_session()).
+ * An inference still under way on it is dropped.
+ */
+EI_IMPULSE_ERROR run_nn_start_quantized_features(
+    const ei_impulse_t *impulse,
+    const int8_t *features,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    void *instance,
+    bool session_open,
+    bool debug = false) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (!graph_config->model_invoke_step) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+    // without a session the model is torn down at the end of every call
+    if (!instance && !session_open) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+    TfLiteTensor input;
+    TfLiteStatus status = instance ? graph_config->model_instance_input(instance, 0, &input) :
+        graph_config->model_input(0, &input);
+    if (status != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    EI_IMPULSE_ERROR res = inference_tflite_fill_input_quantized(impulse, nullptr, nullptr, features, &input, result, debug);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    status = graph_config->model_invoke_start(instance, graph_config->model_invoke_logits != nullptr);
+    return status == kTfLiteOk ? EI_IMPULSE_OK : EI_IMPULSE_TFLITE_ERROR;
+}
+
+/**
+ * Run the next nodes of the inference run_nn_start_quantized_features() started:
+ * at most max_nodes (0 for no limit), and no new one once budget_us (0 for none)
+ * has gone by, at least one. Nodes are never split, so a step can overrun
+ * budget_us by one node. The time adds to result->timing. *done once the logits,
+ * or the outputs, are there. A canceled impulse drops the inference.
+ */
+EI_IMPULSE_ERROR run_nn_step(
+    size_t max_nodes,
+    uint32_t budget_us,
+    bool *done,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    void *instance) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    *done = false;
+    if (!graph_config->model_invoke_step) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    uint64_t start_us = ei_read_timer_us();
+    TfLiteStatus status = graph_config->model_invoke_step(instance, max_nodes, budget_us, done);
+    result->timing.classification_us += ei_read_timer_us() - start_us;
+    result->timing.classification = (int)(result->timing.classification_us / 1000);
+    if (status != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    if (ei_run_impulse_check_canceled() == EI_IMPULSE_CANCELED) {
+        graph_config->model_invoke_abort(instance);
+        *done = false;
+        return EI_IMPULSE_CANCELED;
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * EI_IMPULSE_OK once run_nn_step() has run the last node of the inference
+ * run_nn_start_quantized_features() started and nothing has invoked the model
+ * since, EI_IMPULSE_INFERENCE_ERROR otherwise (still stepping, aborted, never
+ * started): the outputs would be those of an earlier inference
+ */
+static EI_IMPULSE_ERROR inference_tflite_check_completed(ei_config_tflite_eon_graph_t *graph_config, void *instance) {
+    if (!graph_config->model_invoke_completed) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+    bool completed = false;
+    if (graph_config->model_invoke_completed(instance, &completed) != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+    return completed ? EI_IMPULSE_OK : EI_IMPULSE_INFERENCE_ERROR;
+}
+
+/**
+ * Once run_nn_step() is done: the softmax over the logits, if the steps stopped
+ * there, and the outputs into result, as from run_nn_inference_quantized_features()
+ */
+EI_IMPULSE_ERROR run_nn_finish_quantized(
+    uint32_t learn_block_index,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    EI_IMPULSE_ERROR res = inference_tflite_check_completed(graph_config, instance);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    TfLiteTensor *outputs;
+    ei_unique_ptr_t p_outputs(nullptr, ei_free);
+    res = inference_tflite_alloc_outputs(block_config, context, &outputs, p_outputs);
+    if (res == EI_IMPULSE_OK) {
+        res = inference_tflite_outputs(block_config, instance, outputs);
+    }
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    if (graph_config->model_invoke_logits) {
+        uint64_t start_us = ei_read_timer_us();
+        if (graph_config->model_invoke_softmax(instance) != kTfLiteOk) {
+            return EI_IMPULSE_TFLITE_ERROR;
+        }
+        result->timing.classification_us += ei_read_timer_us() - start_us;
+        result->timing.classification = (int)(result->timing.classification_us / 1000);
+    }
+
+    return inference_tflite_copy_outputs(block_config, outputs, learn_block_index, result, context);
+}
+
+/**
+ * Once run_nn_step() is done: decide on the top label as
+ * run_nn_decide_quantized_features() does, the outputs go to result when
+ * decision->probabilities
+ */
+EI_IMPULSE_ERROR run_nn_finish_decide_quantized(
+    const ei_impulse_t *impulse,
+    float threshold,
+    bool probabilities,
+    uint32_t learn_block_index,
+    ei_impulse_decision_t *decision,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    ei_inference_context_t *context,
+    void *instance) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    EI_IMPULSE_ERROR res = inference_tflite_check_completed(graph_config, instance);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    TfLiteTensor *outputs;
+    ei_unique_ptr_t p_outputs(nullptr, ei_free);
+    res = inference_tflite_alloc_outputs(block_config, context, &outputs, p_outputs);
+    if (res == EI_IMPULSE_OK) {
+        res = inference_tflite_outputs(block_config, instance, outputs);
+    }
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    if (outputs[0].type != kTfLiteInt8) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+
+    uint64_t start_us = ei_read_timer_us();
+    res = inference_tflite_decide(impulse, graph_config, instance, threshold, probabilities, &outputs[0], decision);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+    result->timing.classification_us += ei_read_timer_us() - start_us;
+    result->timing.classification = (int)(result->timing.classification_us / 1000);
+
+    if (decision->probabilities) {
+        return inference_tflite_copy_outputs(block_config, outputs, learn_block_index, result, context);
+    }
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * Drop the inference run_nn_step() is working through, the next one starts with
+ * run_nn_start_quantized_features()
+ */
+EI_IMPULSE_ERROR run_nn_abort(void *config_ptr, void *instance) {
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (!graph_config->model_invoke_abort) {
+        return EI_IMPULSE_UNSUPPORTED_INFERENCING_ENGINE;
+    }
+    return graph_config->model_invoke_abort(instance) == kTfLiteOk ? EI_IMPULSE_OK : EI_IMPULSE_TFLITE_ERROR;
+}
+
+/**
+ * A batch of images for run_nn_inference_batch(), shared by its workers
+ */
+typedef struct {
+    const ei_impulse_t *impulse;
+    ei_learning_block_config_tflite_graph_t *block_config;
+    signal_t *signals;
+    const image_source_t *images;
+    ei_impulse_result_t *results;
+    void **instances;
+    TfLiteTensor *outputs; // output_tensors_size per image
+    size_t count;
+    bool debug;
+    EI_IMPULSE_ERROR status[EI_CLASSIFIER_PARALLEL_WORKERS];
+} inference_tflite_batch_t;
+
+/**
+ * Worker of run_nn_inference_batch(): quantizes its share of the images one by
+ * one, then runs them through the model together
+ */
+static void inference_tflite_batch_worker(void *arg, int worker, int workers) {
+    inference_tflite_batch_t *batch = (inference_tflite_batch_t*)arg;
+    ei_learning_block_config_tflite_graph_t *block_config = batch->block_config;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+    const size_t start = batch->count * worker / workers;
+    const size_t end = batch->count * (worker + 1) / workers;
+    EI_IMPULSE_ERROR *status = &batch->status[worker];
+
+    *status = EI_IMPULSE_OK;
+    if (start == end) {
+        return;
+    }
+
+    for (size_t ix = start; ix < end; ix++) {
+        uint64_t ctx_start_us;
+        TfLiteTensor input;
+        TfLiteTensor *outputs = &batch->outputs[ix * block_config->output_tensors_size];
+        ei_unique_ptr_t p_tensor_arena(nullptr, ei_aligned_free);
+
+        *status = inference_tflite_setup(block_config, batch->instances[ix], false, &ctx_start_us, &input, &outputs, p_tensor_arena);
+        if (*status != EI_IMPULSE_OK) {
+            return;
+        }
+        *status = inference_tflite_fill_input_quantized(batch->impulse,
+            batch->signals ? &batch->signals[ix] : nullptr, batch->images ? &batch->images[ix] : nullptr,
+            nullptr, &input, &batch->results[ix], batch->debug);
+        if (*status != EI_IMPULSE_OK) {
+            return;
+        }
+    }
+
+    uint64_t ctx_start_us = ei_read_timer_us();
+    if (graph_config->model_instance_invoke_batch(&batch->instances[start], end - start) != kTfLiteOk) {
+        *status = EI_IMPULSE_TFLITE_ERROR;
+        return;
+    }
+    // every image of the batch gets an equal share of the time
+    const uint64_t classification_us = (ei_read_timer_us() - ctx_start_us) / (end - start);
+
+    for (size_t ix = start; ix < end; ix++) {
+        ei_impulse_result_t *result = &batch->results[ix];
+        result->timing.classification_us = classification_us;
+        result->timing.classification = (int)(classification_us / 1000);
+        *status = inference_tflite_copy_outputs(block_config, &batch->outputs[ix * block_config->output_tensors_size],
+            0, result, nullptr);
+        if (*status != EI_IMPULSE_OK) {
+            return;
+        }
+    }
+}
+
+/**
+ * Run count images, from signals or images (the other one is nullptr), through
+ * the model together, image ix on instances[ix] (run_nn_open_instance()). The
+ * model runs layer by layer over the batch, so the weights of a layer are read
+ * once for all images. With EI_CLASSIFIER_PARALLEL_WORKERS above 1 the images
+ * are split across the workers instead of the rows of every layer. The quantized
+ * input and the scores are those of run_nn_inference_image_source(). results[ix]
+ * needs its _raw_outputs.
+ */
+EI_IMPULSE_ERROR run_nn_inference_batch(
+    const ei_impulse_t *impulse,
+    signal_t *signals,
+    const image_source_t *images,
+    size_t count,
+    ei_impulse_result_t *results,
+    void *config_ptr,
+    void **instances,
+    bool debug = false) {
+
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+
+    if (count == 0) {
+        return EI_IMPULSE_OK;
+    }
+
+    ei_unique_ptr_t p_outputs(ei_malloc(count * block_config->output_tensors_size * sizeof(TfLiteTensor)), ei_free);
+    if (!p_outputs) {
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
+
+    inference_tflite_batch_t batch;
+    batch.impulse = impulse;
+    batch.block_config = block_config;
+    batch.signals = signals;
+    batch.images = images;
+    batch.results = results;
+    batch.instances = instances;
+    batch.outputs = static_cast<TfLiteTensor*>(p_outputs.get());
+    batch.count = count;
+    batch.debug = debug;
+
+    const int workers = count < EI_CLASSIFIER_PARALLEL_WORKERS ? (int)count : EI_CLASSIFIER_PARALLEL_WORKERS;
+    if (workers <= 1 || ei_parallel_run(inference_tflite_batch_worker, &batch, workers) != EI_IMPULSE_OK) {
+        for (int worker = 0; worker < workers; worker++) {
+            inference_tflite_batch_worker(&batch, worker, workers);
+        }
+    }
+
+    for (int worker = 0; worker < workers; worker++) {
+        if (batch.status[worker] != EI_IMPULSE_OK) {
+            return batch.status[worker];
+        }
+    }
+
+    if (ei_run_impulse_check_canceled() == EI_IMPULSE_CANCELED) {
+        return EI_IMPULSE_CANCELED;
+    }
+
+    return EI_IMPULSE_OK;
+}
+#endif // EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
+
+/**
+ * @brief      Initialize the compiled graph once and keep it alive
+ *
+ * Allocates the tensor arena, registers the operators and runs init/prepare
+ * for every node. Until run_nn_close_session() is called, the calls that get
+ * session_open set (run_nn_inference_session() and friends) reuse the prepared
+ * graph instead of initializing and resetting it around every invoke. The
+ * caller keeps track of whether the session is open.
+ *
+ * @param      config_ptr  Learning block config
+ *
+ * @return     The ei impulse error.
+ */
+EI_IMPULSE_ERROR run_nn_open_session(void *config_ptr)
+{
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    TfLiteStatus init_status = graph_config->model_init(ei_aligned_calloc);
+    if (init_status != kTfLiteOk) {
+        ei_printf("Failed to initialize the model (error code %d)\n", init_status);
+        // init may have allocated the arena before failing
+        graph_config->model_reset(ei_aligned_free);
+        return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+    }
+
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Release a graph opened with run_nn_open_session()
+ *
+ * @param      config_ptr  Learning block config
+ *
+ * @return     The ei impulse error.
+ */
+EI_IMPULSE_ERROR run_nn_close_session(void *config_ptr)
+{
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (graph_config->model_reset(ei_aligned_free) != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Set up a copy of the compiled graph with its own arena and op data
+ *
+ * Unlike run_nn_open_session() this does not touch the model itself: every
+ * instance, and the model, can run an inference at the same time as the
+ * others, each on its own thread.
+ *
+ * @param      config_ptr  Learning block config
+ * @param[out] instance    Receives the instance, nullptr when this fails
+ *
+ * @return     The ei impulse error.
+ */
+EI_IMPULSE_ERROR run_nn_open_instance(void *config_ptr, void **instance)
+{
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    *instance = nullptr;
+    void *new_instance = nullptr;
+    TfLiteStatus init_status = graph_config->model_instance_init(&new_instance, ei_aligned_calloc);
+    if (init_status != kTfLiteOk) {
+        ei_printf("Failed to initialize the model instance (error code %d)\n", init_status);
+        graph_config->model_instance_reset(new_instance, ei_aligned_free);
+        return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+    }
+
+    *instance = new_instance;
+
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Release an instance from run_nn_open_instance()
+ *
+ * @param      config_ptr  Learning block config
+ * @param      instance    The instance, can be nullptr
+ *
+ * @return     The ei impulse error.
+ */
+EI_IMPULSE_ERROR run_nn_close_instance(void *config_ptr, void *instance)
+{
+    ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
+    ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
+
+    if (!instance) {
+        return EI_IMPULSE_OK;
+    }
+
+    if (graph_config->model_instance_reset(instance, ei_aligned_free) != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    return EI_IMPULSE_OK;
+}
 
 __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
     ei_dsp_config_tflite_eon_t *dsp_config = (ei_dsp_config_tflite_eon_t*)config_ptr;
@@ -453,6 +1385,25 @@ __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix
         .model_reset = dsp_config->reset_fn,
         .model_input = dsp_config->input_fn,
         .model_output = dsp_config->output_fn,
+        // a DSP block model is only set up, invoked and released
+        .model_input_quantization = nullptr,
+        .model_instance_init = nullptr,
+        .model_instance_invoke = nullptr,
+        .model_instance_invoke_batch = nullptr,
+        .model_instance_reset = nullptr,
+        .model_instance_input = nullptr,
+        .model_instance_output = nullptr,
+        .model_invoke_logits = nullptr,
+        .model_logits = nullptr,
+        .model_invoke_softmax = nullptr,
+        .model_invoke_start = nullptr,
+        .model_invoke_step = nullptr,
+        .model_invoke_abort = nullptr,
+        .model_invoke_completed = nullptr,
+#if EI_CLASSIFIER_PROFILE_OPS
+        .model_profile = nullptr,
+        .model_profile_reset = nullptr,
+#endif
     };
 
     const uint8_t ei_output_tensor_indices[1] = { 0 };
@@ -465,7 +1416,8 @@ __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix
         .output_tensors_size = ei_output_tensor_size,
         .quantized = 0,
         .compiled = 1,
-        .graph_config = &ei_config_tflite_graph_0
+        .graph_config = &ei_config_tflite_graph_0,
+        .dequantize_output = 0,
     };
 
     auto x = run_nn_inference_from_dsp(&ei_learning_block_config, signal, output_matrix);
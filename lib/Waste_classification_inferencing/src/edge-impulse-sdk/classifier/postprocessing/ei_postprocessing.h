@@ -36,6 +36,7 @@
 #define EI_POSTPROCESSING_H
 
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/classifier/ei_inference_context.h"
 
 #if EI_CLASSIFIER_CALIBRATION_ENABLED
 #include "edge-impulse-sdk/classifier/postprocessing/ei_performance_calibration.h"
@@ -123,8 +124,11 @@ extern "C" EI_IMPULSE_ERROR run_postprocessing(ei_impulse_handle_t *handle,
         }
     }
 
-    // free raw results
+    // free raw results, unless they live in the context
     for (size_t ix = 0; ix < impulse->output_tensors_size; ix++) {
+        if (handle->context && handle->context->owns(result->_raw_outputs[ix].matrix)) {
+            result->_raw_outputs[ix].matrix = nullptr;
+        }
         if (result->_raw_outputs[ix].matrix) {
             delete result->_raw_outputs[ix].matrix;
             result->_raw_outputs[ix].matrix = nullptr;
@@ -42,6 +42,7 @@
 #include "edge-impulse-sdk/classifier/ei_classifier_types.h"
 #include "edge-impulse-sdk/classifier/ei_nms.h"
 #include "edge-impulse-sdk/dsp/ei_vector.h"
+#include <math.h>
 #include <string>
 
 int16_t get_block_number(ei_impulse_handle_t *handle, void *init_func)
@@ -292,6 +293,96 @@ __attribute__((unused)) static EI_IMPULSE_ERROR process_classification_u8(ei_imp
     return EI_IMPULSE_OK;
 }
 
+/**
+ * A probability threshold mapped onto the quantized logits and probabilities
+ * of a classifier, see ei_classification_thresholds_i8()
+ */
+typedef struct {
+    // margins (best minus second best quantized logit) above which the best
+    // label is above the threshold, and up to which it is not
+    int32_t above_margin;
+    int32_t below_margin;
+    // quantized probabilities above this are above the threshold
+    int32_t probability_threshold;
+} ei_classification_thresholds_i8_t;
+
+/**
+ * Map threshold onto the quantized domain of a classifier of label_count labels
+ * that ends in a softmax. With d the best minus the second best logit, the
+ * probability of the best label lies between 1 / (1 + (label_count - 1) e^-d)
+ * and 1 / (1 + e^-d), whatever the other logits are, so the margin alone
+ * settles most decisions. Both margins stay two steps of the quantized
+ * probability away from the threshold, which covers the rounding of the int8
+ * softmax. A logit_scale of 0 (no logits) leaves every decision to the
+ * probabilities.
+ */
+__attribute__((unused)) static void ei_classification_thresholds_i8(float threshold,
+                                                                    uint32_t label_count,
+                                                                    float logit_scale,
+                                                                    float probability_scale,
+                                                                    int32_t probability_zero_point,
+                                                                    ei_classification_thresholds_i8_t *thresholds) {
+    // the same comparison as on the dequantized probability
+    thresholds->probability_threshold = 127;
+    for (int32_t q = -128; q <= 127; q++) {
+        if (static_cast<float>(q - probability_zero_point) * probability_scale > threshold) {
+            thresholds->probability_threshold = q - 1;
+            break;
+        }
+    }
+
+    // margins are never negative: -1 is never below, INT32_MAX never above
+    const float high = threshold + 2 * probability_scale;
+    const float low = threshold - 2 * probability_scale;
+    if (logit_scale <= 0 || high >= 1.0f) {
+        thresholds->above_margin = INT32_MAX;
+    }
+    else if (label_count < 2 || high <= 0) {
+        thresholds->above_margin = -1;
+    }
+    else {
+        float margin = floorf(logf((label_count - 1) * high / (1.0f - high)) / logit_scale);
+        thresholds->above_margin = margin < -1 ? -1 : margin > 1e9f ? INT32_MAX : static_cast<int32_t>(margin);
+    }
+    if (logit_scale <= 0 || low <= 0) {
+        thresholds->below_margin = -1;
+    }
+    else if (low >= 1.0f) {
+        thresholds->below_margin = INT32_MAX;
+    }
+    else {
+        float margin = floorf(logf(low / (1.0f - low)) / logit_scale);
+        thresholds->below_margin = margin < -1 ? -1 : margin > 1e9f ? INT32_MAX : static_cast<int32_t>(margin);
+    }
+}
+
+/**
+ * Top-1 decision on count quantized logits (argmax and margin), without
+ * dequantizing them. Returns whether the margin settles above_threshold;
+ * if not, the softmax has to, see ei_classification_thresholds_i8_t.
+ */
+__attribute__((unused)) static bool ei_classification_decide_i8(const int8_t *logits,
+                                                                uint32_t count,
+                                                                const ei_classification_thresholds_i8_t *thresholds,
+                                                                ei_impulse_decision_t *decision) {
+    uint32_t best = 0;
+    int32_t second = INT32_MIN;
+    for (uint32_t ix = 1; ix < count; ix++) {
+        if (logits[ix] > logits[best]) {
+            second = logits[best];
+            best = ix;
+        }
+        else if (logits[ix] > second) {
+            second = logits[ix];
+        }
+    }
+
+    decision->label = static_cast<int16_t>(best);
+    decision->margin = second == INT32_MIN ? 0 : logits[best] - second;
+    decision->above_threshold = decision->margin > thresholds->above_margin;
+    return decision->above_threshold || decision->margin <= thresholds->below_margin;
+}
+
 #if EI_CLASSIFIER_FREEFORM_OUTPUT == 1
 /**
  * Fill the result structure from an unquantized output tensor
@@ -77,6 +77,14 @@
     #endif
 #endif // EIDSP_USE_NEON
 
+#ifndef EIDSP_USE_SSE2
+    #if defined(__SSE2__)
+        #define EIDSP_USE_SSE2      1
+    #else
+        #define EIDSP_USE_SSE2      0
+    #endif
+#endif // EIDSP_USE_SSE2
+
 #ifndef EIDSP_USE_ASSERTS
 #define EIDSP_USE_ASSERTS        0
 #endif // EIDSP_USE_ASSERTS
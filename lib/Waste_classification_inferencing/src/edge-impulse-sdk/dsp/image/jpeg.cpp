@@ -0,0 +1,1125 @@
+/*
+ * Copyright (c) 2024 EdgeImpulse Inc.
+ *
+ * Generated by Edge Impulse and licensed under the applicable Edge Impulse
+ * Terms of Service. Community and Professional Terms of Service
+ * (https://edgeimpulse.com/legal/terms-of-service) or Enterprise Terms of
+ * Service (https://edgeimpulse.com/legal/enterprise-terms-of-service),
+ * according to your product plan subscription (the “License”).
+ *
+ * This software, documentation and other associated files (collectively referred
+ * to as the “Software”) is a single SDK variation generated by the Edge Impulse
+ * platform and requires an active paid Edge Impulse subscription to use this
+ * Software for any purpose.
+ *
+ * You may NOT use this Software unless you have an active Edge Impulse subscription
+ * that meets the eligibility requirements for the applicable License, subject to
+ * your full and continued compliance with the terms and conditions of the License,
+ * including without limitation any usage restrictions under the applicable License.
+ *
+ * If you do not have an active Edge Impulse product plan subscription, or if use
+ * of this Software exceeds the usage limitations of your Edge Impulse product plan
+ * subscription, you are not permitted to use this Software and must immediately
+ * delete and erase all copies of this Software within your control or possession.
+ * Edge Impulse reserves all rights and remedies available to enforce its rights.
+ *
+ * Unless required by applicable law or agreed to in writing, the Software is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific language governing
+ * permissions, disclaimers and limitations under the License.
+ */
+#include "edge-impulse-sdk/dsp/image/jpeg.hpp"
+#include "edge-impulse-sdk/dsp/ei_utils.h"
+#include "edge-impulse-sdk/dsp/returntypes.hpp"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/dsp/memory.hpp"
+#include <string.h>
+#include <stddef.h>
+
+namespace ei {
+namespace image {
+namespace jpeg {
+
+namespace {
+
+constexpr int MAX_COMPONENTS = 3;
+constexpr int HUFF_LOOKAHEAD = 9;
+
+constexpr int CONST_BITS = 13;
+constexpr int PASS1_BITS = 2;
+
+// DC of a baseline scan has 11 bits; corrupt differences are held to that range
+constexpr int32_t DC_MAX = 2047;
+// largest DCT coefficient of 8-bit samples (1024) plus half the largest 8-bit
+// quantizer step. Corrupt coefficients are held to it, which keeps every
+// intermediate of the 8x8 inverse DCT within 32 bits
+constexpr int32_t DEQUANT_MAX = 1024 + 128;
+
+// position of the k-th zigzag coefficient in a row major block, padded so corrupt
+// run lengths land on coefficient 63 instead of out of bounds
+const uint8_t natural_order[64 + 16] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+    63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63
+};
+
+// (rows << 4) | columns of the block area holding the first k + 1 zigzag coefficients
+const uint8_t zigzag_extent[64] = {
+    0x11, 0x12, 0x22, 0x32, 0x32, 0x33, 0x34, 0x34,
+    0x34, 0x44, 0x54, 0x54, 0x54, 0x54, 0x55, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x66, 0x76, 0x76, 0x76,
+    0x76, 0x76, 0x76, 0x77, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+};
+
+// Annex K tables, used when a frame has no DHT segment (e.g. Motion JPEG)
+const uint8_t std_dc_luminance_counts[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+const uint8_t std_dc_chrominance_counts[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+const uint8_t std_dc_symbols[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+const uint8_t std_ac_luminance_counts[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+const uint8_t std_ac_luminance_symbols[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa
+};
+
+const uint8_t std_ac_chrominance_counts[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+const uint8_t std_ac_chrominance_symbols[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa
+};
+
+// Reduced size inverse DCT: every output pixel is the average of a k x k (k = 8 / N)
+// square of the full 8x8 inverse DCT, which is again separable with the basis
+// T[x][u] = 0.5 * c(u) * mean(cos((2 * (k * x + j) + 1) * u * pi / 16), j < k) << CONST_BITS.
+// Only x < N / 2 is stored, T[N - 1 - x][u] = (-1)^u * T[x][u].
+const int16_t idct_table_4[2][8] = {
+    { 2896, 3711,  2676,  1303, 0,  -871, -1108, -738 },
+    { 2896, 1537, -2676, -3146, 0,  2102,  1108, -306 }
+};
+const int16_t idct_table_2[1][8] = {
+    { 2896, 2624,     0,  -922, 0,   616,     0, -522 }
+};
+
+typedef struct {
+    uint8_t fast_size[1 << HUFF_LOOKAHEAD]; // length of the code with this prefix, 0 if longer
+    uint8_t fast_symbol[1 << HUFF_LOOKAHEAD];
+    int32_t maxcode[17]; // largest code of each length, -1 if none
+    int32_t valoffset[17]; // symbol index minus code, per length
+    uint8_t symbols[256];
+    bool loaded;
+} huffman_table_t;
+
+typedef struct {
+    int id;
+    int h;
+    int v;
+    int tq;
+    int td;
+    int ta;
+    int32_t dc_pred;
+    int block_size; // inverse DCT size, 8 / scale or larger for subsampled components
+    uint8_t *plane; // one MCU row of samples, scaled
+    int plane_stride;
+    int x_shift; // log2(hmax / h), -1 if not a power of two
+    int y_shift;
+} component_t;
+
+typedef struct {
+    int width;
+    int height;
+    int component_count;
+    component_t components[MAX_COMPONENTS];
+    int hmax;
+    int vmax;
+    int restart_interval;
+    uint16_t qt[4][64]; // row major
+    bool qt_loaded[4];
+    huffman_table_t dc[4];
+    huffman_table_t ac[4];
+    // AC codes that fit the lookahead together with their value:
+    // value << 8 | run << 4 | total length, 0 if not
+    int16_t ac_fast[4][1 << HUFF_LOOKAHEAD];
+} decoder_t;
+
+static_assert(sizeof(decoder_t) <= DECODER_STATE_SIZE, "DECODER_STATE_SIZE too small");
+
+typedef struct {
+    const uint8_t *ptr;
+    const uint8_t *end;
+    uint32_t acc; // MSB aligned
+    int count;
+} bit_reader_t;
+
+typedef struct {
+    int marker;
+    const uint8_t *data;
+    int length;
+} segment_t;
+
+inline int read_u16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+inline uint8_t clamp_u8(int32_t v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v);
+}
+
+inline int32_t descale(int32_t x, int n)
+{
+    return (x + (1 << (n - 1))) >> n;
+}
+
+inline int32_t dequantize(int16_t coef, uint16_t q)
+{
+    // |coef * q| < 2^31 even for 16-bit tables
+    int32_t v = coef * (int32_t)q;
+    return v < -DEQUANT_MAX ? -DEQUANT_MAX : (v > DEQUANT_MAX ? DEQUANT_MAX : v);
+}
+
+/**
+ * @brief Find the next marker segment. Stand-alone markers (SOI, RSTn) are skipped,
+ * EOI returns EIDSP_OUT_OF_BOUNDS as there is no scan left to find.
+ */
+int next_segment(const uint8_t *&p, const uint8_t *end, segment_t *segment)
+{
+    while (true) {
+        while (p < end && *p != 0xff) {
+            p++;
+        }
+        while (p < end && *p == 0xff) {
+            p++;
+        }
+        if (p >= end) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        int marker = *p++;
+        if (marker == 0xd8 || marker == 0x01 || (marker >= 0xd0 && marker <= 0xd7)) {
+            continue;
+        }
+        if (marker == 0xd9 || end - p < 2) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        int length = read_u16(p);
+        if (length < 2 || length > end - p) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        segment->marker = marker;
+        segment->data = p + 2;
+        segment->length = length - 2;
+        p += length;
+        return EIDSP_OK;
+    }
+}
+
+bool is_unsupported_frame(int marker)
+{
+    // progressive, lossless, hierarchical and arithmetic coded frames
+    return (marker >= 0xc2 && marker <= 0xcf && marker != 0xc4 && marker != 0xc8 && marker != 0xcc);
+}
+
+int parse_frame(const segment_t *segment, decoder_t *dec)
+{
+    const uint8_t *s = segment->data;
+    if (segment->length < 6) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+    if (s[0] != 8) {
+        return EIDSP_NOT_SUPPORTED;
+    }
+    dec->height = read_u16(s + 1);
+    dec->width = read_u16(s + 3);
+    dec->component_count = s[5];
+    // height 0 means a DNL segment follows the scan, not used by cameras
+    if (dec->width == 0 || dec->height == 0) {
+        return EIDSP_NOT_SUPPORTED;
+    }
+    if (dec->component_count != 1 && dec->component_count != 3) {
+        return EIDSP_NOT_SUPPORTED;
+    }
+    if (segment->length < 6 + 3 * dec->component_count) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+    dec->hmax = 1;
+    dec->vmax = 1;
+    for (int i = 0; i < dec->component_count; i++) {
+        component_t *c = &dec->components[i];
+        c->id = s[6 + i * 3];
+        c->h = s[7 + i * 3] >> 4;
+        c->v = s[7 + i * 3] & 15;
+        c->tq = s[8 + i * 3];
+        if (c->h < 1 || c->h > 4 || c->v < 1 || c->v > 4 || c->tq > 3) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+        dec->hmax = c->h > dec->hmax ? c->h : dec->hmax;
+        dec->vmax = c->v > dec->vmax ? c->v : dec->vmax;
+    }
+    // a single component scan is not interleaved, its MCU is one block whatever the sampling
+    if (dec->component_count == 1) {
+        dec->components[0].h = dec->components[0].v = 1;
+        dec->hmax = dec->vmax = 1;
+    }
+    return EIDSP_OK;
+}
+
+int parse_quantization_tables(const segment_t *segment, decoder_t *dec)
+{
+    const uint8_t *s = segment->data;
+    const uint8_t *end = s + segment->length;
+    while (s < end) {
+        int precision = *s >> 4;
+        int index = *s & 15;
+        s++;
+        if (index > 3 || precision > 1) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+        if (end - s < 64 * (precision + 1)) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        for (int k = 0; k < 64; k++) {
+            dec->qt[index][natural_order[k]] = precision ? read_u16(s + 2 * k) : s[k];
+        }
+        s += 64 * (precision + 1);
+        dec->qt_loaded[index] = true;
+    }
+    return EIDSP_OK;
+}
+
+int build_huffman_table(huffman_table_t *table, const uint8_t *counts, const uint8_t *symbols)
+{
+    int total = 0;
+    for (int i = 0; i < 16; i++) {
+        total += counts[i];
+    }
+    if (total > 256) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    memcpy(table->symbols, symbols, total);
+    memset(table->fast_size, 0, sizeof(table->fast_size));
+
+    int32_t code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        table->valoffset[len] = k - code;
+        for (int i = 0; i < counts[len - 1]; i++, k++, code++) {
+            if (len <= HUFF_LOOKAHEAD) {
+                int shift = HUFF_LOOKAHEAD - len;
+                for (int j = 0; j < (1 << shift); j++) {
+                    table->fast_size[(code << shift) | j] = (uint8_t)len;
+                    table->fast_symbol[(code << shift) | j] = symbols[k];
+                }
+            }
+        }
+        table->maxcode[len] = counts[len - 1] ? code - 1 : -1;
+        if (code > (1 << len)) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+        code <<= 1;
+    }
+    table->loaded = true;
+    return EIDSP_OK;
+}
+
+void build_ac_fast_table(const huffman_table_t *table, int16_t *fast)
+{
+    for (int i = 0; i < (1 << HUFF_LOOKAHEAD); i++) {
+        fast[i] = 0;
+        int len = table->fast_size[i];
+        if (len == 0) {
+            continue;
+        }
+        int run = table->fast_symbol[i] >> 4;
+        int size = table->fast_symbol[i] & 15;
+        if (size == 0 || len + size > HUFF_LOOKAHEAD) {
+            continue;
+        }
+        int value = ((i << len) & ((1 << HUFF_LOOKAHEAD) - 1)) >> (HUFF_LOOKAHEAD - size);
+        if (value < (1 << (size - 1))) {
+            value -= (1 << size) - 1;
+        }
+        if (value >= -128 && value <= 127) {
+            fast[i] = (int16_t)(value * 256 + (run << 4) + len + size);
+        }
+    }
+}
+
+int parse_huffman_tables(const segment_t *segment, decoder_t *dec)
+{
+    const uint8_t *s = segment->data;
+    const uint8_t *end = s + segment->length;
+    while (s < end) {
+        if (end - s < 17) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        int type = *s >> 4;
+        int index = *s & 15;
+        if (type > 1 || index > 3) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+        const uint8_t *counts = s + 1;
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            total += counts[i];
+        }
+        if (end - s < 17 + total) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        int res = build_huffman_table(type ? &dec->ac[index] : &dec->dc[index], counts, s + 17);
+        if (res != EIDSP_OK) {
+            return res;
+        }
+        if (type) {
+            build_ac_fast_table(&dec->ac[index], dec->ac_fast[index]);
+        }
+        s += 17 + total;
+    }
+    return EIDSP_OK;
+}
+
+int parse_scan(const segment_t *segment, decoder_t *dec)
+{
+    const uint8_t *s = segment->data;
+    if (segment->length < 1) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+    int count = s[0];
+    if (segment->length < 4 + 2 * count) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+    // one interleaved scan with every component; separate scans per component are legal
+    // baseline but not produced by any camera we target
+    if (count != dec->component_count) {
+        return EIDSP_NOT_SUPPORTED;
+    }
+    for (int i = 0; i < count; i++) {
+        component_t *c = &dec->components[i];
+        if (s[1 + i * 2] != c->id) {
+            return EIDSP_NOT_SUPPORTED;
+        }
+        c->td = s[2 + i * 2] >> 4;
+        c->ta = s[2 + i * 2] & 15;
+        if (c->td > 3 || c->ta > 3) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+    }
+    const uint8_t *spectral = s + 1 + 2 * count;
+    if (spectral[0] != 0 || spectral[1] != 63 || spectral[2] != 0) {
+        return EIDSP_NOT_SUPPORTED;
+    }
+
+    if (!dec->dc[0].loaded && !dec->ac[0].loaded) {
+        build_huffman_table(&dec->dc[0], std_dc_luminance_counts, std_dc_symbols);
+        build_huffman_table(&dec->ac[0], std_ac_luminance_counts, std_ac_luminance_symbols);
+        build_huffman_table(&dec->dc[1], std_dc_chrominance_counts, std_dc_symbols);
+        build_huffman_table(&dec->ac[1], std_ac_chrominance_counts, std_ac_chrominance_symbols);
+        build_ac_fast_table(&dec->ac[0], dec->ac_fast[0]);
+        build_ac_fast_table(&dec->ac[1], dec->ac_fast[1]);
+    }
+    for (int i = 0; i < count; i++) {
+        const component_t *c = &dec->components[i];
+        if (!dec->dc[c->td].loaded || !dec->ac[c->ta].loaded || !dec->qt_loaded[c->tq]) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+    }
+    return EIDSP_OK;
+}
+
+/**
+ * @brief Read segments up to the start of scan
+ *
+ * @param[out] scan First byte of entropy coded data
+ */
+int parse_headers(const uint8_t *data, size_t length, decoder_t *dec, const uint8_t **scan)
+{
+    if (length < 4 || data[0] != 0xff || data[1] != 0xd8) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    const uint8_t *p = data + 2;
+    const uint8_t *end = data + length;
+    bool have_frame = false;
+    segment_t segment;
+    int res;
+    while ((res = next_segment(p, end, &segment)) == EIDSP_OK) {
+        switch (segment.marker) {
+            case 0xc0:
+            case 0xc1:
+                res = parse_frame(&segment, dec);
+                have_frame = true;
+                break;
+            case 0xc4:
+                res = parse_huffman_tables(&segment, dec);
+                break;
+            case 0xdb:
+                res = parse_quantization_tables(&segment, dec);
+                break;
+            case 0xdd:
+                res = segment.length < 2 ? (int)EIDSP_OUT_OF_BOUNDS : (int)EIDSP_OK;
+                if (res == EIDSP_OK) {
+                    dec->restart_interval = read_u16(segment.data);
+                }
+                break;
+            case 0xda:
+                if (!have_frame) {
+                    return EIDSP_PARAMETER_INVALID;
+                }
+                res = parse_scan(&segment, dec);
+                *scan = p;
+                return res;
+            default:
+                res = is_unsupported_frame(segment.marker) ? (int)EIDSP_NOT_SUPPORTED : (int)EIDSP_OK;
+                break;
+        }
+        if (res != EIDSP_OK) {
+            return res;
+        }
+    }
+    return res;
+}
+
+inline void fill_bits(bit_reader_t *br)
+{
+    while (br->count <= 24) {
+        uint32_t byte = 0;
+        if (br->ptr < br->end) {
+            byte = *br->ptr;
+            if (byte != 0xff) {
+                br->ptr++;
+            }
+            else if (br->ptr + 1 < br->end && br->ptr[1] == 0x00) {
+                br->ptr += 2;
+            }
+            else {
+                // a marker ends the entropy coded segment, pad with zeros and stay put
+                byte = 0;
+            }
+        }
+        br->acc |= byte << (24 - br->count);
+        br->count += 8;
+    }
+}
+
+inline int decode_huffman(bit_reader_t *br, const huffman_table_t *table)
+{
+    if (br->count < 16) {
+        fill_bits(br);
+    }
+    uint32_t look = br->acc >> (32 - HUFF_LOOKAHEAD);
+    int size = table->fast_size[look];
+    if (size) {
+        br->acc <<= size;
+        br->count -= size;
+        return table->fast_symbol[look];
+    }
+    for (size = HUFF_LOOKAHEAD + 1; size <= 16; size++) {
+        int32_t code = (int32_t)(br->acc >> (32 - size));
+        if (code <= table->maxcode[size]) {
+            br->acc <<= size;
+            br->count -= size;
+            return table->symbols[(table->valoffset[size] + code) & 0xff];
+        }
+    }
+    return -1;
+}
+
+inline int32_t receive_extend(bit_reader_t *br, int size)
+{
+    if (size == 0) {
+        return 0;
+    }
+    if (br->count < size) {
+        fill_bits(br);
+    }
+    int32_t value = (int32_t)(br->acc >> (32 - size));
+    br->acc <<= size;
+    br->count -= size;
+    if (value < (1 << (size - 1))) {
+        value -= (1 << size) - 1;
+    }
+    return value;
+}
+
+/**
+ * @brief Entropy decode one block into row major (quantized) coefficients
+ *
+ * @param[out] last Zigzag index of the last coefficient, 0 for a DC only block
+ */
+int decode_block(
+    bit_reader_t *br,
+    const huffman_table_t *dc,
+    const huffman_table_t *ac,
+    const int16_t *ac_fast,
+    int32_t *dc_pred,
+    int16_t *coef,
+    int *last)
+{
+    memset(coef, 0, 64 * sizeof(int16_t));
+
+    // baseline DC differences have at most 11 bits and AC coefficients 10
+    int s = decode_huffman(br, dc);
+    if (s < 0 || s > 11) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+    int32_t pred = *dc_pred + receive_extend(br, s);
+    *dc_pred = pred < -DC_MAX ? -DC_MAX : (pred > DC_MAX ? DC_MAX : pred);
+    coef[0] = (int16_t)*dc_pred;
+
+    *last = 0;
+    for (int k = 1; k < 64;) {
+        if (br->count < 16) {
+            fill_bits(br);
+        }
+        int fast = ac_fast[br->acc >> (32 - HUFF_LOOKAHEAD)];
+        if (fast) {
+            k += (fast >> 4) & 15;
+            br->acc <<= fast & 15;
+            br->count -= fast & 15;
+            *last = k;
+            coef[natural_order[k++]] = (int16_t)(fast >> 8);
+            continue;
+        }
+
+        int rs = decode_huffman(br, ac);
+        if (rs < 0) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        int r = rs >> 4;
+        s = rs & 15;
+        if (s > 10) {
+            return EIDSP_OUT_OF_BOUNDS;
+        }
+        if (s) {
+            k += r;
+            *last = k;
+            coef[natural_order[k]] = (int16_t)receive_extend(br, s);
+            k++;
+        }
+        else {
+            if (r != 15) {
+                break;
+            }
+            k += 16;
+        }
+    }
+    // corrupt run lengths can pass the end of the block
+    if (*last > 63) {
+        *last = 63;
+    }
+    return EIDSP_OK;
+}
+
+/**
+ * @brief 8x8 inverse DCT, the accurate integer (Loeffler, Ligtenberg and Moschytz)
+ * algorithm from the IJG libjpeg, with dequantization folded in
+ */
+void idct_8x8(const int16_t *coef, const uint16_t *qt, uint8_t *out, int stride)
+{
+    int32_t ws[64];
+
+    // columns
+    for (int col = 0; col < 8; col++) {
+        const int16_t *in = coef + col;
+        const uint16_t *q = qt + col;
+        int32_t *w = ws + col;
+        if (in[8] == 0 && in[16] == 0 && in[24] == 0 && in[32] == 0 &&
+            in[40] == 0 && in[48] == 0 && in[56] == 0) {
+            int32_t dc = dequantize(in[0], q[0]) * (1 << PASS1_BITS);
+            for (int i = 0; i < 8; i++) {
+                w[i * 8] = dc;
+            }
+            continue;
+        }
+
+        int32_t z2 = dequantize(in[16], q[16]);
+        int32_t z3 = dequantize(in[48], q[48]);
+        int32_t z1 = (z2 + z3) * 4433;
+        int32_t tmp2 = z1 + z3 * -15137;
+        int32_t tmp3 = z1 + z2 * 6270;
+        z2 = dequantize(in[0], q[0]);
+        z3 = dequantize(in[32], q[32]);
+        int32_t tmp0 = (z2 + z3) * (1 << CONST_BITS);
+        int32_t tmp1 = (z2 - z3) * (1 << CONST_BITS);
+        int32_t tmp10 = tmp0 + tmp3;
+        int32_t tmp13 = tmp0 - tmp3;
+        int32_t tmp11 = tmp1 + tmp2;
+        int32_t tmp12 = tmp1 - tmp2;
+
+        tmp0 = dequantize(in[56], q[56]);
+        tmp1 = dequantize(in[40], q[40]);
+        tmp2 = dequantize(in[24], q[24]);
+        tmp3 = dequantize(in[8], q[8]);
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        int32_t z5 = (z3 + z4) * 9633;
+        tmp0 *= 2446;
+        tmp1 *= 16819;
+        tmp2 *= 25172;
+        tmp3 *= 12299;
+        z1 *= -7373;
+        z2 *= -20995;
+        z3 *= -16069;
+        z4 *= -3196;
+        z3 += z5;
+        z4 += z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        w[0] = descale(tmp10 + tmp3, CONST_BITS - PASS1_BITS);
+        w[56] = descale(tmp10 - tmp3, CONST_BITS - PASS1_BITS);
+        w[8] = descale(tmp11 + tmp2, CONST_BITS - PASS1_BITS);
+        w[48] = descale(tmp11 - tmp2, CONST_BITS - PASS1_BITS);
+        w[16] = descale(tmp12 + tmp1, CONST_BITS - PASS1_BITS);
+        w[40] = descale(tmp12 - tmp1, CONST_BITS - PASS1_BITS);
+        w[24] = descale(tmp13 + tmp0, CONST_BITS - PASS1_BITS);
+        w[32] = descale(tmp13 - tmp0, CONST_BITS - PASS1_BITS);
+    }
+
+    // rows
+    const int shift = CONST_BITS + PASS1_BITS + 3;
+    for (int row = 0; row < 8; row++) {
+        const int32_t *w = ws + row * 8;
+        uint8_t *o = out + row * stride;
+        if (w[1] == 0 && w[2] == 0 && w[3] == 0 && w[4] == 0 &&
+            w[5] == 0 && w[6] == 0 && w[7] == 0) {
+            uint8_t dc = clamp_u8(descale(w[0], PASS1_BITS + 3) + 128);
+            memset(o, dc, 8);
+            continue;
+        }
+
+        int32_t z2 = w[2];
+        int32_t z3 = w[6];
+        int32_t z1 = (z2 + z3) * 4433;
+        int32_t tmp2 = z1 + z3 * -15137;
+        int32_t tmp3 = z1 + z2 * 6270;
+        int32_t tmp0 = (w[0] + w[4]) * (1 << CONST_BITS);
+        int32_t tmp1 = (w[0] - w[4]) * (1 << CONST_BITS);
+        int32_t tmp10 = tmp0 + tmp3;
+        int32_t tmp13 = tmp0 - tmp3;
+        int32_t tmp11 = tmp1 + tmp2;
+        int32_t tmp12 = tmp1 - tmp2;
+
+        tmp0 = w[7];
+        tmp1 = w[5];
+        tmp2 = w[3];
+        tmp3 = w[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        int32_t z5 = (z3 + z4) * 9633;
+        tmp0 *= 2446;
+        tmp1 *= 16819;
+        tmp2 *= 25172;
+        tmp3 *= 12299;
+        z1 *= -7373;
+        z2 *= -20995;
+        z3 *= -16069;
+        z4 *= -3196;
+        z3 += z5;
+        z4 += z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        o[0] = clamp_u8(descale(tmp10 + tmp3, shift) + 128);
+        o[7] = clamp_u8(descale(tmp10 - tmp3, shift) + 128);
+        o[1] = clamp_u8(descale(tmp11 + tmp2, shift) + 128);
+        o[6] = clamp_u8(descale(tmp11 - tmp2, shift) + 128);
+        o[2] = clamp_u8(descale(tmp12 + tmp1, shift) + 128);
+        o[5] = clamp_u8(descale(tmp12 - tmp1, shift) + 128);
+        o[3] = clamp_u8(descale(tmp13 + tmp0, shift) + 128);
+        o[4] = clamp_u8(descale(tmp13 - tmp0, shift) + 128);
+    }
+}
+
+/**
+ * @brief N x N inverse DCT, N = 4 or 2, where every output pixel is the mean of the
+ * (8 / N)^2 pixels a full size inverse DCT would produce
+ */
+template<int N>
+void idct_reduced(const int16_t *coef, const uint16_t *qt, int rows, int cols, uint8_t *out, int stride, const int16_t (*table)[8])
+{
+    int32_t ws[N * 8];
+
+    // columns, only those holding coefficients
+    for (int u = 0; u < cols; u++) {
+        int32_t in[8];
+        for (int v = 0; v < rows; v++) {
+            in[v] = dequantize(coef[v * 8 + u], qt[v * 8 + u]);
+        }
+        for (int y = 0; y < N / 2; y++) {
+            int32_t even = 0, odd = 0;
+            for (int v = 0; v < rows; v += 2) {
+                even += table[y][v] * in[v];
+            }
+            for (int v = 1; v < rows; v += 2) {
+                odd += table[y][v] * in[v];
+            }
+            ws[y * 8 + u] = descale(even + odd, CONST_BITS - PASS1_BITS);
+            ws[(N - 1 - y) * 8 + u] = descale(even - odd, CONST_BITS - PASS1_BITS);
+        }
+    }
+
+    // rows
+    for (int y = 0; y < N; y++) {
+        const int32_t *w = ws + y * 8;
+        uint8_t *o = out + y * stride;
+        for (int x = 0; x < N / 2; x++) {
+            int32_t even = 0, odd = 0;
+            for (int u = 0; u < cols; u += 2) {
+                even += table[x][u] * w[u];
+            }
+            for (int u = 1; u < cols; u += 2) {
+                odd += table[x][u] * w[u];
+            }
+            o[x] = clamp_u8(descale(even + odd, CONST_BITS + PASS1_BITS) + 128);
+            o[N - 1 - x] = clamp_u8(descale(even - odd, CONST_BITS + PASS1_BITS) + 128);
+        }
+    }
+}
+
+/**
+ * @brief Inverse DCT of a block without AC coefficients, or of any block at 1/8 scale
+ */
+void idct_dc(const int16_t *coef, const uint16_t *qt, int size, uint8_t *out, int stride)
+{
+    uint8_t value = clamp_u8(descale(dequantize(coef[0], qt[0]), 3) + 128);
+    for (int y = 0; y < size; y++) {
+        memset(out + y * stride, value, size);
+    }
+}
+
+/**
+ * @brief Inverse DCT at the given output size
+ *
+ * @param last Zigzag index of the last coefficient, limits the work of the reduced sizes
+ */
+void idct_scaled(int block_size, const int16_t *coef, const uint16_t *qt, int last, uint8_t *out, int stride)
+{
+    if (last == 0 || block_size == 1) {
+        idct_dc(coef, qt, block_size, out, stride);
+        return;
+    }
+    const int rows = zigzag_extent[last] >> 4;
+    const int cols = zigzag_extent[last] & 15;
+    switch (block_size) {
+        case 8: idct_8x8(coef, qt, out, stride); break;
+        case 4: idct_reduced<4>(coef, qt, rows, cols, out, stride, idct_table_4); break;
+        default: idct_reduced<2>(coef, qt, rows, cols, out, stride, idct_table_2); break;
+    }
+}
+
+int log2_ratio(int max, int f)
+{
+    switch (max / f) {
+        case 1: return max % f ? -1 : 0;
+        case 2: return max % f ? -1 : 1;
+        case 4: return max % f ? -1 : 2;
+        default: return -1;
+    }
+}
+
+inline const uint8_t *component_row(const component_t *c, int vmax, int ly)
+{
+    int sy = c->y_shift >= 0 ? ly >> c->y_shift : ly * c->v / vmax;
+    return c->plane + sy * c->plane_stride;
+}
+
+inline int component_col(const component_t *c, int hmax, int x)
+{
+    return c->x_shift >= 0 ? x >> c->x_shift : x * c->h / hmax;
+}
+
+/**
+ * @brief Upsample and color convert one output row from the component planes
+ */
+void convert_row(const decoder_t *dec, int ly, int x0, int x1, int out_components, uint8_t *row)
+{
+    const component_t *cy = &dec->components[0];
+    const uint8_t *y_row = component_row(cy, dec->vmax, ly);
+
+    if (dec->component_count == 1 || out_components == 1) {
+        for (int x = x0; x < x1; x++) {
+            uint8_t y = y_row[component_col(cy, dec->hmax, x)];
+            if (out_components == 1) {
+                row[x] = y;
+            }
+            else {
+                row[x * 3] = row[x * 3 + 1] = row[x * 3 + 2] = y;
+            }
+        }
+        return;
+    }
+
+    // JFIF YCbCr, same fixed point factors as libjpeg
+    const component_t *cb = &dec->components[1];
+    const component_t *cr = &dec->components[2];
+    const uint8_t *cb_row = component_row(cb, dec->vmax, ly);
+    const uint8_t *cr_row = component_row(cr, dec->vmax, ly);
+    for (int x = x0; x < x1; x++) {
+        int32_t y = y_row[component_col(cy, dec->hmax, x)];
+        int32_t u = cb_row[component_col(cb, dec->hmax, x)] - 128;
+        int32_t v = cr_row[component_col(cr, dec->hmax, x)] - 128;
+        row[x * 3] = clamp_u8(y + ((91881 * v + 32768) >> 16));
+        row[x * 3 + 1] = clamp_u8(y + ((-22554 * u - 46802 * v + 32768) >> 16));
+        row[x * 3 + 2] = clamp_u8(y + ((116130 * u + 32768) >> 16));
+    }
+}
+
+void restart(bit_reader_t *br, decoder_t *dec)
+{
+    const uint8_t *p = br->ptr;
+    while (p + 1 < br->end && !(p[0] == 0xff && p[1] >= 0xd0 && p[1] <= 0xd7)) {
+        p++;
+    }
+    br->ptr = p + 1 < br->end ? p + 2 : br->end;
+    br->acc = 0;
+    br->count = 0;
+    for (int i = 0; i < dec->component_count; i++) {
+        dec->components[i].dc_pred = 0;
+    }
+}
+
+int decode_scan(
+    decoder_t *dec,
+    const uint8_t *scan,
+    const uint8_t *end,
+    int scale,
+    int out_components,
+    row_callback_t callback,
+    void *user,
+    int roi_x,
+    int roi_width)
+{
+    const int block_size = 8 / scale;
+    const int mcus_x = (dec->width + dec->hmax * 8 - 1) / (dec->hmax * 8);
+    const int mcus_y = (dec->height + dec->vmax * 8 - 1) / (dec->vmax * 8);
+    const int mcu_width = dec->hmax * block_size;
+    const int mcu_height = dec->vmax * block_size;
+    int out_width, out_height;
+    scaled_size(dec->width, dec->height, scale, out_width, out_height);
+
+    if (roi_width <= 0 || roi_x < 0 || roi_x + roi_width > out_width) {
+        roi_x = 0;
+        roi_width = out_width;
+    }
+    const int first_mcu_x = roi_x / mcu_width;
+    const int last_mcu_x = (roi_x + roi_width - 1) / mcu_width;
+
+    size_t plane_bytes = 0;
+    for (int i = 0; i < dec->component_count; i++) {
+        component_t *c = &dec->components[i];
+        c->x_shift = log2_ratio(dec->hmax, c->h);
+        c->y_shift = log2_ratio(dec->vmax, c->v);
+        c->block_size = block_size;
+        // like libjpeg, decode 2x2 or 4x4 subsampled components at a larger DCT size when
+        // scaling down, instead of upsampling them afterwards
+        if (c->x_shift > 0 && c->x_shift == c->y_shift && (block_size << c->x_shift) <= 8) {
+            c->block_size = block_size << c->x_shift;
+            c->x_shift = c->y_shift = 0;
+        }
+        c->plane_stride = mcus_x * c->h * c->block_size;
+        c->dc_pred = 0;
+        plane_bytes += (size_t)c->plane_stride * c->v * c->block_size;
+    }
+    size_t row_bytes = (size_t)out_width * out_components;
+    uint8_t *buffer = (uint8_t *)ei_scratch_calloc(plane_bytes + row_bytes, 1);
+    if (!buffer) {
+        return EIDSP_OUT_OF_MEM;
+    }
+    uint8_t *p = buffer;
+    for (int i = 0; i < dec->component_count; i++) {
+        component_t *c = &dec->components[i];
+        c->plane = p;
+        p += (size_t)c->plane_stride * c->v * c->block_size;
+    }
+    uint8_t *row = p;
+
+    bit_reader_t br = { scan, end, 0, 0 };
+    int16_t coef[64];
+    int last;
+    int restarts_left = dec->restart_interval;
+    int res = EIDSP_OK;
+
+    for (int mcu_y = 0; mcu_y < mcus_y && res == EIDSP_OK; mcu_y++) {
+        for (int mcu_x = 0; mcu_x < mcus_x && res == EIDSP_OK; mcu_x++) {
+            if (dec->restart_interval) {
+                if (restarts_left == 0) {
+                    restart(&br, dec);
+                    restarts_left = dec->restart_interval;
+                }
+                restarts_left--;
+            }
+            // blocks left and right of the region still have to be entropy decoded,
+            // but skip their inverse DCT
+            bool visible = mcu_x >= first_mcu_x && mcu_x <= last_mcu_x;
+            for (int i = 0; i < dec->component_count && res == EIDSP_OK; i++) {
+                component_t *c = &dec->components[i];
+                for (int by = 0; by < c->v && res == EIDSP_OK; by++) {
+                    for (int bx = 0; bx < c->h; bx++) {
+                        res = decode_block(&br, &dec->dc[c->td], &dec->ac[c->ta], dec->ac_fast[c->ta],
+                            &c->dc_pred, coef, &last);
+                        if (res != EIDSP_OK) {
+                            break;
+                        }
+                        if (visible) {
+                            uint8_t *out = c->plane + by * c->block_size * c->plane_stride +
+                                (mcu_x * c->h + bx) * c->block_size;
+                            idct_scaled(c->block_size, coef, dec->qt[c->tq], last, out, c->plane_stride);
+                        }
+                    }
+                }
+            }
+        }
+        if (res != EIDSP_OK) {
+            break;
+        }
+
+        for (int ly = 0; ly < mcu_height; ly++) {
+            int y = mcu_y * mcu_height + ly;
+            if (y >= out_height) {
+                break;
+            }
+            convert_row(dec, ly, roi_x, roi_x + roi_width, out_components, row);
+            res = callback(user, row, y);
+            if (res != EIDSP_OK) {
+                break;
+            }
+        }
+    }
+
+    ei_scratch_free(buffer);
+    return res == JPEG_STOP ? (int)EIDSP_OK : res;
+}
+
+} // namespace
+
+int get_info(const uint8_t *data, size_t length, jpeg_info_t *info)
+{
+    if (length < 4 || data[0] != 0xff || data[1] != 0xd8) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    const uint8_t *p = data + 2;
+    const uint8_t *end = data + length;
+    segment_t segment;
+    int res;
+    while ((res = next_segment(p, end, &segment)) == EIDSP_OK) {
+        if (is_unsupported_frame(segment.marker)) {
+            return EIDSP_NOT_SUPPORTED;
+        }
+        if (segment.marker == 0xc0 || segment.marker == 0xc1) {
+            if (segment.length < 6) {
+                return EIDSP_OUT_OF_BOUNDS;
+            }
+            if (segment.data[0] != 8) {
+                return EIDSP_NOT_SUPPORTED;
+            }
+            info->height = read_u16(segment.data + 1);
+            info->width = read_u16(segment.data + 3);
+            info->components = segment.data[5];
+            return info->width && info->height ? (int)EIDSP_OK : (int)EIDSP_NOT_SUPPORTED;
+        }
+        if (segment.marker == 0xda) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+    }
+    return res;
+}
+
+void scaled_size(int width, int height, int scale, int &scaled_width, int &scaled_height)
+{
+    scaled_width = (width + scale - 1) / scale;
+    scaled_height = (height + scale - 1) / scale;
+}
+
+int choose_scale(int width, int height, int min_width, int min_height, bool crop)
+{
+    // the crop keeps the target aspect ratio, so the side that limits it has to cover
+    // the target size at the chosen scale
+    for (int scale = 8; scale > 1; scale >>= 1) {
+        int scaled_width, scaled_height;
+        scaled_size(width, height, scale, scaled_width, scaled_height);
+        if (!crop) {
+            if (scaled_width >= min_width && scaled_height >= min_height) {
+                return scale;
+            }
+        }
+        else if ((int64_t)scaled_width * min_height >= (int64_t)scaled_height * min_width) {
+            if (scaled_height >= min_height) {
+                return scale;
+            }
+        }
+        else if (scaled_width >= min_width) {
+            return scale;
+        }
+    }
+    return 1;
+}
+
+int decode(
+    const uint8_t *data,
+    size_t length,
+    int scale,
+    int out_components,
+    row_callback_t callback,
+    void *user,
+    int roi_x,
+    int roi_width)
+{
+    if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    if (out_components != 1 && out_components != 3) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    decoder_t *dec = (decoder_t *)ei_scratch_calloc(1, sizeof(decoder_t));
+    if (!dec) {
+        return EIDSP_OUT_OF_MEM;
+    }
+    const uint8_t *scan = nullptr;
+    int res = parse_headers(data, length, dec, &scan);
+    if (res == EIDSP_OK) {
+        res = decode_scan(dec, scan, data + length, scale, out_components, callback, user, roi_x, roi_width);
+    }
+    ei_scratch_free(dec);
+    return res;
+}
+
+} // namespace jpeg
+} // namespace image
+} // namespace ei
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 EdgeImpulse Inc.
+ *
+ * Generated by Edge Impulse and licensed under the applicable Edge Impulse
+ * Terms of Service. Community and Professional Terms of Service
+ * (https://edgeimpulse.com/legal/terms-of-service) or Enterprise Terms of
+ * Service (https://edgeimpulse.com/legal/enterprise-terms-of-service),
+ * according to your product plan subscription (the “License”).
+ *
+ * This software, documentation and other associated files (collectively referred
+ * to as the “Software”) is a single SDK variation generated by the Edge Impulse
+ * platform and requires an active paid Edge Impulse subscription to use this
+ * Software for any purpose.
+ *
+ * You may NOT use this Software unless you have an active Edge Impulse subscription
+ * that meets the eligibility requirements for the applicable License, subject to
+ * your full and continued compliance with the terms and conditions of the License,
+ * including without limitation any usage restrictions under the applicable License.
+ *
+ * If you do not have an active Edge Impulse product plan subscription, or if use
+ * of this Software exceeds the usage limitations of your Edge Impulse product plan
+ * subscription, you are not permitted to use this Software and must immediately
+ * delete and erase all copies of this Software within your control or possession.
+ * Edge Impulse reserves all rights and remedies available to enforce its rights.
+ *
+ * Unless required by applicable law or agreed to in writing, the Software is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific language governing
+ * permissions, disclaimers and limitations under the License.
+ */
+#ifndef __EIDSP_IMAGE_JPEG__H__
+#define __EIDSP_IMAGE_JPEG__H__
+
+#include "edge-impulse-sdk/dsp/ei_utils.h"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/dsp/returntypes.hpp"
+
+namespace ei { namespace image { namespace jpeg {
+
+/**
+ * Return value of a row_callback_t that ends decoding early, without an error
+ */
+constexpr int JPEG_STOP = 1;
+
+/**
+ * @brief Called for every decoded row of the (scaled) image, top to bottom
+ *
+ * @param user Pointer passed to decode()
+ * @param row width * out_components bytes, RGB888 or grayscale
+ * @param y Row index in the scaled image
+ * @return EIDSP_OK to continue, JPEG_STOP to stop, anything else aborts decode() with that error
+ */
+typedef int (*row_callback_t)(void *user, const uint8_t *row, int y);
+
+/**
+ * @brief Frame header of a JPEG image
+ */
+typedef struct {
+    int width;
+    int height;
+    int components; // 1 for grayscale, 3 for YCbCr
+} jpeg_info_t;
+
+/**
+ * Upper bound of the decoder state decode() allocates
+ */
+constexpr size_t DECODER_STATE_SIZE = 16384;
+
+/**
+ * @brief Upper bound of the memory decode() allocates (through ei_scratch_calloc()),
+ * for an image up to max_width pixels wide at any scale and chroma subsampling up to 2x2
+ */
+constexpr size_t max_decode_memory(int max_width, int out_components = 3)
+{
+    // state, plus one MCU row of all planes (at most 32 rows of the 16 pixel aligned
+    // width, 4:4:0 at 1/1) and one output row
+    return DECODER_STATE_SIZE + 32 * (((size_t)max_width + 15) & ~(size_t)15) + (size_t)max_width * out_components;
+}
+
+/**
+ * @brief Read the frame header without decoding the image
+ *
+ * @param data JPEG file
+ * @param length Size of data in bytes
+ * @param[out] info Image size and components
+ * @return int EIDSP_OK, or EIDSP_NOT_SUPPORTED for anything but baseline / extended sequential 8-bit JPEG
+ */
+int get_info(const uint8_t *data, size_t length, jpeg_info_t *info);
+
+/**
+ * @brief Largest DCT scaling denominator (1, 2, 4 or 8) for which the scaled image still
+ * covers min_width x min_height
+ *
+ * @param crop True if the image gets cropped to the aspect ratio of min_width x min_height
+ *  first (fit shortest), false if it is squashed and both sides have to cover the target
+ */
+int choose_scale(int width, int height, int min_width, int min_height, bool crop = true);
+
+/**
+ * @brief Size of the image after decoding at 1/scale
+ */
+void scaled_size(int width, int height, int scale, int &scaled_width, int &scaled_height);
+
+/**
+ * @brief Decode a baseline JPEG at 1/1, 1/2, 1/4 or 1/8 scale, one row at a time
+ *
+ * Scaling happens in the DCT domain: only the low frequency coefficients of every
+ * 8x8 block are transformed, with a 4x4, 2x2 or 1x1 inverse DCT, so a scaled decode
+ * costs a fraction of a full decode. Memory use is the decoder state plus one row of
+ * MCUs (16 rows for 4:2:0) of the scaled image, see max_decode_memory(). Subsampled chroma is decoded at a larger DCT size when the scale
+ * allows it (4:2:0 at 1/2 and below), otherwise upsampled by replication.
+ *
+ * @param data JPEG file
+ * @param length Size of data in bytes
+ * @param scale 1, 2, 4 or 8
+ * @param out_components 3 for RGB888 rows, 1 for grayscale rows (luma only)
+ * @param callback Receives every row of the scaled image
+ * @param user Passed to callback
+ * @param roi_x First column (in the scaled image) the callback reads
+ * @param roi_width Columns the callback reads, 0 for all. Blocks outside are entropy
+ *  decoded but not transformed, and those pixels are left undefined in the rows
+ * @return int EIDSP_OK on success
+ */
+int decode(
+    const uint8_t *data,
+    size_t length,
+    int scale,
+    int out_components,
+    row_callback_t callback,
+    void *user,
+    int roi_x = 0,
+    int roi_width = 0);
+
+}}} //namespaces
+#endif //!__EIDSP_IMAGE_JPEG__H__
@@ -34,9 +34,17 @@
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
 #include "edge-impulse-sdk/porting/ei_logging.h"
 #include "edge-impulse-sdk/classifier/ei_constants.h"
+#include "edge-impulse-sdk/dsp/config.hpp"
+#include "edge-impulse-sdk/dsp/memory.hpp"
 #include <string.h>
 #include <stddef.h>
 
+#if EIDSP_USE_SSE2
+#include <emmintrin.h>
+#elif EIDSP_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace ei {
 namespace image {
 namespace processing {
@@ -544,6 +552,493 @@ int resize_image_using_mode(
     // shouldn't get here
     return -2;
 }
+
+// Fixed point format shared with resize_image()
+static constexpr int RQ_FRAC_BITS = 14;
+static constexpr uint32_t RQ_FRAC_VAL = (1 << RQ_FRAC_BITS);
+static constexpr uint32_t RQ_FRAC_MASK = (RQ_FRAC_VAL - 1);
+
+/**
+ * @brief Blend two rows, out = a * (1 - frac) + b * frac, rounded
+ *
+ * @param frac Weight of b in RQ_FRAC_BITS fixed point
+ */
+static void blend_rows(const uint8_t *a, const uint8_t *b, uint32_t frac, uint8_t *out, int count)
+{
+    const uint32_t nfrac = RQ_FRAC_VAL - frac;
+    int ix = 0;
+
+#if EIDSP_USE_SSE2
+    // interleave a and b as 16 bit pairs, so one madd computes a * nfrac + b * frac
+    const __m128i weights = _mm_set1_epi32((int)((frac << 16) | nfrac));
+    const __m128i half = _mm_set1_epi32(RQ_FRAC_VAL / 2);
+    const __m128i zero = _mm_setzero_si128();
+    for (; ix + 16 <= count; ix += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + ix));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + ix));
+        __m128i a_lo = _mm_unpacklo_epi8(va, zero);
+        __m128i a_hi = _mm_unpackhi_epi8(va, zero);
+        __m128i b_lo = _mm_unpacklo_epi8(vb, zero);
+        __m128i b_hi = _mm_unpackhi_epi8(vb, zero);
+        __m128i r0 = _mm_madd_epi16(_mm_unpacklo_epi16(a_lo, b_lo), weights);
+        __m128i r1 = _mm_madd_epi16(_mm_unpackhi_epi16(a_lo, b_lo), weights);
+        __m128i r2 = _mm_madd_epi16(_mm_unpacklo_epi16(a_hi, b_hi), weights);
+        __m128i r3 = _mm_madd_epi16(_mm_unpackhi_epi16(a_hi, b_hi), weights);
+        r0 = _mm_srli_epi32(_mm_add_epi32(r0, half), RQ_FRAC_BITS);
+        r1 = _mm_srli_epi32(_mm_add_epi32(r1, half), RQ_FRAC_BITS);
+        r2 = _mm_srli_epi32(_mm_add_epi32(r2, half), RQ_FRAC_BITS);
+        r3 = _mm_srli_epi32(_mm_add_epi32(r3, half), RQ_FRAC_BITS);
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3));
+        _mm_storeu_si128((__m128i *)(out + ix), packed);
+    }
+#elif EIDSP_USE_NEON
+    const uint16x4_t wa = vdup_n_u16((uint16_t)nfrac);
+    const uint16x4_t wb = vdup_n_u16((uint16_t)frac);
+    for (; ix + 8 <= count; ix += 8) {
+        uint16x8_t va = vmovl_u8(vld1_u8(a + ix));
+        uint16x8_t vb = vmovl_u8(vld1_u8(b + ix));
+        uint32x4_t lo = vmlal_u16(vmull_u16(vget_low_u16(va), wa), vget_low_u16(vb), wb);
+        uint32x4_t hi = vmlal_u16(vmull_u16(vget_high_u16(va), wa), vget_high_u16(vb), wb);
+        // rounding narrow shift adds RQ_FRAC_VAL / 2 like the scalar path
+        uint16x8_t r = vcombine_u16(vrshrn_n_u32(lo, RQ_FRAC_BITS), vrshrn_n_u32(hi, RQ_FRAC_BITS));
+        vst1_u8(out + ix, vmovn_u16(r));
+    }
+#endif
+
+    for (; ix < count; ix++) {
+        out[ix] = (uint8_t)((a[ix] * nfrac + b[ix] * frac + RQ_FRAC_VAL / 2) >> RQ_FRAC_BITS);
+    }
+}
+
+/**
+ * @brief Quantize with scale 1/255 and zero point -128, i.e. v - 128
+ */
+static void offset_to_int8(const uint8_t *in, int8_t *out, int count)
+{
+    int ix = 0;
+
+#if EIDSP_USE_SSE2
+    const __m128i sign = _mm_set1_epi8((char)0x80);
+    for (; ix + 16 <= count; ix += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(in + ix));
+        _mm_storeu_si128((__m128i *)(out + ix), _mm_xor_si128(v, sign));
+    }
+#elif EIDSP_USE_NEON
+    const uint8x16_t sign = vdupq_n_u8(0x80);
+    for (; ix + 16 <= count; ix += 16) {
+        vst1q_s8(out + ix, vreinterpretq_s8_u8(veorq_u8(vld1q_u8(in + ix), sign)));
+    }
+#endif
+
+    for (; ix < count; ix++) {
+        out[ix] = (int8_t)(in[ix] ^ 0x80);
+    }
+}
+
+void quantize_with_lut(
+    const uint8_t *in,
+    int8_t *out,
+    int count,
+    int channels,
+    const int8_t *lut,
+    bool lut_is_offset)
+{
+    if (lut_is_offset) {
+        offset_to_int8(in, out, count);
+    }
+    else if (channels == 3) {
+        for (int ix = 0; ix < count; ix += 3) {
+            out[ix] = lut[in[ix]];
+            out[ix + 1] = lut[256 + in[ix + 1]];
+            out[ix + 2] = lut[512 + in[ix + 2]];
+        }
+    }
+    else {
+        for (int ix = 0; ix < count; ix++) {
+            out[ix] = lut[in[ix]];
+        }
+    }
+}
+
+ResizeQuantizer::ResizeQuantizer()
+    : buffer(nullptr)
+{
+}
+
+ResizeQuantizer::~ResizeQuantizer()
+{
+    if (buffer) {
+        ei_scratch_free(buffer);
+    }
+}
+
+int ResizeQuantizer::init(
+    int srcWidth,
+    int srcHeight,
+    int pixel_size_B,
+    int8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int dst_channels,
+    int mode,
+    RESIZE_INTERPOLATION interpolation,
+    const int8_t *lut)
+{
+    if (buffer) {
+        ei_scratch_free(buffer);
+        buffer = nullptr;
+    }
+
+    if (srcWidth <= 0 || srcHeight <= 0 || dstWidth <= 0 || dstHeight <= 0 ||
+        srcWidth > 0xffff || dstImage == nullptr || lut == nullptr ||
+        (pixel_size_B != 1 && pixel_size_B != 3) ||
+        (dst_channels != 1 && dst_channels != 3)) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    if (mode == EI_CLASSIFIER_RESIZE_FIT_SHORTEST) {
+        // keep the shortest axis (relative to the destination aspect ratio), crop the other one
+        if ((uint32_t)srcWidth * dstHeight > (uint32_t)srcHeight * dstWidth) {
+            crop_height = srcHeight;
+            crop_width = (int)(((uint32_t)srcHeight * dstWidth) / dstHeight);
+        }
+        else {
+            crop_width = srcWidth;
+            crop_height = (int)(((uint32_t)srcWidth * dstHeight) / dstWidth);
+        }
+    }
+    else if (mode == EI_CLASSIFIER_RESIZE_SQUASH) {
+        crop_width = srcWidth;
+        crop_height = srcHeight;
+    }
+    else {
+        EI_LOGE("ResizeQuantizer only supports fit shortest and squash\n");
+        return EIDSP_NOT_SUPPORTED;
+    }
+
+    if (crop_width < 1 || crop_height < 1) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    src_width = srcWidth;
+    src_height = srcHeight;
+    pixel_size = pixel_size_B;
+    crop_x = (srcWidth - crop_width) / 2;
+    crop_y = (srcHeight - crop_height) / 2;
+    dst = dstImage;
+    dst_width = dstWidth;
+    dst_height = dstHeight;
+    this->dst_channels = dst_channels;
+    this->lut = lut;
+
+    // the area filter needs every source pixel to fit in one or two output pixels, and
+    // the accumulators (255 * crop area) to fit the exact reciprocal division below
+    filter = interpolation;
+    if (filter == RESIZE_INTERPOLATION_AREA &&
+        (crop_width < dstWidth || crop_height < dstHeight ||
+         (uint64_t)crop_width * crop_height >= (1u << 23))) {
+        filter = RESIZE_INTERPOLATION_BILINEAR;
+    }
+    area_inv = ((uint64_t)1 << 55) / ((uint64_t)crop_width * crop_height) + 1;
+
+    lut_is_offset = true;
+    for (int ix = 0; ix < 256 * dst_channels; ix++) {
+        if (lut[ix] != (int8_t)((ix & 0xff) - 128)) {
+            lut_is_offset = false;
+            break;
+        }
+    }
+
+    // one allocation, widest types first to keep them aligned
+    const size_t line_size = (size_t)dstWidth * pixel_size_B;
+    size_t total = line_size;
+    if (filter == RESIZE_INTERPOLATION_AREA) {
+        total += 2 * line_size * sizeof(uint32_t);
+    }
+    else {
+        total += 2 * dstWidth * sizeof(uint16_t) + 2 * line_size;
+    }
+
+    buffer = (uint8_t *)ei_scratch_malloc(total);
+    if (!buffer) {
+        return EIDSP_OUT_OF_MEM;
+    }
+
+    uint8_t *p = buffer;
+    if (filter == RESIZE_INTERPOLATION_AREA) {
+        hacc = (uint32_t *)p;
+        p += line_size * sizeof(uint32_t);
+        vacc = (uint32_t *)p;
+        p += line_size * sizeof(uint32_t);
+        memset(vacc, 0, line_size * sizeof(uint32_t));
+        x_index = x_frac = nullptr;
+        hrows[0] = hrows[1] = nullptr;
+    }
+    else {
+        x_index = (uint16_t *)p;
+        p += dstWidth * sizeof(uint16_t);
+        x_frac = (uint16_t *)p;
+        p += dstWidth * sizeof(uint16_t);
+        hrows[0] = p;
+        p += line_size;
+        hrows[1] = p;
+        p += line_size;
+        hacc = vacc = nullptr;
+
+        // same stepping as resize_image(), source positions never pass the crop
+        const uint32_t x_step = ((uint32_t)crop_width * RQ_FRAC_VAL) / dstWidth;
+        uint32_t x_accum = 0;
+        for (int x = 0; x < dstWidth; x++) {
+            x_index[x] = (uint16_t)(x_accum >> RQ_FRAC_BITS);
+            x_frac[x] = (uint16_t)(x_accum & RQ_FRAC_MASK);
+            x_accum += x_step;
+        }
+        y_step = ((uint32_t)crop_height * RQ_FRAC_VAL) / dstHeight;
+    }
+    line = p;
+
+    rows_pushed = 0;
+    rows_written = 0;
+
+    return EIDSP_OK;
+}
+
+int ResizeQuantizer::push_row(const uint8_t *row)
+{
+    if (!buffer) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    if (rows_pushed >= src_height) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+
+    const int crop_row = rows_pushed - crop_y;
+    rows_pushed++;
+
+    if (crop_row < 0 || crop_row >= crop_height || done()) {
+        return EIDSP_OK;
+    }
+
+    const uint8_t *src = row + crop_x * pixel_size;
+    if (filter == RESIZE_INTERPOLATION_AREA) {
+        push_row_area(src, crop_row);
+    }
+    else {
+        push_row_bilinear(src, crop_row);
+    }
+    return EIDSP_OK;
+}
+
+bool ResizeQuantizer::done() const
+{
+    return rows_written >= dst_height;
+}
+
+void ResizeQuantizer::get_crop_columns(int &x, int &width) const
+{
+    x = crop_x;
+    width = crop_width;
+}
+
+/**
+ * @brief Horizontal pass of the bilinear filter for one row
+ */
+template<int PIXEL_SIZE>
+static void interpolate_row(
+    const uint8_t *src,
+    const uint16_t *x_index,
+    const uint16_t *x_frac,
+    int last,
+    uint8_t *out,
+    int count)
+{
+    for (int x = 0; x < count; x++) {
+        const int i0 = x_index[x];
+        const int i1 = i0 < last ? i0 + 1 : last;
+        const uint32_t frac = x_frac[x];
+        const uint32_t nfrac = RQ_FRAC_VAL - frac;
+        const uint8_t *p0 = src + i0 * PIXEL_SIZE;
+        const uint8_t *p1 = src + i1 * PIXEL_SIZE;
+        for (int c = 0; c < PIXEL_SIZE; c++) {
+            *out++ = (uint8_t)((p0[c] * nfrac + p1[c] * frac + RQ_FRAC_VAL / 2) >> RQ_FRAC_BITS);
+        }
+    }
+}
+
+void ResizeQuantizer::push_row_bilinear(const uint8_t *src, int crop_row)
+{
+    // rows above the next output row are never read again
+    const int next_top = (int)(((uint32_t)rows_written * y_step) >> RQ_FRAC_BITS);
+    if (crop_row < next_top) {
+        return;
+    }
+
+    // resample horizontally into the ring of the last two rows
+    uint8_t *h = hrows[crop_row & 1];
+    if (pixel_size == 3) {
+        interpolate_row<3>(src, x_index, x_frac, crop_width - 1, h, dst_width);
+    }
+    else {
+        interpolate_row<1>(src, x_index, x_frac, crop_width - 1, h, dst_width);
+    }
+
+    // emit every output row whose two source rows have arrived
+    while (rows_written < dst_height) {
+        const uint32_t y_accum = (uint32_t)rows_written * y_step;
+        const int top = (int)(y_accum >> RQ_FRAC_BITS);
+        const int bottom = top < crop_height - 1 ? top + 1 : crop_height - 1;
+        if (bottom > crop_row) {
+            break;
+        }
+        blend_rows(hrows[top & 1], hrows[bottom & 1], y_accum & RQ_FRAC_MASK, line, dst_width * pixel_size);
+        quantize_line(line);
+    }
+}
+
+/**
+ * @brief Horizontal pass of the area filter for one row
+ *
+ * Positions are measured in units where a source pixel is dst_width long and an
+ * output pixel src_width long, so all overlaps are exact integers. When downscaling
+ * a source pixel overlaps at most two output pixels.
+ */
+template<int PIXEL_SIZE>
+static void accumulate_row(const uint8_t *src, int src_width, int dst_width, uint32_t *acc)
+{
+    // pixels fully inside an output pixel are summed as is and scaled once when it closes
+    uint32_t plain[PIXEL_SIZE] = { 0 };
+    uint32_t carry[PIXEL_SIZE] = { 0 };
+
+    uint32_t pos = 0;
+    uint32_t boundary = src_width;
+    for (int ix = 0; ix < src_width; ix++, src += PIXEL_SIZE) {
+        const uint32_t end = pos + dst_width;
+        if (end < boundary) {
+            for (int c = 0; c < PIXEL_SIZE; c++) {
+                plain[c] += src[c];
+            }
+        }
+        else {
+            // pixel ends on or straddles the boundary, split the weight
+            const uint32_t w0 = boundary - pos;
+            const uint32_t w1 = dst_width - w0;
+            for (int c = 0; c < PIXEL_SIZE; c++) {
+                acc[c] = plain[c] * dst_width + carry[c] + src[c] * w0;
+                plain[c] = 0;
+                carry[c] = src[c] * w1;
+            }
+            acc += PIXEL_SIZE;
+            boundary += src_width;
+        }
+        pos = end;
+    }
+}
+
+void ResizeQuantizer::push_row_area(const uint8_t *src, int crop_row)
+{
+    const int line_size = dst_width * pixel_size;
+    if (pixel_size == 3) {
+        accumulate_row<3>(src, crop_width, dst_width, hacc);
+    }
+    else {
+        accumulate_row<1>(src, crop_width, dst_width, hacc);
+    }
+
+    const uint32_t start = (uint32_t)crop_row * dst_height;
+    const uint32_t end = start + dst_height;
+    const uint32_t row_boundary = (uint32_t)(rows_written + 1) * crop_height;
+    const uint32_t w0 = end <= row_boundary ? (uint32_t)dst_height : row_boundary - start;
+
+    for (int ix = 0; ix < line_size; ix++) {
+        vacc[ix] += hacc[ix] * w0;
+    }
+
+    if (end < row_boundary) {
+        return;
+    }
+
+    // rounded division by the area, as a multiplication that is exact for area < 2^23
+    const uint32_t half_area = ((uint32_t)crop_width * crop_height) / 2;
+    for (int ix = 0; ix < line_size; ix++) {
+        line[ix] = (uint8_t)(((uint64_t)(vacc[ix] + half_area) * area_inv) >> 55);
+    }
+    quantize_line(line);
+
+    // the rest of this source row belongs to the next output row
+    const uint32_t w1 = dst_height - w0;
+    for (int ix = 0; ix < line_size; ix++) {
+        vacc[ix] = hacc[ix] * w1;
+    }
+}
+
+void ResizeQuantizer::quantize_line(const uint8_t *row)
+{
+    int8_t *out = dst + (size_t)rows_written * dst_width * dst_channels;
+    rows_written++;
+
+    if (pixel_size == dst_channels) {
+        quantize_with_lut(row, out, dst_width * dst_channels, dst_channels, lut, lut_is_offset);
+    }
+    else if (pixel_size == 3) {
+        // ITU-R 601-2 luma transform, same weights as extract_image_features_quantized()
+        const int32_t iRedToGray = (int32_t)(0.299f * 65536.0f);
+        const int32_t iGreenToGray = (int32_t)(0.587f * 65536.0f);
+        const int32_t iBlueToGray = (int32_t)(0.114f * 65536.0f);
+        for (int x = 0; x < dst_width; x++, row += 3) {
+            int32_t gray = (iRedToGray * row[0]) + (iGreenToGray * row[1]) + (iBlueToGray * row[2]);
+            out[x] = lut[gray >> 16];
+        }
+    }
+    else {
+        for (int x = 0; x < dst_width; x++) {
+            const uint8_t v = row[x];
+            *out++ = lut[v];
+            *out++ = lut[256 + v];
+            *out++ = lut[512 + v];
+        }
+    }
+}
+
+int crop_resize_quantize_image(
+    const uint8_t *srcImage,
+    int srcWidth,
+    int srcHeight,
+    int srcStride,
+    int pixel_size_B,
+    int8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int dst_channels,
+    int mode,
+    RESIZE_INTERPOLATION interpolation,
+    const int8_t *lut)
+{
+    ResizeQuantizer resizer;
+    int res = resizer.init(
+        srcWidth,
+        srcHeight,
+        pixel_size_B,
+        dstImage,
+        dstWidth,
+        dstHeight,
+        dst_channels,
+        mode,
+        interpolation,
+        lut);
+    if (res != EIDSP_OK) {
+        return res;
+    }
+
+    const size_t stride = srcStride != 0 ? (size_t)srcStride : (size_t)srcWidth * pixel_size_B;
+    for (int y = 0; y < srcHeight && !resizer.done(); y++) {
+        res = resizer.push_row(srcImage + y * stride);
+        if (res != EIDSP_OK) {
+            return res;
+        }
+    }
+
+    return resizer.done() ? EIDSP_OK : EIDSP_BUFFER_SIZE_MISMATCH;
+}
 } //namespaces
 }
 }
@@ -216,5 +216,165 @@ int resize_image_using_mode(
     int dstHeight,
     int pixel_size_B,
     int mode);
+
+enum RESIZE_INTERPOLATION
+{
+    RESIZE_INTERPOLATION_BILINEAR = 0, // same sampling as resize_image()
+    RESIZE_INTERPOLATION_AREA = 1, // box filter over the source footprint, falls back to bilinear when upscaling
+};
+
+/**
+ * @brief Quantize 8-bit values through a table of 256 entries per channel,
+ * out[ix] = lut[(ix % channels) * 256 + in[ix]]
+ *
+ * @param in Input values, channels interleaved
+ * @param out Output buffer, count values
+ * @param count Number of values, a multiple of channels
+ * @param channels 3 for RGB, 1 for mono
+ * @param lut Quantization table, 256 * channels entries
+ * @param lut_is_offset lut[c * 256 + v] == v - 128 for every entry (scale 1/255,
+ * zero point -128), quantized without the table
+ */
+void quantize_with_lut(
+    const uint8_t *in,
+    int8_t *out,
+    int count,
+    int channels,
+    const int8_t *lut,
+    bool lut_is_offset);
+
+/**
+ * @brief Crops, resizes and quantizes an image while it streams in row by row
+ *
+ * Source rows are pushed in order with push_row(). Every output row is quantized into
+ * the int8 destination as soon as the source rows it depends on have been seen, and
+ * only a few rows of state are kept, so the full source frame never has to be in memory.
+ *
+ * Quantization goes through a table of 256 entries per destination channel
+ * (lut[channel * 256 + value]). RGB sources are converted to grayscale (ITU-R 601-2 luma
+ * on the 8-bit values) when dst_channels is 1, grayscale sources are replicated when
+ * dst_channels is 3.
+ */
+class ResizeQuantizer {
+public:
+    ResizeQuantizer();
+    ~ResizeQuantizer();
+
+    /**
+     * @brief Set up the crop and scale factors and allocate the row buffers
+     *
+     * @param srcWidth Source width in pixels
+     * @param srcHeight Source height in pixels
+     * @param pixel_size_B Size of source pixels in Bytes. 3 for RGB, 1 for mono
+     * @param dstImage Output buffer, dstWidth * dstHeight * dst_channels values
+     * @param dstWidth Output width in pixels
+     * @param dstHeight Output height in pixels
+     * @param dst_channels 3 for RGB, 1 for mono
+     * @param mode EI_CLASSIFIER_RESIZE_FIT_SHORTEST or EI_CLASSIFIER_RESIZE_SQUASH
+     * @param interpolation Filter used for resizing
+     * @param lut Quantization table, 256 * dst_channels entries. Must stay valid until done()
+     * @return int EIDSP_OK on success
+     */
+    int init(
+        int srcWidth,
+        int srcHeight,
+        int pixel_size_B,
+        int8_t *dstImage,
+        int dstWidth,
+        int dstHeight,
+        int dst_channels,
+        int mode,
+        RESIZE_INTERPOLATION interpolation,
+        const int8_t *lut);
+
+    /**
+     * @brief Feed the next source row
+     *
+     * @param row srcWidth * pixel_size_B bytes
+     * @return int EIDSP_OK on success
+     */
+    int push_row(const uint8_t *row);
+
+    /**
+     * @brief True once every output row has been written
+     */
+    bool done() const;
+
+    /**
+     * @brief Source columns push_row() reads, the rest of every row may be left undefined
+     */
+    void get_crop_columns(int &x, int &width) const;
+
+    /**
+     * @brief Upper bound of the row buffers init() allocates (through ei_scratch_malloc())
+     * for any source size and filter
+     */
+    static constexpr size_t max_buffer_size(int dstWidth, int pixel_size_B)
+    {
+        // area: one line + two uint32 accumulators per value, bilinear needs less
+        return (size_t)dstWidth * pixel_size_B * (1 + 2 * sizeof(uint32_t));
+    }
+
+private:
+    ResizeQuantizer(const ResizeQuantizer&) = delete;
+    ResizeQuantizer& operator=(const ResizeQuantizer&) = delete;
+
+    void push_row_bilinear(const uint8_t *row, int crop_row);
+    void push_row_area(const uint8_t *row, int crop_row);
+    void quantize_line(const uint8_t *row);
+
+    int src_width, src_height, pixel_size;
+    int crop_x, crop_y, crop_width, crop_height;
+    int8_t *dst;
+    int dst_width, dst_height, dst_channels;
+    RESIZE_INTERPOLATION filter;
+    uint32_t y_step; // source rows per output row, fixed point
+    uint64_t area_inv; // 2^55 / crop area, rounded up
+    const int8_t *lut;
+    bool lut_is_offset; // lut[c * 256 + v] == v - 128 for every entry
+
+    int rows_pushed;
+    int rows_written;
+
+    uint8_t *buffer; // single allocation backing the pointers below
+    uint16_t *x_index;
+    uint16_t *x_frac;
+    uint8_t *hrows[2];
+    uint8_t *line;
+    uint32_t *hacc;
+    uint32_t *vacc;
+};
+
+/**
+ * @brief Crop (fit shortest or squash), resize and quantize an image in one pass
+ * Convenience wrapper that pushes every row of an in-memory image through ResizeQuantizer
+ *
+ * @param srcImage Input buffer
+ * @param srcWidth Input width in pixels
+ * @param srcHeight Input height in pixels
+ * @param srcStride Bytes between the start of two rows, 0 for tightly packed rows
+ * @param pixel_size_B Size of pixels in Bytes.  3 for RGB, 1 for mono
+ * @param dstImage Output buffer
+ * @param dstWidth Output width in pixels
+ * @param dstHeight Output height in pixels
+ * @param dst_channels 3 for RGB, 1 for mono
+ * @param mode EI_CLASSIFIER_RESIZE_FIT_SHORTEST or EI_CLASSIFIER_RESIZE_SQUASH
+ * @param interpolation Filter used for resizing
+ * @param lut Quantization table, 256 * dst_channels entries
+ * @return int EIDSP_OK on success
+ */
+int crop_resize_quantize_image(
+    const uint8_t *srcImage,
+    int srcWidth,
+    int srcHeight,
+    int srcStride,
+    int pixel_size_B,
+    int8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int dst_channels,
+    int mode,
+    RESIZE_INTERPOLATION interpolation,
+    const int8_t *lut);
 }}} //namespaces
 #endif //!__EI_IMAGE_PROCESSING__H__
\ No newline at end of file
@@ -29,6 +29,62 @@
  * permissions, disclaimers and limitations under the License.
  */
 #include "memory.hpp"
+#include <string.h>
 
 size_t ei_memory_in_use = 0;
 size_t ei_memory_peak_use = 0;
+
+static EI_SCRATCH_THREAD_LOCAL ei_scratch_arena_t *scratch_arena = nullptr;
+
+void ei_scratch_install(ei_scratch_arena_t *arena)
+{
+    if (arena) {
+        arena->used = 0;
+    }
+    scratch_arena = arena;
+}
+
+void *ei_scratch_malloc(size_t size)
+{
+    if (!scratch_arena) {
+        return ei_malloc(size);
+    }
+
+    // keep the base aligned, buffer may come from a byte array
+    size_t offset = EI_SCRATCH_ALIGN((uintptr_t)scratch_arena->buffer + scratch_arena->used)
+        - (uintptr_t)scratch_arena->buffer;
+    if (offset > scratch_arena->size || size > scratch_arena->size - offset) {
+        scratch_arena->failed++;
+        return nullptr;
+    }
+    scratch_arena->used = offset + size;
+    if (scratch_arena->used > scratch_arena->peak) {
+        scratch_arena->peak = scratch_arena->used;
+    }
+    return scratch_arena->buffer + offset;
+}
+
+void *ei_scratch_calloc(size_t num, size_t size)
+{
+    if (!scratch_arena) {
+        return ei_calloc(num, size);
+    }
+    if (size && num > SIZE_MAX / size) {
+        scratch_arena->failed++;
+        return nullptr;
+    }
+    void *ptr = ei_scratch_malloc(num * size);
+    if (ptr) {
+        memset(ptr, 0, num * size);
+    }
+    return ptr;
+}
+
+void ei_scratch_free(void *ptr)
+{
+    if (scratch_arena && (uint8_t *)ptr >= scratch_arena->buffer &&
+        (uint8_t *)ptr < scratch_arena->buffer + scratch_arena->size) {
+        return;
+    }
+    ei_free(ptr);
+}
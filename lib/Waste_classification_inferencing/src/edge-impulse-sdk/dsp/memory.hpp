@@ -245,5 +245,57 @@ static ei_unique_ptr_t make_tracked_unique_ptr(void* ptr_in, size_t size)
 
 } // namespace ei
 
+/**
+ * Fixed buffer that the image DSP code (resize, JPEG decode) takes its working
+ * memory from instead of the heap. Allocations are bumped from the front and
+ * only handed back all at once, when the arena is installed again.
+ */
+typedef struct {
+    uint8_t *buffer;
+    size_t size;
+    size_t used;
+    size_t peak; // highest `used` since the arena was set up
+    uint32_t failed; // allocations that did not fit
+} ei_scratch_arena_t;
+
+#define EI_SCRATCH_ALIGNMENT    8
+
+/**
+ * Round an allocation up to the arena alignment, to size pools at compile time
+ */
+#define EI_SCRATCH_ALIGN(bytes) (((bytes) + EI_SCRATCH_ALIGNMENT - 1) & ~(size_t)(EI_SCRATCH_ALIGNMENT - 1))
+
+/**
+ * Thread local storage for the installed arena, so the DSP of one frame and the
+ * inference of another can run on different threads (FreeRTOS tasks on ESP32).
+ * Define as empty on toolchains without TLS; there is one arena for the whole
+ * process then, and only one inference at a time may use it.
+ */
+#ifndef EI_SCRATCH_THREAD_LOCAL
+#if defined(__linux__) || defined(__APPLE__) || defined(ESP_PLATFORM)
+#define EI_SCRATCH_THREAD_LOCAL thread_local
+#else
+#define EI_SCRATCH_THREAD_LOCAL
+#endif
+#endif
+
+/**
+ * Route ei_scratch_malloc() / ei_scratch_calloc() of the calling thread to arena
+ * (emptied first), or back to the heap for nullptr.
+ */
+void ei_scratch_install(ei_scratch_arena_t *arena);
+
+/**
+ * Allocate from the installed arena, or from the heap if there is none.
+ * Returns nullptr if the arena is full, it never falls back to the heap.
+ */
+void *ei_scratch_malloc(size_t size);
+void *ei_scratch_calloc(size_t num, size_t size);
+
+/**
+ * Free memory from ei_scratch_malloc() / ei_scratch_calloc(). A no-op for arena memory.
+ */
+void ei_scratch_free(void *ptr);
+
 // clang-format on
 #endif // _EIDSP_MEMORY_H_
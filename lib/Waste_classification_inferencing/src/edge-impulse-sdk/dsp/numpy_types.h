@@ -701,6 +701,45 @@ typedef struct ei_signal_t {
     size_t total_length;
 } signal_t;
 
+/**
+ * @brief Pixel layout of an `image_source_t` buffer.
+ */
+typedef enum {
+    EI_IMAGE_SOURCE_RGB888 = 0,     /**< 3 bytes per pixel, R, G, B */
+    EI_IMAGE_SOURCE_RGB565 = 1,     /**< 2 bytes per pixel, big-endian (high byte first), as delivered by most camera sensors */
+    EI_IMAGE_SOURCE_GRAYSCALE = 2,  /**< 1 byte per pixel */
+    EI_IMAGE_SOURCE_JPEG = 3        /**< Baseline JPEG file of `size` bytes, decoded at a reduced scale where possible */
+} image_source_format_t;
+
+/**
+ * @brief Raw 8-bit image that can be passed to `run_classifier()` instead of a
+ *  `signal_t`.
+ *
+ *  Pixels are read straight from `buffer` and quantized into the input tensor of
+ *  the model, without packing them into floats first. Images that do not have the
+ *  input size of the impulse are cropped (according to the resize mode of the impulse)
+ *  and resized in the same pass. `stride` is the distance between two rows in bytes,
+ *  which allows passing a window of a larger frame; set it to 0 for a tightly packed
+ *  buffer. JPEG frames are decoded straight into the resize, at 1/2, 1/4 or 1/8 scale
+ *  when the model input is small enough, so the full size image is never materialized.
+ *
+ * **Source**: [dsp/numpy_types.h](https://github.com/edgeimpulse/inferencing-sdk-cpp/blob/master/dsp/numpy_types.h)
+ */
+typedef struct ei_image_source_t {
+    /** Pointer to the first pixel of the image */
+    const uint8_t *buffer;
+    /** Width in pixels */
+    uint32_t width;
+    /** Height in pixels */
+    uint32_t height;
+    /** Bytes between the start of two rows, 0 if rows are tightly packed */
+    uint32_t stride;
+    /** Pixel layout */
+    image_source_format_t format;
+    /** Size of buffer in bytes, only read for EI_IMAGE_SOURCE_JPEG (width, height and stride are taken from the file) */
+    uint32_t size;
+} image_source_t;
+
 /** @} */
 
 #ifdef __cplusplus
@@ -36,6 +36,13 @@
 #if EI_PORTING_CLIB == 1
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 __attribute__((weak)) EI_IMPULSE_ERROR ei_run_impulse_check_canceled() {
     return EI_IMPULSE_OK;
@@ -52,8 +59,10 @@ uint64_t ei_read_timer_ms() {
     return ei_read_timer_us() / 1000;
 }
 
+// Monotonic wall clock, so result.timing is meaningful on host builds
 uint64_t ei_read_timer_us() {
-    return 0;
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
 __attribute__((weak)) void ei_printf(const char *format, ...) {
@@ -89,6 +98,168 @@ __attribute__((weak)) void ei_free(void *ptr) {
     free(ptr);
 }
 
+// One worker thread does the background copies, started on first use
+namespace {
+struct copy_worker_t {
+    std::mutex mutex;
+    std::condition_variable cond;
+    const ei_copy_block_t *blocks = nullptr;
+    size_t count = 0;
+    bool busy = false;
+    bool stop = false;
+    std::thread thread;
+
+    copy_worker_t() : thread(&copy_worker_t::run, this) { }
+
+    ~copy_worker_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cond.notify_all();
+        thread.join();
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cond.wait(lock, [this] { return busy || stop; });
+            if (stop) {
+                return;
+            }
+            const ei_copy_block_t *b = blocks;
+            size_t n = count;
+            lock.unlock();
+            for (size_t ix = 0; ix < n; ix++) {
+                memcpy(b[ix].dst, b[ix].src, b[ix].size);
+            }
+            lock.lock();
+            busy = false;
+            cond.notify_all();
+        }
+    }
+};
+
+copy_worker_t &copy_worker() {
+    static copy_worker_t worker;
+    return worker;
+}
+} // namespace
+
+__attribute__((weak)) EI_IMPULSE_ERROR ei_copy_async_start(const ei_copy_block_t *blocks, size_t count) {
+    copy_worker_t &w = copy_worker();
+    {
+        std::lock_guard<std::mutex> lock(w.mutex);
+        w.blocks = blocks;
+        w.count = count;
+        w.busy = true;
+    }
+    w.cond.notify_all();
+    return EI_IMPULSE_OK;
+}
+
+__attribute__((weak)) void ei_copy_async_wait(void) {
+    copy_worker_t &w = copy_worker();
+    std::unique_lock<std::mutex> lock(w.mutex);
+    w.cond.wait(lock, [&w] { return !w.busy; });
+}
+
+// Pool of threads for workers 1 and up of ei_parallel_run, grown on demand.
+// One caller at a time, a caller that finds it busy (another model instance
+// on another thread, or a kernel inside a worker of a batch) runs all of its
+// workers itself.
+namespace {
+struct parallel_pool_t {
+    std::atomic<bool> busy{false};
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    std::vector<std::thread> threads;
+    ei_parallel_fn_t fn = nullptr;
+    void *arg = nullptr;
+    int workers = 0;
+    int pending = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+
+    ~parallel_pool_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        start.notify_all();
+        for (size_t ix = 0; ix < threads.size(); ix++) {
+            threads[ix].join();
+        }
+    }
+
+    void run(int worker, uint64_t seen) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            start.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            if (worker >= workers) {
+                continue;
+            }
+            ei_parallel_fn_t f = fn;
+            void *a = arg;
+            int n = workers;
+            lock.unlock();
+            f(a, worker, n);
+            lock.lock();
+            if (--pending == 0) {
+                done.notify_all();
+            }
+        }
+    }
+};
+
+parallel_pool_t &parallel_pool() {
+    static parallel_pool_t pool;
+    return pool;
+}
+} // namespace
+
+__attribute__((weak)) EI_IMPULSE_ERROR ei_parallel_run(ei_parallel_fn_t fn, void *arg, int workers) {
+    if (workers <= 1) {
+        fn(arg, 0, 1);
+        return EI_IMPULSE_OK;
+    }
+
+    parallel_pool_t &p = parallel_pool();
+    if (p.busy.exchange(true)) {
+        for (int ix = 0; ix < workers; ix++) {
+            fn(arg, ix, workers);
+        }
+        return EI_IMPULSE_OK;
+    }
+    {
+        std::lock_guard<std::mutex> lock(p.mutex);
+        while ((int)p.threads.size() < workers - 1) {
+            int worker = (int)p.threads.size() + 1;
+            p.threads.push_back(std::thread(&parallel_pool_t::run, &p, worker, p.generation));
+        }
+        p.fn = fn;
+        p.arg = arg;
+        p.workers = workers;
+        p.pending = workers - 1;
+        p.generation++;
+    }
+    p.start.notify_all();
+
+    fn(arg, 0, workers);
+
+    {
+        std::unique_lock<std::mutex> lock(p.mutex);
+        p.done.wait(lock, [&p] { return p.pending == 0; });
+    }
+    p.busy = false;
+    return EI_IMPULSE_OK;
+}
+
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
 extern "C"
 #endif
@@ -257,6 +257,92 @@ void *ei_calloc(size_t nitems, size_t size);
  */
 void ei_free(void *ptr);
 
+/**
+ * @brief One block for ei_copy_async_start()
+ */
+typedef struct {
+    void *dst;
+    const void *src;
+    size_t size;
+} ei_copy_block_t;
+
+/**
+ * @brief Start copying blocks of memory in the background
+ *
+ * Used by the EON compiled model to stage the constants of the next layer in
+ * fast RAM while the current layer runs (EI_WEIGHT_STAGING_SIZE). The copy
+ * should be done by something other than the calling thread: DMA, a task on
+ * the other core, or a worker thread. At most one copy is in flight at a time;
+ * the caller always calls `ei_copy_async_wait()` before starting the next one,
+ * and keeps `blocks` alive until then.
+ *
+ * A port without any way to copy in the background can copy right away:
+ *
+ * ```
+ * __attribute__((weak)) EI_IMPULSE_ERROR ei_copy_async_start(const ei_copy_block_t *blocks, size_t count) {
+ *     for (size_t ix = 0; ix < count; ix++) {
+ *         memcpy(blocks[ix].dst, blocks[ix].src, blocks[ix].size);
+ *     }
+ *     return EI_IMPULSE_OK;
+ * }
+ * ```
+ *
+ * The espressif port copies on the other core, the clib port on a worker
+ * thread.
+ *
+ * @param[in] blocks Blocks to copy, must not overlap
+ * @param[in] count Number of blocks
+ * @return EI_IMPULSE_OK once the copy is underway (or done)
+ */
+EI_IMPULSE_ERROR ei_copy_async_start(const ei_copy_block_t *blocks, size_t count);
+
+/**
+ * @brief Block until the copy started by `ei_copy_async_start()` is done
+ *
+ * Returns right away when there is no copy in flight.
+ */
+void ei_copy_async_wait(void);
+
+/**
+ * @brief Work function for ei_parallel_run()
+ *
+ * @param[in] arg As passed to ei_parallel_run()
+ * @param[in] worker This worker, 0 to workers - 1
+ * @param[in] workers Number of workers
+ */
+typedef void (*ei_parallel_fn_t)(void *arg, int worker, int workers);
+
+/**
+ * @brief Run a function on several workers at once
+ *
+ * Calls `fn(arg, worker, workers)` for every worker from 0 to `workers - 1`,
+ * at the same time where the platform can, and returns when all of them are
+ * done. The calling thread runs worker 0. Used by the kernels to split their
+ * output rows across cores (EI_CLASSIFIER_PARALLEL_WORKERS), each worker
+ * writes its own part of the output, so the result does not depend on how
+ * the calls are scheduled. A port without threads can run them in turn:
+ *
+ * ```
+ * __attribute__((weak)) EI_IMPULSE_ERROR ei_parallel_run(ei_parallel_fn_t fn, void *arg, int workers) {
+ *     for (int ix = 0; ix < workers; ix++) {
+ *         fn(arg, ix, workers);
+ *     }
+ *     return EI_IMPULSE_OK;
+ * }
+ * ```
+ *
+ * The espressif port runs the other workers on tasks pinned to the other
+ * cores, the clib port on a pool of threads. Model instances on several
+ * threads can call this at the same time, so it must be reentrant: both ports
+ * run all workers on the caller while another call has the helpers.
+ *
+ * @param[in] fn Work function
+ * @param[in] arg Passed to every call
+ * @param[in] workers Number of workers, at least 1
+ * @return EI_IMPULSE_OK once every worker is done
+ */
+EI_IMPULSE_ERROR ei_parallel_run(ei_parallel_fn_t fn, void *arg, int workers);
+
 /** @} */
 
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -257,6 +257,22 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                         const conv_params_t *conv_params,
                         const quant_data_t *quant_data);
 
+/**
+ * @brief       esp_nn_conv_s8_opt() on a filter packed ahead of time
+ *
+ * @note        packed_filter and filter_base as in esp_nn_conv_packed.h;
+ *              filter_base takes the place of the bias
+ */
+void esp_nn_conv_s8_packed_opt(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *packed_filter,
+                               const int32_t *filter_base,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data);
+
 /**
  * @brief       depthwise convolution per channel optimized version
  *
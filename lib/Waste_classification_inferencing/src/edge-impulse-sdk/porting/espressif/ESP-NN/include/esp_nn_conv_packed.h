@@ -0,0 +1,101 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @file        Filter layout of esp_nn_conv_s8_packed_opt(), packed ahead of
+ *              time (by the model export, not at run time)
+ *
+ * The OHWI filter of a convolution, with the output channels in blocks of
+ * four and the four filters of a block interleaved element by element, so one
+ * pointer walks all four:
+ *
+ *     packed[(block * size + i) * 4 + ch] = filter[(block * 4 + ch) * size + i]
+ *
+ * where size = filter height * width * input channels. The last
+ * out_channels % 4 filters follow as they are. The packed filter is as long as
+ * the filter.
+ *
+ * With it goes the part of every accumulator that does not depend on the
+ * input, bias + in_offset * sum(filter), one per output channel (filter_base).
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void esp_nn_conv_pack_filter_s8(const int8_t *filter,
+                                              int32_t out_channels,
+                                              int32_t size,
+                                              int8_t *packed)
+{
+    const int32_t blocks = out_channels / 4;
+    for (int32_t block = 0; block < blocks; block++) {
+        const int8_t *src = filter + block * 4 * size;
+        int8_t *dst = packed + block * 4 * size;
+        for (int32_t i = 0; i < size; i++) {
+            dst[i * 4 + 0] = src[i];
+            dst[i * 4 + 1] = src[size + i];
+            dst[i * 4 + 2] = src[2 * size + i];
+            dst[i * 4 + 3] = src[3 * size + i];
+        }
+    }
+    for (int32_t i = blocks * 4 * size; i < out_channels * size; i++) {
+        packed[i] = filter[i];
+    }
+}
+
+/* bias can be NULL */
+static inline void esp_nn_conv_filter_base_s8(const int8_t *filter,
+                                              const int32_t *bias,
+                                              int32_t out_channels,
+                                              int32_t size,
+                                              int32_t in_offset,
+                                              int32_t *filter_base)
+{
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+        int32_t sum = 0;
+        for (int32_t i = 0; i < size; i++) {
+            sum += filter[out_ch_idx * size + i];
+        }
+        filter_base[out_ch_idx] = sum * in_offset + (bias ? bias[out_ch_idx] : 0);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
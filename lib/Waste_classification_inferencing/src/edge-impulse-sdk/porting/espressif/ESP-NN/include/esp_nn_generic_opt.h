@@ -28,6 +28,8 @@
 #define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_opt
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_opt
+/* only the generic kernels take a packed filter (esp_nn_conv_packed.h) */
+#define esp_nn_conv_s8_packed esp_nn_conv_s8_packed_opt
 
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_opt
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_opt
@@ -31,6 +31,45 @@ void esp_nn_set_conv_scratch_buf_opt(const void *buf)
 
 }
 
+/**
+ * The kernels below are for cores without SIMD (the plain ESP32). They keep
+ * the input offset out of the inner loops:
+ *     sum((in + in_offset) * filter) = sum(in * filter) + in_offset * sum(filter)
+ * and sum(filter), together with the bias, is worked out once per output
+ * channel. Output channels go four at a time, so one input load feeds four
+ * multiply-accumulates; the outer loop is over output channels, which keeps
+ * the four filters (in flash) in cache while the activations stream past.
+ */
+
+__NN_FORCE_INLINE__ int8_t esp_nn_conv_requant(int32_t acc, int32_t mult, int32_t shift,
+                                               int32_t out_offset,
+                                               int32_t activation_min,
+                                               int32_t activation_max)
+{
+    acc = esp_nn_multiply_by_quantized_mult_fast(acc, mult, shift);
+    acc += out_offset;
+    acc = max(acc, activation_min);
+    acc = min(acc, activation_max);
+    return (int8_t) acc;
+}
+
+/* bias + in_offset * sum(filter) of one output channel */
+__NN_FORCE_INLINE__ int32_t esp_nn_conv_filter_base(const int8_t *filter, int32_t size,
+                                                    int32_t input_offset,
+                                                    const int32_t *bias, int32_t out_ch_idx)
+{
+    int32_t sum = 0;
+    for (int32_t i = 0; i < size; i++) {
+        sum += filter[i];
+    }
+    return sum * input_offset + (bias ? bias[out_ch_idx] : 0);
+}
+
+/**
+ * 1x1 convolution: two pixels by four output channels (eight accumulators)
+ * per inner loop, so each filter byte is used twice and each input byte four
+ * times. With stride 1 the whole output is one run of pixels.
+ */
 __attribute__ ((noinline))
 static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
                                const int8_t *input_data,
@@ -42,52 +81,138 @@ static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
                                const quant_data_t *quant_data)
 {
     const uint16_t input_wd = input_dims->width;
-    const uint16_t in_channels = input_dims->channels;
+    const int32_t in_channels = input_dims->channels;
     const int32_t input_offset = conv_params->in_offset;
     const int32_t out_offset = conv_params->out_offset;
     const uint16_t stride_wd = conv_params->stride.width;
     const uint16_t stride_ht = conv_params->stride.height;
     const uint16_t out_wd = output_dims->width;
     const uint16_t out_ht = output_dims->height;
-    const uint16_t out_channels = output_dims->channels;
+    const int32_t out_channels = output_dims->channels;
     const int32_t activation_min = conv_params->activation.min;
     const int32_t activation_max = conv_params->activation.max;
 
-    for (int32_t in_row = 0; in_row < out_ht * stride_ht; in_row += stride_ht) {
-        for (int32_t in_col = 0; in_col < out_wd * stride_wd; in_col += stride_wd) {
-            const int32_t *out_mult = quant_data->mult;
-            const int32_t *out_shift = quant_data->shift;
-            const int8_t *filter_ptr = filter_data;
-            const int8_t *input_base_ptr = input_data + (in_row * input_wd + in_col) * in_channels;
-            int32_t out_ch_idx = 0;
-            for (; out_ch_idx < out_channels; out_ch_idx++) {
-                int32_t conv_out = 0;
-
-                const int8_t *input_ptr = input_base_ptr;
-
-                int32_t in_ch_idx = 0;
-                for (; in_ch_idx < in_channels - 3; in_ch_idx += 4) {
-                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+    const int flat = (stride_wd == 1 && stride_ht == 1);
+    const int32_t rows = flat ? 1 : out_ht;
+    const int32_t cols = flat ? out_ht * out_wd : out_wd;
+    const int32_t in_step = stride_wd * in_channels;
+
+    int32_t out_ch_idx = 0;
+    for (; out_ch_idx < out_channels - 3; out_ch_idx += 4) {
+        const int8_t *filter0 = filter_data + out_ch_idx * in_channels;
+        const int8_t *filter1 = filter0 + in_channels;
+        const int8_t *filter2 = filter1 + in_channels;
+        const int8_t *filter3 = filter2 + in_channels;
+        const int32_t base0 = esp_nn_conv_filter_base(filter0, in_channels, input_offset, bias, out_ch_idx + 0);
+        const int32_t base1 = esp_nn_conv_filter_base(filter1, in_channels, input_offset, bias, out_ch_idx + 1);
+        const int32_t base2 = esp_nn_conv_filter_base(filter2, in_channels, input_offset, bias, out_ch_idx + 2);
+        const int32_t base3 = esp_nn_conv_filter_base(filter3, in_channels, input_offset, bias, out_ch_idx + 3);
+        const int32_t *out_mult = quant_data->mult + out_ch_idx;
+        const int32_t *out_shift = quant_data->shift + out_ch_idx;
+
+        for (int32_t row = 0; row < rows; row++) {
+            const int8_t *input_ptr = input_data + row * stride_ht * input_wd * in_channels;
+            int8_t *out_ptr = out_data + row * cols * out_channels + out_ch_idx;
+            int32_t col = 0;
+            for (; col < cols - 1; col += 2) {
+                const int8_t *in0 = input_ptr;
+                const int8_t *in1 = input_ptr + in_step;
+                int32_t acc00 = base0, acc01 = base1, acc02 = base2, acc03 = base3;
+                int32_t acc10 = base0, acc11 = base1, acc12 = base2, acc13 = base3;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    const int32_t in_val0 = in0[in_ch_idx];
+                    const int32_t in_val1 = in1[in_ch_idx];
+                    const int32_t filter_val0 = filter0[in_ch_idx];
+                    const int32_t filter_val1 = filter1[in_ch_idx];
+                    const int32_t filter_val2 = filter2[in_ch_idx];
+                    const int32_t filter_val3 = filter3[in_ch_idx];
+                    acc00 += in_val0 * filter_val0;
+                    acc01 += in_val0 * filter_val1;
+                    acc02 += in_val0 * filter_val2;
+                    acc03 += in_val0 * filter_val3;
+                    acc10 += in_val1 * filter_val0;
+                    acc11 += in_val1 * filter_val1;
+                    acc12 += in_val1 * filter_val2;
+                    acc13 += in_val1 * filter_val3;
                 }
-                for (; in_ch_idx < in_channels; in_ch_idx ++) {
-                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                out_ptr[0] = esp_nn_conv_requant(acc00, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc01, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc02, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc03, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                out_ptr[0] = esp_nn_conv_requant(acc10, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc11, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc12, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc13, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                input_ptr += 2 * in_step;
+            }
+            if (col < cols) {
+                int32_t acc0 = base0, acc1 = base1, acc2 = base2, acc3 = base3;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    const int32_t in_val = input_ptr[in_ch_idx];
+                    acc0 += in_val * filter0[in_ch_idx];
+                    acc1 += in_val * filter1[in_ch_idx];
+                    acc2 += in_val * filter2[in_ch_idx];
+                    acc3 += in_val * filter3[in_ch_idx];
                 }
-                if (bias) {
-                    conv_out += bias[out_ch_idx];
+                out_ptr[0] = esp_nn_conv_requant(acc0, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc1, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc2, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc3, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+            }
+        }
+    }
+    for (; out_ch_idx < out_channels; out_ch_idx++) {
+        const int8_t *filter_ptr = filter_data + out_ch_idx * in_channels;
+        const int32_t base = esp_nn_conv_filter_base(filter_ptr, in_channels, input_offset, bias, out_ch_idx);
+        const int32_t out_mult = quant_data->mult[out_ch_idx];
+        const int32_t out_shift = quant_data->shift[out_ch_idx];
+
+        for (int32_t row = 0; row < rows; row++) {
+            const int8_t *input_ptr = input_data + row * stride_ht * input_wd * in_channels;
+            int8_t *out_ptr = out_data + row * cols * out_channels + out_ch_idx;
+            for (int32_t col = 0; col < cols; col++) {
+                int32_t acc = base;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    acc += input_ptr[in_ch_idx] * filter_ptr[in_ch_idx];
                 }
-                conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, *out_mult++, *out_shift++);
-                conv_out += out_offset;
-                conv_out = max(conv_out, activation_min);
-                conv_out = min(conv_out, activation_max);
-                *out_data++ = (int8_t) conv_out;
+                *out_ptr = esp_nn_conv_requant(acc, out_mult, out_shift, out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                input_ptr += in_step;
             }
         }
     }
 }
 
+/**
+ * Sum of (input + in_offset) * filter over the part of the window inside the
+ * input, for a window that crosses the border (padding).
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_conv_border_sum(const int8_t *input_data, const int8_t *filter_ptr,
+                                                   int32_t base_y, int32_t base_x,
+                                                   int32_t input_wd, int32_t input_ht,
+                                                   int32_t filter_wd, int32_t filter_ht,
+                                                   int32_t in_channels, int32_t input_offset)
+{
+    const int32_t filter_y_start = max(0, -base_y);
+    const int32_t filter_x_start = max(0, -base_x);
+    const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+    const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+    const int32_t run = (filter_x_end - filter_x_start) * in_channels;
+    int32_t sum = 0;
+
+    for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+        const int8_t *input_ptr = input_data +
+                        ((base_y + filter_y_idx) * input_wd + base_x + filter_x_start) * in_channels;
+        const int8_t *row_filter = filter_ptr + (filter_y_idx * filter_wd + filter_x_start) * in_channels;
+        for (int32_t i = 0; i < run; i++) {
+            sum += (input_ptr[i] + input_offset) * row_filter[i];
+        }
+    }
+    return sum;
+}
+
 /**
  * Assumption 1: i/p channels == o/p channels
  * Assumption 2: Pointers are valid
@@ -112,9 +237,9 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
         return;
     }
 
-    const uint16_t input_wd = input_dims->width;
-    const uint16_t input_ht = input_dims->height;
-    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t in_channels = input_dims->channels;
     const int32_t input_offset = conv_params->in_offset;
     const int32_t out_offset = conv_params->out_offset;
     const uint16_t pad_wd = conv_params->padding.width;
@@ -123,61 +248,368 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
     const uint16_t stride_ht = conv_params->stride.height;
     const uint16_t out_wd = output_dims->width;
     const uint16_t out_ht = output_dims->height;
-    const uint16_t out_channels = output_dims->channels;
+    const int32_t out_channels = output_dims->channels;
     const int32_t activation_min = conv_params->activation.min;
     const int32_t activation_max = conv_params->activation.max;
 
-    int32_t out_ch_idx, out_y, out_x, filter_y_idx, filter_x_idx;
+    /* a filter row is one contiguous run of input: filter_wd pixels, all channels */
+    const int32_t run = filter_wd * in_channels;
+    const int32_t filter_size = filter_ht * run;
 
-    for (out_y = 0; out_y < out_ht; out_y++) {
-        for (out_x = 0; out_x < out_wd; out_x++) {
-            const int32_t *out_shift = quant_data->shift;
-            const int32_t *out_mult = quant_data->mult;
-            for (out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
-                int32_t conv_out = 0;
+    int32_t out_ch_idx = 0;
+    for (; out_ch_idx < out_channels - 3; out_ch_idx += 4) {
+        const int8_t *filter0 = filter_data + out_ch_idx * filter_size;
+        const int8_t *filter1 = filter0 + filter_size;
+        const int8_t *filter2 = filter1 + filter_size;
+        const int8_t *filter3 = filter2 + filter_size;
+        const int32_t base0 = esp_nn_conv_filter_base(filter0, filter_size, input_offset, bias, out_ch_idx + 0);
+        const int32_t base1 = esp_nn_conv_filter_base(filter1, filter_size, input_offset, bias, out_ch_idx + 1);
+        const int32_t base2 = esp_nn_conv_filter_base(filter2, filter_size, input_offset, bias, out_ch_idx + 2);
+        const int32_t base3 = esp_nn_conv_filter_base(filter3, filter_size, input_offset, bias, out_ch_idx + 3);
+        const int32_t *out_mult = quant_data->mult + out_ch_idx;
+        const int32_t *out_shift = quant_data->shift + out_ch_idx;
 
-                const int32_t base_y = stride_ht * out_y - pad_ht;
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = stride_ht * out_y - pad_ht;
+            const int inside_y = base_y >= 0 && base_y + filter_ht <= input_ht;
+            int8_t *out_ptr = out_data + out_y * out_wd * out_channels + out_ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += out_channels) {
                 const int32_t base_x = stride_wd * out_x - pad_wd;
-
-                const int32_t filter_y_start = max(0, -base_y);
-                const int32_t filter_x_start = max(0, -base_x);
-
-                const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
-                const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
-
-                for (filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
-                    for (filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                        const int32_t in_row = base_y + filter_y_idx;
-                        const int32_t in_col = base_x + filter_x_idx;
-
-                        const int8_t *input_ptr = input_data +
-                                        (in_row * input_wd + in_col) * in_channels;
-                        const int8_t *filter_ptr = filter_data +
-                                        out_ch_idx * in_channels * filter_ht * filter_wd +
-                                        (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
-                        int32_t in_ch_idx = 0;
-                        for (; in_ch_idx < in_channels - 3; in_ch_idx += 4) {
-                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
-                        }
-                        for (; in_ch_idx < in_channels; in_ch_idx ++) {
-                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                int32_t acc0, acc1, acc2, acc3;
+                if (inside_y && base_x >= 0 && base_x + filter_wd <= input_wd) {
+                    acc0 = base0;
+                    acc1 = base1;
+                    acc2 = base2;
+                    acc3 = base3;
+                    const int8_t *input_ptr = input_data + (base_y * input_wd + base_x) * in_channels;
+                    int32_t filter_idx = 0;
+                    for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                        for (int32_t i = 0; i < run; i++, filter_idx++) {
+                            const int32_t in_val = input_ptr[i];
+                            acc0 += in_val * filter0[filter_idx];
+                            acc1 += in_val * filter1[filter_idx];
+                            acc2 += in_val * filter2[filter_idx];
+                            acc3 += in_val * filter3[filter_idx];
                         }
+                        input_ptr += input_wd * in_channels;
                     }
+                } else {
+                    const int32_t bias0 = bias ? bias[out_ch_idx + 0] : 0;
+                    const int32_t bias1 = bias ? bias[out_ch_idx + 1] : 0;
+                    const int32_t bias2 = bias ? bias[out_ch_idx + 2] : 0;
+                    const int32_t bias3 = bias ? bias[out_ch_idx + 3] : 0;
+                    acc0 = bias0 + esp_nn_conv_border_sum(input_data, filter0, base_y, base_x, input_wd, input_ht,
+                                                          filter_wd, filter_ht, in_channels, input_offset);
+                    acc1 = bias1 + esp_nn_conv_border_sum(input_data, filter1, base_y, base_x, input_wd, input_ht,
+                                                          filter_wd, filter_ht, in_channels, input_offset);
+                    acc2 = bias2 + esp_nn_conv_border_sum(input_data, filter2, base_y, base_x, input_wd, input_ht,
+                                                          filter_wd, filter_ht, in_channels, input_offset);
+                    acc3 = bias3 + esp_nn_conv_border_sum(input_data, filter3, base_y, base_x, input_wd, input_ht,
+                                                          filter_wd, filter_ht, in_channels, input_offset);
+                }
+                out_ptr[0] = esp_nn_conv_requant(acc0, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc1, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc2, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc3, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+            }
+        }
+    }
+    for (; out_ch_idx < out_channels; out_ch_idx++) {
+        const int8_t *filter_ptr = filter_data + out_ch_idx * filter_size;
+        const int32_t bias_val = bias ? bias[out_ch_idx] : 0;
+        const int32_t out_mult = quant_data->mult[out_ch_idx];
+        const int32_t out_shift = quant_data->shift[out_ch_idx];
+
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = stride_ht * out_y - pad_ht;
+            int8_t *out_ptr = out_data + out_y * out_wd * out_channels + out_ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += out_channels) {
+                const int32_t base_x = stride_wd * out_x - pad_wd;
+                const int32_t acc = bias_val +
+                        esp_nn_conv_border_sum(input_data, filter_ptr, base_y, base_x, input_wd, input_ht,
+                                               filter_wd, filter_ht, in_channels, input_offset);
+                *out_ptr = esp_nn_conv_requant(acc, out_mult, out_shift, out_offset, activation_min, activation_max);
+            }
+        }
+    }
+}
+
+/**
+ * The kernels below take the filter packed ahead of time
+ * (esp_nn_conv_packed.h): a block of four output channels is one run of
+ * interleaved bytes, walked by a single pointer, and bias + in_offset *
+ * sum(filter) comes precomputed in filter_base. Otherwise they are the ones
+ * above, and their outputs the same.
+ */
+
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_packed_1x1(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const int8_t *packed_filter,
+                                      const int32_t *filter_base,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const conv_params_t *conv_params,
+                                      const quant_data_t *quant_data)
+{
+    const uint16_t input_wd = input_dims->width;
+    const int32_t in_channels = input_dims->channels;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const int32_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    const int flat = (stride_wd == 1 && stride_ht == 1);
+    const int32_t rows = flat ? 1 : out_ht;
+    const int32_t cols = flat ? out_ht * out_wd : out_wd;
+    const int32_t in_step = stride_wd * in_channels;
+
+    int32_t out_ch_idx = 0;
+    for (; out_ch_idx < out_channels - 3; out_ch_idx += 4) {
+        const int8_t *filter = packed_filter + out_ch_idx * in_channels;
+        const int32_t base0 = filter_base[out_ch_idx + 0];
+        const int32_t base1 = filter_base[out_ch_idx + 1];
+        const int32_t base2 = filter_base[out_ch_idx + 2];
+        const int32_t base3 = filter_base[out_ch_idx + 3];
+        const int32_t *out_mult = quant_data->mult + out_ch_idx;
+        const int32_t *out_shift = quant_data->shift + out_ch_idx;
+
+        for (int32_t row = 0; row < rows; row++) {
+            const int8_t *input_ptr = input_data + row * stride_ht * input_wd * in_channels;
+            int8_t *out_ptr = out_data + row * cols * out_channels + out_ch_idx;
+            int32_t col = 0;
+            for (; col < cols - 1; col += 2) {
+                const int8_t *in0 = input_ptr;
+                const int8_t *in1 = input_ptr + in_step;
+                const int8_t *filter_ptr = filter;
+                int32_t acc00 = base0, acc01 = base1, acc02 = base2, acc03 = base3;
+                int32_t acc10 = base0, acc11 = base1, acc12 = base2, acc13 = base3;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++, filter_ptr += 4) {
+                    const int32_t in_val0 = in0[in_ch_idx];
+                    const int32_t in_val1 = in1[in_ch_idx];
+                    const int32_t filter_val0 = filter_ptr[0];
+                    const int32_t filter_val1 = filter_ptr[1];
+                    const int32_t filter_val2 = filter_ptr[2];
+                    const int32_t filter_val3 = filter_ptr[3];
+                    acc00 += in_val0 * filter_val0;
+                    acc01 += in_val0 * filter_val1;
+                    acc02 += in_val0 * filter_val2;
+                    acc03 += in_val0 * filter_val3;
+                    acc10 += in_val1 * filter_val0;
+                    acc11 += in_val1 * filter_val1;
+                    acc12 += in_val1 * filter_val2;
+                    acc13 += in_val1 * filter_val3;
                 }
-                if (bias) {
-                    conv_out += bias[out_ch_idx];
+                out_ptr[0] = esp_nn_conv_requant(acc00, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc01, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc02, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc03, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                out_ptr[0] = esp_nn_conv_requant(acc10, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc11, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc12, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc13, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                input_ptr += 2 * in_step;
+            }
+            if (col < cols) {
+                const int8_t *filter_ptr = filter;
+                int32_t acc0 = base0, acc1 = base1, acc2 = base2, acc3 = base3;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++, filter_ptr += 4) {
+                    const int32_t in_val = input_ptr[in_ch_idx];
+                    acc0 += in_val * filter_ptr[0];
+                    acc1 += in_val * filter_ptr[1];
+                    acc2 += in_val * filter_ptr[2];
+                    acc3 += in_val * filter_ptr[3];
+                }
+                out_ptr[0] = esp_nn_conv_requant(acc0, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc1, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc2, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc3, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+            }
+        }
+    }
+    for (; out_ch_idx < out_channels; out_ch_idx++) {
+        const int8_t *filter_ptr = packed_filter + out_ch_idx * in_channels;
+        const int32_t base = filter_base[out_ch_idx];
+        const int32_t out_mult = quant_data->mult[out_ch_idx];
+        const int32_t out_shift = quant_data->shift[out_ch_idx];
+
+        for (int32_t row = 0; row < rows; row++) {
+            const int8_t *input_ptr = input_data + row * stride_ht * input_wd * in_channels;
+            int8_t *out_ptr = out_data + row * cols * out_channels + out_ch_idx;
+            for (int32_t col = 0; col < cols; col++) {
+                int32_t acc = base;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                    acc += input_ptr[in_ch_idx] * filter_ptr[in_ch_idx];
                 }
-                conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, *out_mult++, *out_shift++);
-                conv_out += out_offset;
-                conv_out = max(conv_out, activation_min);
-                conv_out = min(conv_out, activation_max);
-                *out_data++ = (int8_t) conv_out;
+                *out_ptr = esp_nn_conv_requant(acc, out_mult, out_shift, out_offset, activation_min, activation_max);
+                out_ptr += out_channels;
+                input_ptr += in_step;
             }
         }
     }
 }
 
+/**
+ * Window of a packed block that crosses the border (padding), added to
+ * acc[0..3]. A tap outside the input reads -in_offset, which cancels its
+ * share of filter_base.
+ */
+__NN_FORCE_INLINE__ void esp_nn_conv_packed_border4(const int8_t *input_data, const int8_t *filter,
+                                                    int32_t base_y, int32_t base_x,
+                                                    int32_t input_wd, int32_t input_ht,
+                                                    int32_t filter_wd, int32_t filter_ht,
+                                                    int32_t in_channels, int32_t input_offset,
+                                                    int32_t *acc)
+{
+    int32_t acc0 = acc[0], acc1 = acc[1], acc2 = acc[2], acc3 = acc[3];
+    for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+        const int32_t idx_y = base_y + filter_y_idx;
+        for (int32_t filter_x_idx = 0; filter_x_idx < filter_wd; filter_x_idx++) {
+            const int32_t idx_x = base_x + filter_x_idx;
+            if (idx_y < 0 || idx_y >= input_ht || idx_x < 0 || idx_x >= input_wd) {
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++, filter += 4) {
+                    acc0 -= input_offset * filter[0];
+                    acc1 -= input_offset * filter[1];
+                    acc2 -= input_offset * filter[2];
+                    acc3 -= input_offset * filter[3];
+                }
+            } else {
+                const int8_t *input_ptr = input_data + (idx_y * input_wd + idx_x) * in_channels;
+                for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++, filter += 4) {
+                    const int32_t in_val = input_ptr[in_ch_idx];
+                    acc0 += in_val * filter[0];
+                    acc1 += in_val * filter[1];
+                    acc2 += in_val * filter[2];
+                    acc3 += in_val * filter[3];
+                }
+            }
+        }
+    }
+    acc[0] = acc0;
+    acc[1] = acc1;
+    acc[2] = acc2;
+    acc[3] = acc3;
+}
+
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_packed(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *packed_filter,
+                                  const int32_t *filter_base,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const conv_params_t *conv_params,
+                                  const quant_data_t *quant_data)
+{
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const int32_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    const int32_t run = filter_wd * in_channels;
+    const int32_t filter_size = filter_ht * run;
+
+    int32_t out_ch_idx = 0;
+    for (; out_ch_idx < out_channels - 3; out_ch_idx += 4) {
+        const int8_t *filter = packed_filter + out_ch_idx * filter_size;
+        const int32_t *out_mult = quant_data->mult + out_ch_idx;
+        const int32_t *out_shift = quant_data->shift + out_ch_idx;
+
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = stride_ht * out_y - pad_ht;
+            const int inside_y = base_y >= 0 && base_y + filter_ht <= input_ht;
+            int8_t *out_ptr = out_data + out_y * out_wd * out_channels + out_ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += out_channels) {
+                const int32_t base_x = stride_wd * out_x - pad_wd;
+                int32_t acc[4] = { filter_base[out_ch_idx + 0], filter_base[out_ch_idx + 1],
+                                   filter_base[out_ch_idx + 2], filter_base[out_ch_idx + 3] };
+                if (inside_y && base_x >= 0 && base_x + filter_wd <= input_wd) {
+                    int32_t acc0 = acc[0], acc1 = acc[1], acc2 = acc[2], acc3 = acc[3];
+                    const int8_t *input_ptr = input_data + (base_y * input_wd + base_x) * in_channels;
+                    const int8_t *filter_ptr = filter;
+                    for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                        for (int32_t i = 0; i < run; i++, filter_ptr += 4) {
+                            const int32_t in_val = input_ptr[i];
+                            acc0 += in_val * filter_ptr[0];
+                            acc1 += in_val * filter_ptr[1];
+                            acc2 += in_val * filter_ptr[2];
+                            acc3 += in_val * filter_ptr[3];
+                        }
+                        input_ptr += input_wd * in_channels;
+                    }
+                    acc[0] = acc0;
+                    acc[1] = acc1;
+                    acc[2] = acc2;
+                    acc[3] = acc3;
+                } else {
+                    esp_nn_conv_packed_border4(input_data, filter, base_y, base_x, input_wd, input_ht,
+                                               filter_wd, filter_ht, in_channels, input_offset, acc);
+                }
+                out_ptr[0] = esp_nn_conv_requant(acc[0], out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_conv_requant(acc[1], out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_conv_requant(acc[2], out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_conv_requant(acc[3], out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+            }
+        }
+    }
+    for (; out_ch_idx < out_channels; out_ch_idx++) {
+        /* the filters after the blocks are not interleaved: back to the bias and sum every tap */
+        const int8_t *filter = packed_filter + out_ch_idx * filter_size;
+        const int32_t bias_val = filter_base[out_ch_idx] -
+                        esp_nn_conv_filter_base(filter, filter_size, input_offset, NULL, 0);
+        const int32_t out_mult = quant_data->mult[out_ch_idx];
+        const int32_t out_shift = quant_data->shift[out_ch_idx];
+
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = stride_ht * out_y - pad_ht;
+            int8_t *out_ptr = out_data + out_y * out_wd * out_channels + out_ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += out_channels) {
+                const int32_t base_x = stride_wd * out_x - pad_wd;
+                const int32_t acc = bias_val +
+                        esp_nn_conv_border_sum(input_data, filter, base_y, base_x, input_wd, input_ht,
+                                               filter_wd, filter_ht, in_channels, input_offset);
+                *out_ptr = esp_nn_conv_requant(acc, out_mult, out_shift, out_offset, activation_min, activation_max);
+            }
+        }
+    }
+}
+
+void esp_nn_conv_s8_packed_opt(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *packed_filter,
+                               const int32_t *filter_base,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data)
+{
+    if (filter_dims->width == 1 && filter_dims->height == 1) {
+        esp_nn_conv_s8_packed_1x1(input_dims, input_data, packed_filter, filter_base,
+                                  output_dims, out_data, conv_params, quant_data);
+        return;
+    }
+    esp_nn_conv_s8_packed(input_dims, input_data, filter_dims, packed_filter, filter_base,
+                          output_dims, out_data, conv_params, quant_data);
+}
+
 #endif // EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN
@@ -30,6 +30,208 @@ void esp_nn_set_depthwise_conv_scratch_buf_opt(const void *buf)
 
 }
 
+__NN_FORCE_INLINE__ int8_t esp_nn_depthwise_requant(int32_t acc, int32_t mult, int32_t shift,
+                                                    int32_t out_offset,
+                                                    int32_t activation_min,
+                                                    int32_t activation_max)
+{
+    acc = esp_nn_multiply_by_quantized_mult_fast(acc, mult, shift);
+    acc += out_offset;
+    acc = max(acc, activation_min);
+    acc = min(acc, activation_max);
+    return (int8_t) acc;
+}
+
+/* one filter tap of four channels: in[0..3] * filter[0..3] */
+#define ESP_NN_DW_TAP4(in, filter)          \
+    do {                                    \
+        acc0 += (in)[0] * (filter)[0];      \
+        acc1 += (in)[1] * (filter)[1];      \
+        acc2 += (in)[2] * (filter)[2];      \
+        acc3 += (in)[3] * (filter)[3];      \
+    } while (0)
+
+/**
+ * 3x3, channel multiplier 1, for cores without SIMD (the plain ESP32).
+ * Channels go four at a time in the outer loop: the 36 filter values of the
+ * group are copied once to the stack, and the input offset is taken out of
+ * the inner loop as in_offset * sum(filter), added to the bias once per
+ * channel. Windows fully inside the input run the nine taps unrolled; the
+ * ones crossing the border (padding) add the offset tap by tap.
+ * The strides are arguments so the callers below get a copy with them fixed.
+ */
+__NN_FORCE_INLINE__ void esp_nn_depthwise_conv_s8_3x3_body(const data_dims_t *input_dims,
+                                                           const int8_t *input_data,
+                                                           const int8_t *filter_data,
+                                                           const int32_t *bias,
+                                                           const data_dims_t *output_dims,
+                                                           int8_t *out_data,
+                                                           const dw_conv_params_t *conv_params,
+                                                           const quant_data_t *quant_data,
+                                                           const int32_t stride_wd,
+                                                           const int32_t stride_ht)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t pad_ht = conv_params->padding.height;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t row_size = input_wd * channels;
+
+    int32_t ch_idx = 0;
+    for (; ch_idx < channels - 3; ch_idx += 4) {
+        int32_t filter[9 * 4];
+        int32_t base0 = bias ? bias[ch_idx + 0] : 0;
+        int32_t base1 = bias ? bias[ch_idx + 1] : 0;
+        int32_t base2 = bias ? bias[ch_idx + 2] : 0;
+        int32_t base3 = bias ? bias[ch_idx + 3] : 0;
+        const int32_t bias0 = base0, bias1 = base1, bias2 = base2, bias3 = base3;
+        for (int32_t tap = 0; tap < 9; tap++) {
+            const int8_t *filter_ptr = filter_data + tap * channels + ch_idx;
+            filter[tap * 4 + 0] = filter_ptr[0];
+            filter[tap * 4 + 1] = filter_ptr[1];
+            filter[tap * 4 + 2] = filter_ptr[2];
+            filter[tap * 4 + 3] = filter_ptr[3];
+            base0 += filter_ptr[0] * input_offset;
+            base1 += filter_ptr[1] * input_offset;
+            base2 += filter_ptr[2] * input_offset;
+            base3 += filter_ptr[3] * input_offset;
+        }
+        const int32_t *out_mult = quant_data->mult + ch_idx;
+        const int32_t *out_shift = quant_data->shift + ch_idx;
+
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = out_y * stride_ht - pad_ht;
+            const int inside_y = base_y >= 0 && base_y + 3 <= input_ht;
+            int8_t *out_ptr = out_data + out_y * out_wd * channels + ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += channels) {
+                const int32_t base_x = out_x * stride_wd - pad_wd;
+                int32_t acc0, acc1, acc2, acc3;
+                if (inside_y && base_x >= 0 && base_x + 3 <= input_wd) {
+                    const int8_t *in = input_data + base_y * row_size + base_x * channels + ch_idx;
+                    acc0 = base0;
+                    acc1 = base1;
+                    acc2 = base2;
+                    acc3 = base3;
+                    ESP_NN_DW_TAP4(in, filter + 0);
+                    ESP_NN_DW_TAP4(in + channels, filter + 4);
+                    ESP_NN_DW_TAP4(in + 2 * channels, filter + 8);
+                    in += row_size;
+                    ESP_NN_DW_TAP4(in, filter + 12);
+                    ESP_NN_DW_TAP4(in + channels, filter + 16);
+                    ESP_NN_DW_TAP4(in + 2 * channels, filter + 20);
+                    in += row_size;
+                    ESP_NN_DW_TAP4(in, filter + 24);
+                    ESP_NN_DW_TAP4(in + channels, filter + 28);
+                    ESP_NN_DW_TAP4(in + 2 * channels, filter + 32);
+                } else {
+                    const int32_t filter_y_start = max(0, -base_y);
+                    const int32_t filter_x_start = max(0, -base_x);
+                    const int32_t filter_y_end = min(3, input_ht - base_y);
+                    const int32_t filter_x_end = min(3, input_wd - base_x);
+                    acc0 = bias0;
+                    acc1 = bias1;
+                    acc2 = bias2;
+                    acc3 = bias3;
+                    for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                        const int8_t *in = input_data + (base_y + filter_y_idx) * row_size +
+                                           (base_x + filter_x_start) * channels + ch_idx;
+                        const int32_t *tap = filter + (filter_y_idx * 3 + filter_x_start) * 4;
+                        for (int32_t filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                            acc0 += (in[0] + input_offset) * tap[0];
+                            acc1 += (in[1] + input_offset) * tap[1];
+                            acc2 += (in[2] + input_offset) * tap[2];
+                            acc3 += (in[3] + input_offset) * tap[3];
+                            in += channels;
+                            tap += 4;
+                        }
+                    }
+                }
+                out_ptr[0] = esp_nn_depthwise_requant(acc0, out_mult[0], out_shift[0], out_offset, activation_min, activation_max);
+                out_ptr[1] = esp_nn_depthwise_requant(acc1, out_mult[1], out_shift[1], out_offset, activation_min, activation_max);
+                out_ptr[2] = esp_nn_depthwise_requant(acc2, out_mult[2], out_shift[2], out_offset, activation_min, activation_max);
+                out_ptr[3] = esp_nn_depthwise_requant(acc3, out_mult[3], out_shift[3], out_offset, activation_min, activation_max);
+            }
+        }
+    }
+    for (; ch_idx < channels; ch_idx++) {
+        const int32_t bias_val = bias ? bias[ch_idx] : 0;
+        const int32_t out_mult = quant_data->mult[ch_idx];
+        const int32_t out_shift = quant_data->shift[ch_idx];
+
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            const int32_t base_y = out_y * stride_ht - pad_ht;
+            const int32_t filter_y_start = max(0, -base_y);
+            const int32_t filter_y_end = min(3, input_ht - base_y);
+            int8_t *out_ptr = out_data + out_y * out_wd * channels + ch_idx;
+            for (int32_t out_x = 0; out_x < out_wd; out_x++, out_ptr += channels) {
+                const int32_t base_x = out_x * stride_wd - pad_wd;
+                const int32_t filter_x_start = max(0, -base_x);
+                const int32_t filter_x_end = min(3, input_wd - base_x);
+                int32_t acc = bias_val;
+                for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                    for (int32_t filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                        const int32_t in_val = input_data[(base_y + filter_y_idx) * row_size +
+                                                          (base_x + filter_x_idx) * channels + ch_idx];
+                        acc += (in_val + input_offset) *
+                               filter_data[(filter_y_idx * 3 + filter_x_idx) * channels + ch_idx];
+                    }
+                }
+                *out_ptr = esp_nn_depthwise_requant(acc, out_mult, out_shift, out_offset, activation_min, activation_max);
+            }
+        }
+    }
+}
+
+__attribute__ ((noinline))
+static void esp_nn_depthwise_conv_s8_3x3_stride1(const data_dims_t *input_dims,
+                                                 const int8_t *input_data,
+                                                 const int8_t *filter_data,
+                                                 const int32_t *bias,
+                                                 const data_dims_t *output_dims,
+                                                 int8_t *out_data,
+                                                 const dw_conv_params_t *conv_params,
+                                                 const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_3x3_body(input_dims, input_data, filter_data, bias, output_dims,
+                                      out_data, conv_params, quant_data, 1, 1);
+}
+
+__attribute__ ((noinline))
+static void esp_nn_depthwise_conv_s8_3x3_stride2(const data_dims_t *input_dims,
+                                                 const int8_t *input_data,
+                                                 const int8_t *filter_data,
+                                                 const int32_t *bias,
+                                                 const data_dims_t *output_dims,
+                                                 int8_t *out_data,
+                                                 const dw_conv_params_t *conv_params,
+                                                 const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_3x3_body(input_dims, input_data, filter_data, bias, output_dims,
+                                      out_data, conv_params, quant_data, 2, 2);
+}
+
+__attribute__ ((noinline))
+static void esp_nn_depthwise_conv_s8_3x3(const data_dims_t *input_dims,
+                                         const int8_t *input_data,
+                                         const int8_t *filter_data,
+                                         const int32_t *bias,
+                                         const data_dims_t *output_dims,
+                                         int8_t *out_data,
+                                         const dw_conv_params_t *conv_params,
+                                         const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_3x3_body(input_dims, input_data, filter_data, bias, output_dims,
+                                      out_data, conv_params, quant_data,
+                                      conv_params->stride.width, conv_params->stride.height);
+}
+
 /* common channel multiplier == 1 case */
 __attribute__ ((noinline))
 static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
@@ -170,6 +372,21 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
                                   const quant_data_t *quant_data)
 {
     const uint16_t ch_mult = conv_params->ch_mult;
+    if (ch_mult == 1 && filter_dims->width == 3 && filter_dims->height == 3) {
+        const uint16_t stride_wd = conv_params->stride.width;
+        const uint16_t stride_ht = conv_params->stride.height;
+        if (stride_wd == 1 && stride_ht == 1) {
+            esp_nn_depthwise_conv_s8_3x3_stride1(input_dims, input_data, filter_data, bias,
+                                                 output_dims, out_data, conv_params, quant_data);
+        } else if (stride_wd == 2 && stride_ht == 2) {
+            esp_nn_depthwise_conv_s8_3x3_stride2(input_dims, input_data, filter_data, bias,
+                                                 output_dims, out_data, conv_params, quant_data);
+        } else {
+            esp_nn_depthwise_conv_s8_3x3(input_dims, input_data, filter_data, bias,
+                                         output_dims, out_data, conv_params, quant_data);
+        }
+        return;
+    }
     if (ch_mult == 1) {
         esp_nn_depthwise_conv_s8_ch_mult_1(input_dims, input_data, filter_dims, filter_data,
                                            bias, output_dims, out_data, conv_params, quant_data);
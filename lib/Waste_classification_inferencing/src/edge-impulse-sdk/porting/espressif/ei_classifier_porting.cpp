@@ -42,6 +42,7 @@
 // Include FreeRTOS for delay
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 
 // for millis and micros
 #include "esp_timer.h"
@@ -129,6 +130,186 @@ __attribute__((weak)) void ei_free(void *ptr) {
     free(ptr);
 }
 
+#ifndef EI_COPY_TASK_STACK_SIZE
+#define EI_COPY_TASK_STACK_SIZE 2048
+#endif
+
+// The copy task and the parallel workers' semaphores are created once, by the
+// first caller, which may be on either core: init states are 0 not created,
+// 1 being created, 2 ready. A caller that finds them being created goes on
+// without them, one that finds creation failed leaves it to the next caller.
+static portMUX_TYPE init_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Claims the creation of state, returns the state it was in
+static int init_claim(int *state) {
+    taskENTER_CRITICAL(&init_lock);
+    const int seen = *state;
+    if (seen == 0) {
+        *state = 1;
+    }
+    taskEXIT_CRITICAL(&init_lock);
+    return seen;
+}
+
+// Ends a creation claimed with init_claim(), ready or back to not created
+static void init_finish(int *state, bool ready) {
+    taskENTER_CRITICAL(&init_lock);
+    *state = ready ? 2 : 0;
+    taskEXIT_CRITICAL(&init_lock);
+}
+
+// Background copies run on a task pinned to the other core, created on first
+// use with the priority of the caller. Without a second core (or if the task
+// cannot be created) the copy is done right away.
+static int copy_state = 0;
+static TaskHandle_t copy_task = NULL;
+static SemaphoreHandle_t copy_done = NULL;
+static const ei_copy_block_t *copy_blocks = NULL;
+static size_t copy_count = 0;
+static bool copy_busy = false;
+
+static void copy_blocks_now(const ei_copy_block_t *blocks, size_t count) {
+    for (size_t ix = 0; ix < count; ix++) {
+        memcpy(blocks[ix].dst, blocks[ix].src, blocks[ix].size);
+    }
+}
+
+static void copy_task_fn(void *arg) {
+    (void)arg;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        copy_blocks_now(copy_blocks, copy_count);
+        xSemaphoreGive(copy_done);
+    }
+}
+
+__attribute__((weak)) EI_IMPULSE_ERROR ei_copy_async_start(const ei_copy_block_t *blocks, size_t count) {
+#if !CONFIG_FREERTOS_UNICORE
+    int state = init_claim(&copy_state);
+    if (state == 0) {
+        copy_done = xSemaphoreCreateBinary();
+        if (copy_done) {
+            xTaskCreatePinnedToCore(copy_task_fn, "ei_copy", EI_COPY_TASK_STACK_SIZE, NULL,
+                uxTaskPriorityGet(NULL), &copy_task, xPortGetCoreID() ? 0 : 1);
+            if (!copy_task) {
+                vSemaphoreDelete(copy_done);
+                copy_done = NULL;
+            }
+        }
+        state = copy_task ? 2 : 0;
+        init_finish(&copy_state, state == 2);
+    }
+    if (state == 2) {
+        copy_blocks = blocks;
+        copy_count = count;
+        copy_busy = true;
+        xTaskNotifyGive(copy_task);
+        return EI_IMPULSE_OK;
+    }
+#endif
+    copy_blocks_now(blocks, count);
+    return EI_IMPULSE_OK;
+}
+
+__attribute__((weak)) void ei_copy_async_wait(void) {
+    if (copy_busy) {
+        xSemaphoreTake(copy_done, portMAX_DELAY);
+        copy_busy = false;
+    }
+}
+
+#ifndef EI_PARALLEL_TASK_STACK_SIZE
+#define EI_PARALLEL_TASK_STACK_SIZE 4096
+#endif
+
+// Priority of the worker tasks, -1 for the priority of the first caller. The
+// caller waits for every worker at the end of each kernel, so a worker that
+// sits behind a busier task on its core holds up the whole inference; give
+// the workers a priority above the application's tasks on the other cores.
+#ifndef EI_PARALLEL_TASK_PRIORITY
+#define EI_PARALLEL_TASK_PRIORITY -1
+#endif
+
+// Workers 1 and up of ei_parallel_run run on tasks pinned to the other cores,
+// created on first use with EI_PARALLEL_TASK_PRIORITY. Workers that have no
+// core (or no task) of their own run on the caller, after worker 0, and so do
+// all workers of a caller that finds the tasks busy with another caller (the
+// mutex is not recursive, so this covers calls from inside a worker too).
+static TaskHandle_t parallel_tasks[portNUM_PROCESSORS];
+static int parallel_state = 0;
+static SemaphoreHandle_t parallel_done = NULL;
+static SemaphoreHandle_t parallel_busy = NULL;
+static ei_parallel_fn_t parallel_fn = NULL;
+static void *parallel_arg = NULL;
+static int parallel_workers = 0;
+
+static void parallel_task_fn(void *arg) {
+    const int worker = (int)(intptr_t)arg;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        parallel_fn(parallel_arg, worker, parallel_workers);
+        xSemaphoreGive(parallel_done);
+    }
+}
+
+__attribute__((weak)) EI_IMPULSE_ERROR ei_parallel_run(ei_parallel_fn_t fn, void *arg, int workers) {
+    int state = init_claim(&parallel_state);
+    if (state == 0) {
+        parallel_done = xSemaphoreCreateCounting(portNUM_PROCESSORS, 0);
+        parallel_busy = xSemaphoreCreateMutex();
+        if (!parallel_done || !parallel_busy) {
+            if (parallel_done) {
+                vSemaphoreDelete(parallel_done);
+                parallel_done = NULL;
+            }
+            if (parallel_busy) {
+                vSemaphoreDelete(parallel_busy);
+                parallel_busy = NULL;
+            }
+        }
+        state = parallel_busy ? 2 : 0;
+        init_finish(&parallel_state, state == 2);
+    }
+    int helpers = 0;
+    const bool owner = state == 2 && xSemaphoreTake(parallel_busy, 0) == pdTRUE;
+    if (owner) {
+        const BaseType_t core = xPortGetCoreID();
+        while (helpers < workers - 1 && helpers < portNUM_PROCESSORS - 1) {
+            if (!parallel_tasks[helpers]) {
+                xTaskCreatePinnedToCore(parallel_task_fn, "ei_parallel", EI_PARALLEL_TASK_STACK_SIZE,
+                    (void *)(intptr_t)(helpers + 1),
+                    EI_PARALLEL_TASK_PRIORITY < 0 ? uxTaskPriorityGet(NULL) : EI_PARALLEL_TASK_PRIORITY,
+                    &parallel_tasks[helpers],
+                    (core + helpers + 1) % portNUM_PROCESSORS);
+                if (!parallel_tasks[helpers]) {
+                    break;
+                }
+            }
+            helpers++;
+        }
+    }
+
+    if (helpers > 0) {
+        parallel_fn = fn;
+        parallel_arg = arg;
+        parallel_workers = workers;
+    }
+    for (int ix = 0; ix < helpers; ix++) {
+        xTaskNotifyGive(parallel_tasks[ix]);
+    }
+    fn(arg, 0, workers);
+    for (int ix = helpers + 1; ix < workers; ix++) {
+        fn(arg, ix, workers);
+    }
+    for (int ix = 0; ix < helpers; ix++) {
+        xSemaphoreTake(parallel_done, portMAX_DELAY);
+    }
+    if (owner) {
+        xSemaphoreGive(parallel_busy);
+    }
+    return EI_IMPULSE_OK;
+}
+
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
 extern "C"
 #endif
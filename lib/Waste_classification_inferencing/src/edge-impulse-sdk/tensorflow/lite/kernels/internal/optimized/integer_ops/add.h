@@ -0,0 +1,145 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_ADD_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_ADD_H_
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// reference_integer_ops::AddElementwise() for int8, 8 elements at a time
+// (input1_data or input2_data may be output_data)
+inline void AddElementwise(int size, const ArithmeticParams& params,
+                           const int8_t* input1_data, const int8_t* input2_data,
+                           int8_t* output_data) {
+#if EI_TFLITE_SIMD
+  reference_integer_ops::CheckArithmeticParams(params);
+  int i = 0;
+#if defined(EI_TFLITE_SIMD_AVX2)
+  const __m256i input1_offset = _mm256_set1_epi32(params.input1_offset);
+  const __m256i input2_offset = _mm256_set1_epi32(params.input2_offset);
+  const __m256i left_shift = _mm256_set1_epi32(params.left_shift);
+  const __m256i input1_multiplier = _mm256_set1_epi32(params.input1_multiplier);
+  const __m256i input1_shift = _mm256_set1_epi32(params.input1_shift);
+  const __m256i input2_multiplier = _mm256_set1_epi32(params.input2_multiplier);
+  const __m256i input2_shift = _mm256_set1_epi32(params.input2_shift);
+  const __m256i output_multiplier = _mm256_set1_epi32(params.output_multiplier);
+  const __m256i output_shift = _mm256_set1_epi32(params.output_shift);
+  for (; i + 8 <= size; i += 8) {
+    const __m256i input1 = _mm256_sllv_epi32(
+        _mm256_add_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64(
+                             reinterpret_cast<const __m128i*>(input1_data + i))),
+                         input1_offset),
+        left_shift);
+    const __m256i input2 = _mm256_sllv_epi32(
+        _mm256_add_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64(
+                             reinterpret_cast<const __m128i*>(input2_data + i))),
+                         input2_offset),
+        left_shift);
+    const __m256i raw_sum = _mm256_add_epi32(
+        MultiplyByQuantizedMultiplier(input1, input1_multiplier, input1_shift),
+        MultiplyByQuantizedMultiplier(input2, input2_multiplier, input2_shift));
+    StoreInt8(MultiplyByQuantizedMultiplier(raw_sum, output_multiplier,
+                                            output_shift),
+              params.output_offset, params.quantized_activation_min,
+              params.quantized_activation_max, output_data + i);
+  }
+#else
+  const int16x8_t input1_offset =
+      vdupq_n_s16(static_cast<int16_t>(params.input1_offset));
+  const int16x8_t input2_offset =
+      vdupq_n_s16(static_cast<int16_t>(params.input2_offset));
+  const int32x4_t left_shift = vdupq_n_s32(params.left_shift);
+  const int32x4_t input1_multiplier = vdupq_n_s32(params.input1_multiplier);
+  const int32x4_t input1_shift = vdupq_n_s32(params.input1_shift);
+  const int32x4_t input2_multiplier = vdupq_n_s32(params.input2_multiplier);
+  const int32x4_t input2_shift = vdupq_n_s32(params.input2_shift);
+  const int32x4_t output_multiplier = vdupq_n_s32(params.output_multiplier);
+  const int32x4_t output_shift = vdupq_n_s32(params.output_shift);
+  for (; i + 8 <= size; i += 8) {
+    // the offset inputs, at most 255 in magnitude, fit in int16
+    const int16x8_t input1 =
+        vaddq_s16(vmovl_s8(vld1_s8(input1_data + i)), input1_offset);
+    const int16x8_t input2 =
+        vaddq_s16(vmovl_s8(vld1_s8(input2_data + i)), input2_offset);
+    int32x4_t sum[2];
+    for (int half = 0; half < 2; half++) {
+      const int32x4_t a = vshlq_s32(
+          vmovl_s16(half ? vget_high_s16(input1) : vget_low_s16(input1)),
+          left_shift);
+      const int32x4_t b = vshlq_s32(
+          vmovl_s16(half ? vget_high_s16(input2) : vget_low_s16(input2)),
+          left_shift);
+      sum[half] = MultiplyByQuantizedMultiplier(
+          vaddq_s32(
+              MultiplyByQuantizedMultiplier(a, input1_multiplier, input1_shift),
+              MultiplyByQuantizedMultiplier(b, input2_multiplier,
+                                            input2_shift)),
+          output_multiplier, output_shift);
+    }
+    StoreInt8(sum[0], sum[1], params.output_offset,
+              params.quantized_activation_min, params.quantized_activation_max,
+              output_data + i);
+  }
+#endif
+  for (; i < size; ++i) {
+    output_data[i] =
+        reference_integer_ops::AddFunc(input1_data[i], input2_data[i], params);
+  }
+#else
+  reference_integer_ops::AddElementwise(size, params, input1_data, input2_data,
+                                        output_data);
+#endif  // EI_TFLITE_SIMD
+}
+
+// reference_integer_ops::Add() for int8, inputs of the same shape
+inline void Add(const ArithmeticParams& params,
+                const RuntimeShape& input1_shape, const int8_t* input1_data,
+                const RuntimeShape& input2_shape, const int8_t* input2_data,
+                const RuntimeShape& output_shape, int8_t* output_data) {
+  reference_integer_ops::CheckArithmeticParams(params);
+
+  const int flat_size =
+      MatchingElementsSize(input1_shape, input2_shape, output_shape);
+
+  AddElementwise(flat_size, params, input1_data, input2_data, output_data);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_ADD_H_
@@ -0,0 +1,130 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// reference_integer_ops::ConvPerChannel() for int8. Every output pixel
+// gathers its window once, widened to int16 with the input offset added
+// (zero outside the image, which the reference skips), and takes the dot
+// product of it with every filter.
+inline void ConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+#if EI_TFLITE_SIMD
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int window_depth = filter_height * filter_width * input_depth;
+
+  // grouped convolutions and layers too large for the stack buffers
+  if (filter_shape.Dims(3) == input_depth && window_depth <= kSimdMaxDepth &&
+      output_depth <= kSimdMaxChannels) {
+    int16_t window[kSimdMaxDepth];
+    int32_t acc[kSimdMaxChannels];
+    const bool pointwise = filter_height == 1 && filter_width == 1 &&
+                           params.stride_width == 1 &&
+                           params.stride_height == 1 &&
+                           params.padding_values.width == 0 &&
+                           params.padding_values.height == 0;
+
+    for (int batch = 0; batch < batches; ++batch) {
+      for (int out_y = 0; out_y < output_height; ++out_y) {
+        const int in_y_origin =
+            (out_y * params.stride_height) - params.padding_values.height;
+        for (int out_x = 0; out_x < output_width; ++out_x) {
+          const int in_x_origin =
+              (out_x * params.stride_width) - params.padding_values.width;
+          if (pointwise) {
+            WidenWithOffset(
+                input_data + Offset(input_shape, batch, out_y, out_x, 0),
+                input_depth, params.input_offset, window);
+          } else {
+            int16_t* dst = window;
+            for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+              const int in_y =
+                  in_y_origin + params.dilation_height_factor * filter_y;
+              for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+                const int in_x =
+                    in_x_origin + params.dilation_width_factor * filter_x;
+                if ((in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
+                    (in_y < input_height)) {
+                  WidenWithOffset(
+                      input_data + Offset(input_shape, batch, in_y, in_x, 0),
+                      input_depth, params.input_offset, dst);
+                } else {
+                  std::fill(dst, dst + input_depth, 0);
+                }
+                dst += input_depth;
+              }
+            }
+          }
+          DotProducts(window, window_depth, filter_data, output_depth, acc);
+          RequantizeChannels(
+              acc, bias_data, output_depth, output_multiplier, output_shift,
+              true, params.output_offset, params.quantized_activation_min,
+              params.quantized_activation_max,
+              output_data + Offset(output_shape, batch, out_y, out_x, 0));
+        }
+      }
+    }
+    return;
+  }
+#endif  // EI_TFLITE_SIMD
+  reference_integer_ops::ConvPerChannel(
+      params, output_multiplier, output_shift, input_shape, input_data,
+      filter_shape, filter_data, bias_shape, bias_data, output_shape,
+      output_data);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
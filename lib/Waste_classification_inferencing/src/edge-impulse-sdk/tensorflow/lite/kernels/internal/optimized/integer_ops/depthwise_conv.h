@@ -0,0 +1,213 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// reference_integer_ops::DepthwiseConvPerChannel() for int8 with a depth
+// multiplier of 1: 8 channels of an output pixel at a time, over the taps
+// of the window inside the image. The products (input + offset) * filter
+// fit in int16, the sums are taken in int32.
+inline void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+#if EI_TFLITE_SIMD
+  if (params.depth_multiplier == 1) {
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+    const int depth = MatchingDim(filter_shape, 3, output_shape, 3);
+    const int input_height = input_shape.Dims(1);
+    const int input_width = input_shape.Dims(2);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int output_height = output_shape.Dims(1);
+    const int output_width = output_shape.Dims(2);
+    const int32_t input_offset = params.input_offset;
+    const int32_t output_offset = params.output_offset;
+    const int32_t output_activation_min = params.quantized_activation_min;
+    const int32_t output_activation_max = params.quantized_activation_max;
+
+    for (int batch = 0; batch < batches; ++batch) {
+      for (int out_y = 0; out_y < output_height; ++out_y) {
+        const int in_y_origin =
+            (out_y * params.stride_height) - params.padding_values.height;
+        for (int out_x = 0; out_x < output_width; ++out_x) {
+          const int in_x_origin =
+              (out_x * params.stride_width) - params.padding_values.width;
+          int8_t* output =
+              output_data + Offset(output_shape, batch, out_y, out_x, 0);
+          int c = 0;
+#if defined(EI_TFLITE_SIMD_AVX2)
+          const __m128i offset_vec =
+              _mm_set1_epi16(static_cast<int16_t>(input_offset));
+          for (; c + 8 <= depth; c += 8) {
+            __m256i acc = _mm256_setzero_si256();
+            for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+              const int in_y =
+                  in_y_origin + params.dilation_height_factor * filter_y;
+              if (in_y < 0 || in_y >= input_height) {
+                continue;
+              }
+              for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+                const int in_x =
+                    in_x_origin + params.dilation_width_factor * filter_x;
+                if (in_x < 0 || in_x >= input_width) {
+                  continue;
+                }
+                const __m128i in = _mm_add_epi16(
+                    _mm_cvtepi8_epi16(_mm_loadl_epi64(
+                        reinterpret_cast<const __m128i*>(
+                            input_data +
+                            Offset(input_shape, batch, in_y, in_x, c)))),
+                    offset_vec);
+                const __m128i filter = _mm_cvtepi8_epi16(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(
+                        filter_data +
+                        Offset(filter_shape, 0, filter_y, filter_x, c))));
+                acc = _mm256_add_epi32(
+                    acc, _mm256_cvtepi16_epi32(_mm_mullo_epi16(in, filter)));
+              }
+            }
+            if (bias_data) {
+              acc = _mm256_add_epi32(
+                  acc, _mm256_loadu_si256(
+                           reinterpret_cast<const __m256i*>(bias_data + c)));
+            }
+            StoreInt8(MultiplyByQuantizedMultiplier(
+                          acc,
+                          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                              output_multiplier + c)),
+                          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                              output_shift + c))),
+                      output_offset, output_activation_min,
+                      output_activation_max, output + c);
+          }
+#else
+          const int16x8_t offset_vec =
+              vdupq_n_s16(static_cast<int16_t>(input_offset));
+          for (; c + 8 <= depth; c += 8) {
+            int32x4_t acc_lo = vdupq_n_s32(0);
+            int32x4_t acc_hi = vdupq_n_s32(0);
+            for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+              const int in_y =
+                  in_y_origin + params.dilation_height_factor * filter_y;
+              if (in_y < 0 || in_y >= input_height) {
+                continue;
+              }
+              for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+                const int in_x =
+                    in_x_origin + params.dilation_width_factor * filter_x;
+                if (in_x < 0 || in_x >= input_width) {
+                  continue;
+                }
+                const int16x8_t in = vaddq_s16(
+                    vmovl_s8(vld1_s8(input_data + Offset(input_shape, batch,
+                                                         in_y, in_x, c))),
+                    offset_vec);
+                const int16x8_t filter = vmovl_s8(vld1_s8(
+                    filter_data +
+                    Offset(filter_shape, 0, filter_y, filter_x, c)));
+                acc_lo = vmlal_s16(acc_lo, vget_low_s16(in),
+                                   vget_low_s16(filter));
+                acc_hi = vmlal_s16(acc_hi, vget_high_s16(in),
+                                   vget_high_s16(filter));
+              }
+            }
+            if (bias_data) {
+              acc_lo = vaddq_s32(acc_lo, vld1q_s32(bias_data + c));
+              acc_hi = vaddq_s32(acc_hi, vld1q_s32(bias_data + c + 4));
+            }
+            acc_lo = MultiplyByQuantizedMultiplier(
+                acc_lo, vld1q_s32(output_multiplier + c),
+                vld1q_s32(output_shift + c));
+            acc_hi = MultiplyByQuantizedMultiplier(
+                acc_hi, vld1q_s32(output_multiplier + c + 4),
+                vld1q_s32(output_shift + c + 4));
+            StoreInt8(acc_lo, acc_hi, output_offset, output_activation_min,
+                      output_activation_max, output + c);
+          }
+#endif
+          for (; c < depth; ++c) {
+            int32_t acc = 0;
+            for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+              const int in_y =
+                  in_y_origin + params.dilation_height_factor * filter_y;
+              for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+                const int in_x =
+                    in_x_origin + params.dilation_width_factor * filter_x;
+                if ((in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
+                    (in_y < input_height)) {
+                  acc += filter_data[Offset(filter_shape, 0, filter_y,
+                                            filter_x, c)] *
+                         (input_data[Offset(input_shape, batch, in_y, in_x,
+                                            c)] +
+                          input_offset);
+                }
+              }
+            }
+            if (bias_data) {
+              acc += bias_data[c];
+            }
+            acc = tflite::MultiplyByQuantizedMultiplier(
+                acc, output_multiplier[c], output_shift[c]);
+            acc += output_offset;
+            acc = std::max(acc, output_activation_min);
+            acc = std::min(acc, output_activation_max);
+            output[c] = static_cast<int8_t>(acc);
+          }
+        }
+      }
+    }
+    return;
+  }
+#endif  // EI_TFLITE_SIMD
+  reference_integer_ops::DepthwiseConvPerChannel(
+      params, output_multiplier, output_shift, input_shape, input_data,
+      filter_shape, filter_data, bias_shape, bias_data, output_shape,
+      output_data);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
@@ -0,0 +1,338 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+
+// The int8 kernels in this directory take the reference kernel's arguments
+// and compute the same outputs, bit for bit: the accumulators are exact
+// integer sums in any order, and the requantization below is the reference
+// MultiplyByQuantizedMultiplier (double rounding) on whole vectors. Without
+// EI_CLASSIFIER_TFLITE_ENABLE_SIMD, or for a shape they do not cover, they
+// call the reference kernel.
+#if EI_CLASSIFIER_TFLITE_ENABLE_SIMD == 1 && defined(__AVX2__)
+#define EI_TFLITE_SIMD_AVX2 1
+#include <immintrin.h>
+#elif EI_CLASSIFIER_TFLITE_ENABLE_SIMD == 1 && defined(__aarch64__) && \
+    defined(__ARM_NEON)
+#define EI_TFLITE_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(EI_TFLITE_SIMD_AVX2) || defined(EI_TFLITE_SIMD_NEON)
+#define EI_TFLITE_SIMD 1
+#else
+#define EI_TFLITE_SIMD 0
+#endif
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Longest window (filter height x width x input depth, or the depth of a fully
+// connected layer) and most output channels the kernels keep on the stack;
+// larger layers run on the reference kernels
+constexpr int kSimdMaxDepth = 4096;
+constexpr int kSimdMaxChannels = 2048;
+
+#if EI_TFLITE_SIMD
+
+// Widens count int8 values to int16 with offset added
+inline void WidenWithOffset(const int8_t* input, int count, int32_t offset,
+                            int16_t* output) {
+  int i = 0;
+#if defined(EI_TFLITE_SIMD_AVX2)
+  const __m256i offset_vec = _mm256_set1_epi16(static_cast<int16_t>(offset));
+  for (; i + 16 <= count; i += 16) {
+    const __m256i v = _mm256_cvtepi8_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                        _mm256_add_epi16(v, offset_vec));
+  }
+#else
+  const int16x8_t offset_vec = vdupq_n_s16(static_cast<int16_t>(offset));
+  for (; i + 8 <= count; i += 8) {
+    vst1q_s16(output + i, vaddq_s16(vmovl_s8(vld1_s8(input + i)), offset_vec));
+  }
+#endif
+  for (; i < count; i++) {
+    output[i] = static_cast<int16_t>(input[i] + offset);
+  }
+}
+
+// acc[o] = sum over k < depth of input[k] * filter[o * depth + k], for count
+// rows of filter
+inline void DotProducts(const int16_t* input, int depth, const int8_t* filter,
+                        int count, int32_t* acc) {
+  int o = 0;
+#if defined(EI_TFLITE_SIMD_AVX2)
+  for (; o + 4 <= count; o += 4) {
+    const int8_t* f0 = filter + o * depth;
+    const int8_t* f1 = f0 + depth;
+    const int8_t* f2 = f1 + depth;
+    const int8_t* f3 = f2 + depth;
+    __m256i a0 = _mm256_setzero_si256();
+    __m256i a1 = _mm256_setzero_si256();
+    __m256i a2 = _mm256_setzero_si256();
+    __m256i a3 = _mm256_setzero_si256();
+    int k = 0;
+    for (; k + 16 <= depth; k += 16) {
+      const __m256i in = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(input + k));
+      a0 = _mm256_add_epi32(
+          a0, _mm256_madd_epi16(in, _mm256_cvtepi8_epi16(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i*>(f0 + k)))));
+      a1 = _mm256_add_epi32(
+          a1, _mm256_madd_epi16(in, _mm256_cvtepi8_epi16(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i*>(f1 + k)))));
+      a2 = _mm256_add_epi32(
+          a2, _mm256_madd_epi16(in, _mm256_cvtepi8_epi16(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i*>(f2 + k)))));
+      a3 = _mm256_add_epi32(
+          a3, _mm256_madd_epi16(in, _mm256_cvtepi8_epi16(_mm_loadu_si128(
+                                        reinterpret_cast<const __m128i*>(f3 + k)))));
+    }
+    // four horizontal sums at once
+    const __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(a0, a1),
+                                        _mm256_hadd_epi32(a2, a3));
+    int32_t sums[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sums),
+                     _mm_add_epi32(_mm256_castsi256_si128(s),
+                                   _mm256_extracti128_si256(s, 1)));
+    for (; k < depth; k++) {
+      sums[0] += input[k] * f0[k];
+      sums[1] += input[k] * f1[k];
+      sums[2] += input[k] * f2[k];
+      sums[3] += input[k] * f3[k];
+    }
+    acc[o] = sums[0];
+    acc[o + 1] = sums[1];
+    acc[o + 2] = sums[2];
+    acc[o + 3] = sums[3];
+  }
+#else
+  for (; o + 4 <= count; o += 4) {
+    const int8_t* f0 = filter + o * depth;
+    const int8_t* f1 = f0 + depth;
+    const int8_t* f2 = f1 + depth;
+    const int8_t* f3 = f2 + depth;
+    int32x4_t a0 = vdupq_n_s32(0);
+    int32x4_t a1 = vdupq_n_s32(0);
+    int32x4_t a2 = vdupq_n_s32(0);
+    int32x4_t a3 = vdupq_n_s32(0);
+    int k = 0;
+    for (; k + 8 <= depth; k += 8) {
+      const int16x8_t in = vld1q_s16(input + k);
+      const int16x4_t in_lo = vget_low_s16(in);
+      const int16x4_t in_hi = vget_high_s16(in);
+      int16x8_t f = vmovl_s8(vld1_s8(f0 + k));
+      a0 = vmlal_s16(vmlal_s16(a0, in_lo, vget_low_s16(f)), in_hi,
+                     vget_high_s16(f));
+      f = vmovl_s8(vld1_s8(f1 + k));
+      a1 = vmlal_s16(vmlal_s16(a1, in_lo, vget_low_s16(f)), in_hi,
+                     vget_high_s16(f));
+      f = vmovl_s8(vld1_s8(f2 + k));
+      a2 = vmlal_s16(vmlal_s16(a2, in_lo, vget_low_s16(f)), in_hi,
+                     vget_high_s16(f));
+      f = vmovl_s8(vld1_s8(f3 + k));
+      a3 = vmlal_s16(vmlal_s16(a3, in_lo, vget_low_s16(f)), in_hi,
+                     vget_high_s16(f));
+    }
+    int32_t sums[4] = {vaddvq_s32(a0), vaddvq_s32(a1), vaddvq_s32(a2),
+                       vaddvq_s32(a3)};
+    for (; k < depth; k++) {
+      sums[0] += input[k] * f0[k];
+      sums[1] += input[k] * f1[k];
+      sums[2] += input[k] * f2[k];
+      sums[3] += input[k] * f3[k];
+    }
+    acc[o] = sums[0];
+    acc[o + 1] = sums[1];
+    acc[o + 2] = sums[2];
+    acc[o + 3] = sums[3];
+  }
+#endif
+  for (; o < count; o++) {
+    const int8_t* f = filter + o * depth;
+    int32_t sum = 0;
+    for (int k = 0; k < depth; k++) {
+      sum += input[k] * f[k];
+    }
+    acc[o] = sum;
+  }
+}
+
+#if defined(EI_TFLITE_SIMD_AVX2)
+// MultiplyByQuantizedMultiplier() on 8 lanes, shift > 0 shifting left
+inline __m256i MultiplyByQuantizedMultiplier(__m256i x, __m256i multiplier,
+                                             __m256i shift) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i left_shift = _mm256_max_epi32(shift, zero);
+  const __m256i right_shift = _mm256_max_epi32(_mm256_sub_epi32(zero, shift),
+                                               zero);
+  x = _mm256_sllv_epi32(x, left_shift);
+
+  // SaturatingRoundingDoublingHighMul: with multiplier >= 0 it never
+  // saturates, and rounding half away from zero over 2^31 is
+  // floor((x * multiplier + 2^30) / 2^31), the low 32 bits of which a logical
+  // shift gives
+  const __m256i nudge = _mm256_set1_epi64x(static_cast<int64_t>(1) << 30);
+  const __m256i even = _mm256_srli_epi64(
+      _mm256_add_epi64(_mm256_mul_epi32(x, multiplier), nudge), 31);
+  const __m256i odd = _mm256_srli_epi64(
+      _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(x, 32),
+                                        _mm256_srli_epi64(multiplier, 32)),
+                       nudge),
+      31);
+  x = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+
+  // RoundingDivideByPOT
+  const __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, right_shift),
+                                        one);
+  const __m256i remainder = _mm256_and_si256(x, mask);
+  const __m256i threshold =
+      _mm256_sub_epi32(_mm256_srli_epi32(mask, 1), _mm256_cmpgt_epi32(zero, x));
+  return _mm256_sub_epi32(_mm256_srav_epi32(x, right_shift),
+                          _mm256_cmpgt_epi32(remainder, threshold));
+}
+
+// Offset and clamp 8 requantized lanes and store them as int8
+inline void StoreInt8(__m256i x, int32_t output_offset, int32_t min,
+                      int32_t max, int8_t* output) {
+  x = _mm256_add_epi32(x, _mm256_set1_epi32(output_offset));
+  x = _mm256_max_epi32(x, _mm256_set1_epi32(min));
+  x = _mm256_min_epi32(x, _mm256_set1_epi32(max));
+  const __m128i x16 = _mm_packs_epi32(_mm256_castsi256_si128(x),
+                                      _mm256_extracti128_si256(x, 1));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(output),
+                   _mm_packs_epi16(x16, x16));
+}
+#else
+// MultiplyByQuantizedMultiplier() on 4 lanes, shift > 0 shifting left
+inline int32x4_t MultiplyByQuantizedMultiplier(int32x4_t x,
+                                               int32x4_t multiplier,
+                                               int32x4_t shift) {
+  const int32x4_t zero = vdupq_n_s32(0);
+  x = vshlq_s32(x, vmaxq_s32(shift, zero));
+  x = vqrdmulhq_s32(x, multiplier);
+  // RoundingDivideByPOT, as in gemmlowp
+  const int32x4_t right_shift = vminq_s32(shift, zero);
+  const int32x4_t fixup = vshrq_n_s32(vandq_s32(x, right_shift), 31);
+  return vrshlq_s32(vqaddq_s32(x, fixup), right_shift);
+}
+
+// Offset and clamp 8 requantized lanes and store them as int8
+inline void StoreInt8(int32x4_t lo, int32x4_t hi, int32_t output_offset,
+                      int32_t min, int32_t max, int8_t* output) {
+  const int32x4_t offset = vdupq_n_s32(output_offset);
+  const int32x4_t min_vec = vdupq_n_s32(min);
+  const int32x4_t max_vec = vdupq_n_s32(max);
+  lo = vminq_s32(vmaxq_s32(vaddq_s32(lo, offset), min_vec), max_vec);
+  hi = vminq_s32(vmaxq_s32(vaddq_s32(hi, offset), min_vec), max_vec);
+  vst1_s8(output, vqmovn_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+}
+#endif
+
+// output[o] = requantized acc[o] + bias[o], for count channels. With
+// per_channel false, multiplier[0] and shift[0] apply to every channel.
+inline void RequantizeChannels(const int32_t* acc, const int32_t* bias,
+                               int count, const int32_t* multiplier,
+                               const int32_t* shift, bool per_channel,
+                               int32_t output_offset, int32_t min, int32_t max,
+                               int8_t* output) {
+  int o = 0;
+#if defined(EI_TFLITE_SIMD_AVX2)
+  for (; o + 8 <= count; o += 8) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + o));
+    if (bias) {
+      x = _mm256_add_epi32(
+          x, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bias + o)));
+    }
+    const __m256i m =
+        per_channel ? _mm256_loadu_si256(
+                          reinterpret_cast<const __m256i*>(multiplier + o))
+                    : _mm256_set1_epi32(multiplier[0]);
+    const __m256i s =
+        per_channel
+            ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shift + o))
+            : _mm256_set1_epi32(shift[0]);
+    StoreInt8(MultiplyByQuantizedMultiplier(x, m, s), output_offset, min, max,
+              output + o);
+  }
+#else
+  for (; o + 8 <= count; o += 8) {
+    int32x4_t lo = vld1q_s32(acc + o);
+    int32x4_t hi = vld1q_s32(acc + o + 4);
+    if (bias) {
+      lo = vaddq_s32(lo, vld1q_s32(bias + o));
+      hi = vaddq_s32(hi, vld1q_s32(bias + o + 4));
+    }
+    if (per_channel) {
+      lo = MultiplyByQuantizedMultiplier(lo, vld1q_s32(multiplier + o),
+                                         vld1q_s32(shift + o));
+      hi = MultiplyByQuantizedMultiplier(hi, vld1q_s32(multiplier + o + 4),
+                                         vld1q_s32(shift + o + 4));
+    } else {
+      lo = MultiplyByQuantizedMultiplier(lo, vdupq_n_s32(multiplier[0]),
+                                         vdupq_n_s32(shift[0]));
+      hi = MultiplyByQuantizedMultiplier(hi, vdupq_n_s32(multiplier[0]),
+                                         vdupq_n_s32(shift[0]));
+    }
+    StoreInt8(lo, hi, output_offset, min, max, output + o);
+  }
+#endif
+  for (; o < count; o++) {
+    int32_t x = acc[o] + (bias ? bias[o] : 0);
+    x = tflite::MultiplyByQuantizedMultiplier(
+        x, multiplier[per_channel ? o : 0], shift[per_channel ? o : 0]);
+    x += output_offset;
+    x = std::max(x, min);
+    x = std::min(x, max);
+    output[o] = static_cast<int8_t>(x);
+  }
+}
+
+#endif  // EI_TFLITE_SIMD
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
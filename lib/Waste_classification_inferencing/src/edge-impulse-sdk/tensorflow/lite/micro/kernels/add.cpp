@@ -1248,6 +1248,22 @@ TfLiteRegistration Register_ADD() {
   return tflite::micro::RegisterOp(AddInit, AddPrepare, AddEval);
 }
 
+TfLiteStatus AddWritePrepared(TfLiteContext*, TfLiteNode* node,
+                              PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  writer->BeginOpData("tflite::OpDataAdd");
+  WriteOpDataAdd(writer, *(static_cast<const OpDataAdd*>(node->user_data)));
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
+TfLiteStatus AddInitPrepared(TfLiteContext*, TfLiteNode* node,
+                             const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #else
@@ -1271,6 +1287,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/add.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -1340,7 +1357,7 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
             tflite::micro::GetTensorShape(output),
             tflite::micro::GetTensorData<int8_t>(output));
       } else {
-        reference_integer_ops::Add(
+        optimized_integer_ops::Add(
             op_params, tflite::micro::GetTensorShape(input1),
             tflite::micro::GetTensorData<int8_t>(input1),
             tflite::micro::GetTensorShape(input2),
@@ -1435,6 +1452,22 @@ TfLiteRegistration Register_ADD() {
   return tflite::micro::RegisterOp(AddInit, AddPrepare, AddEval);
 }
 
+TfLiteStatus AddWritePrepared(TfLiteContext*, TfLiteNode* node,
+                              PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  writer->BeginOpData("tflite::OpDataAdd");
+  WriteOpDataAdd(writer, *(static_cast<const OpDataAdd*>(node->user_data)));
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
+TfLiteStatus AddInitPrepared(TfLiteContext*, TfLiteNode* node,
+                             const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #endif
@@ -20,6 +20,7 @@ limitations under the License.
 
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
 
 namespace tflite {
 
@@ -59,6 +60,19 @@ TfLiteStatus CalculateOpDataAdd(TfLiteContext* context, TfLiteAddParams* params,
 
 TfLiteStatus AddPrepare(TfLiteContext* context, TfLiteNode* node);
 
+// Writes data as a constant
+void WriteOpDataAdd(PreparedOpDataWriter* writer, const OpDataAdd& data);
+
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h). The generic and ESP-NN kernels only.
+TfLiteStatus AddWritePrepared(TfLiteContext* context, TfLiteNode* node,
+                              PreparedOpDataWriter* writer);
+
+// Sets node up from op data that AddWritePrepared wrote, in place of init and
+// prepare.
+TfLiteStatus AddInitPrepared(TfLiteContext* context, TfLiteNode* node,
+                             const void* op_data);
+
 // Generic must define registration function.
 TfLiteRegistration Register_ADD();
 
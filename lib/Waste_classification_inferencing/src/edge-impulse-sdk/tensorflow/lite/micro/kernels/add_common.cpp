@@ -103,4 +103,22 @@ TfLiteStatus AddPrepare(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
+void WriteOpDataAdd(PreparedOpDataWriter* writer, const OpDataAdd& data) {
+  writer->Bool("requires_broadcast", data.requires_broadcast);
+  writer->Int("input1_shift", data.input1_shift);
+  writer->Int("input2_shift", data.input2_shift);
+  writer->Int("output_activation_min", data.output_activation_min);
+  writer->Int("output_activation_max", data.output_activation_max);
+  writer->Int("input1_multiplier", data.input1_multiplier);
+  writer->Int("input2_multiplier", data.input2_multiplier);
+  writer->Int("output_multiplier", data.output_multiplier);
+  writer->Int("output_shift", data.output_shift);
+  writer->Int("left_shift", data.left_shift);
+  writer->Int("input1_offset", data.input1_offset);
+  writer->Int("input2_offset", data.input2_offset);
+  writer->Int("output_offset", data.output_offset);
+  writer->Float("output_activation_min_f32", data.output_activation_min_f32);
+  writer->Float("output_activation_max_f32", data.output_activation_max_f32);
+}
+
 }  // namespace tflite
@@ -1697,6 +1697,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/parallel.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
 
 #include <esp_timer.h>
@@ -1723,6 +1724,48 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   return context->AllocatePersistentBuffer(context, sizeof(NodeData));
 }
 
+#if ESP_NN
+// The scratch buffer of the ESP-NN int8 kernel, -1 for none
+TfLiteStatus RequestScratchBuffer(TfLiteContext* context,
+                                  const TfLiteConvParams& params,
+                                  const TfLiteTensor* input,
+                                  const TfLiteTensor* filter,
+                                  const TfLiteTensor* output,
+                                  NodeData* data) {
+  data->buffer_idx = -1;
+  if (input->type != kTfLiteInt8) {
+    return kTfLiteOk;
+  }
+
+  data_dims_t input_dims =  {
+                              .width = input->dims->data[2], .height = input->dims->data[1],
+                              .channels = input->dims->data[3], .extra = 1
+                            };
+  data_dims_t output_dims = {
+                              .width = output->dims->data[2], .height = output->dims->data[1],
+                              .channels = output->dims->data[3], .extra = 1
+                            };
+  data_dims_t filter_dims = {
+                              .width = filter->dims->data[2], .height = filter->dims->data[1],
+                              .channels = 0, .extra = 0
+                            };
+  conv_params_t conv_params = {
+                                .in_offset = 0, .out_offset = 0,
+                                .stride = {params.stride_width, params.stride_height},
+                                .padding = {data->op_data.padding.width, data->op_data.padding.height},
+                                .dilation = {0, 0}, .activation = {-128, 127}
+                              };
+
+  int scratch_buf_size = esp_nn_get_conv_scratch_size(
+      &input_dims, &filter_dims, &output_dims, &conv_params);
+  if (scratch_buf_size > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, scratch_buf_size, &data->buffer_idx));
+  }
+  return kTfLiteOk;
+}
+#endif
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
   TFLITE_DCHECK(node->builtin_data != nullptr);
@@ -1783,35 +1826,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       filter_height, output_width, output_height, input->type, &data->op_data));
 
 #if ESP_NN
-  if (input->type == kTfLiteInt8) {
-    data_dims_t input_dims =  {
-                                .width = input_width, .height = input_height,
-                                .channels = input->dims->data[3], .extra = 1
-                              };
-    data_dims_t output_dims = {
-                                .width = output_width, .height = output_height,
-                                .channels = output->dims->data[3], .extra = 1
-                              };
-    data_dims_t filter_dims = {
-                                .width = filter_width, .height = filter_height,
-                                .channels = 0, .extra = 0
-                              };
-    conv_params_t conv_params = {
-                                  .in_offset = 0, .out_offset = 0,
-                                  .stride = {params.stride_width, params.stride_height},
-                                  .padding = {data->op_data.padding.width, data->op_data.padding.height},
-                                  .dilation = {0, 0}, .activation = {-128, 127}
-                                };
-
-    int scratch_buf_size = esp_nn_get_conv_scratch_size(
-        &input_dims, &filter_dims, &output_dims, &conv_params);
-    if (scratch_buf_size > 0) {
-      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
-        context, scratch_buf_size, &data->buffer_idx));
-    } else {
-      data->buffer_idx = -1;
-    }
-  }
+  TF_LITE_ENSURE_STATUS(
+      RequestScratchBuffer(context, params, input, filter, output, data));
 #endif
 
   micro_context->DeallocateTempTfLiteTensor(output);
@@ -1822,6 +1838,26 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 }
 
 #if ESP_NN
+// esp_nn_conv_s8, on the filter that the prepared op data packed ahead of
+// time when it has one
+inline void EspNnConv(const OpDataConv& op_data, const data_dims_t* input_dims,
+                      const int8_t* input, const data_dims_t* filter_dims,
+                      const int8_t* filter, const int32_t* bias,
+                      const data_dims_t* output_dims, int8_t* output,
+                      const conv_params_t* conv_params,
+                      const quant_data_t* quant_data) {
+#if EI_CLASSIFIER_PREPACKED_WEIGHTS
+  if (op_data.filter_base != nullptr) {
+    esp_nn_conv_s8_packed(input_dims, input, filter_dims, filter,
+                          op_data.filter_base, output_dims, output,
+                          conv_params, quant_data);
+    return;
+  }
+#endif
+  esp_nn_conv_s8(input_dims, input, filter_dims, filter, bias, output_dims,
+                 output, conv_params, quant_data);
+}
+
 // Fixed-point per-channel-quantization convolution Int8 function wrapper.
 inline void EvalQuantizedPerChannel(
     TfLiteContext* context, TfLiteNode* node, const TfLiteConvParams& params,
@@ -1905,12 +1941,49 @@ inline void EvalQuantizedPerChannel(
                                 .mult = data.op_data.per_channel_output_multiplier
                               };
 
-    for (int i_batch = 0; i_batch < batch_size; i_batch++) {
-      esp_nn_conv_s8(&input_dims, input_data + i_batch * input_size,
-                     &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
-                     tflite::micro::GetTensorData<int32_t>(bias),
-                     &output_dims, output_data + i_batch * output_size,
-                     &conv_params, &quant_data);
+    // ESP-NN keeps its scratch buffer in a global, so a convolution that
+    // needs one stays on one worker
+    const int64_t macs = static_cast<int64_t>(output_size) * filter_height *
+                         filter_width * input_depth;
+    const int workers =
+        (batch_size == 1 && data.buffer_idx < 0)
+            ? tflite::micro::ParallelWorkers(output_height, macs)
+            : 1;
+    if (workers > 1) {
+      tflite::micro::ParallelFor(workers, [&](int worker, int count) {
+        int start;
+        int end;
+        tflite::micro::ParallelRange(output_height, worker, count, &start,
+                                     &end);
+        if (start == end) {
+          return;
+        }
+        const tflite::micro::ConvRowSlice slice =
+            tflite::micro::SliceConvRows(start, stride_height, pad_height,
+                                         input_height);
+        data_dims_t slice_input_dims = input_dims;
+        slice_input_dims.height = slice.input_height;
+        data_dims_t slice_output_dims = output_dims;
+        slice_output_dims.height = end - start;
+        conv_params_t slice_params = conv_params;
+        slice_params.padding.height = slice.pad_top;
+        EspNnConv(data.op_data, &slice_input_dims,
+                  input_data + slice.input_row * input_width * input_depth,
+                  &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+                  tflite::micro::GetTensorData<int32_t>(bias),
+                  &slice_output_dims,
+                  output_data + start * output_width * output_depth,
+                  &slice_params, &quant_data);
+      });
+    } else {
+      for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+        EspNnConv(data.op_data, &input_dims,
+                  input_data + i_batch * input_size, &filter_dims,
+                  tflite::micro::GetTensorData<int8_t>(filter),
+                  tflite::micro::GetTensorData<int32_t>(bias), &output_dims,
+                  output_data + i_batch * output_size, &conv_params,
+                  &quant_data);
+      }
     }
   } else {
     reference_integer_ops::ConvPerChannel(
@@ -2034,6 +2107,55 @@ TfLiteRegistration Register_CONV_2D() {
   return tflite::micro::RegisterOp(Init, Prepare, Eval);
 }
 
+TfLiteStatus ConvWritePrepared(TfLiteContext* context, TfLiteNode* node,
+                               PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpDataConv& data =
+      static_cast<const NodeData*>(node->user_data)->op_data;
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kConvWeightsTensor);
+
+  WriteOpDataConvArrays(writer, "", data,
+                        filter->dims->data[kConvQuantizedDimension]);
+  const bool packed = WritePackedConvFilter(context, node, writer, data);
+  writer->BeginOpData("tflite::OpDataConv");
+  WriteOpDataConvFields(writer, "", data, packed);
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
+TfLiteStatus ConvInitPrepared(TfLiteContext* context, TfLiteNode* node,
+                              const void* op_data) {
+  NodeData* data = static_cast<NodeData*>(
+      context->AllocatePersistentBuffer(context, sizeof(NodeData)));
+  TF_LITE_ENSURE(context, data != nullptr);
+  // a copy, for the scratch buffer index; the per channel arrays stay in flash
+  data->op_data = *static_cast<const OpDataConv*>(op_data);
+  node->user_data = data;
+
+#if ESP_NN
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kConvInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, kConvWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kConvOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  TF_LITE_ENSURE_STATUS(RequestScratchBuffer(
+      context, *(static_cast<const TfLiteConvParams*>(node->builtin_data)),
+      input, filter, output, data));
+
+  micro_context->DeallocateTempTfLiteTensor(output);
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+#endif
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #else
@@ -2058,9 +2180,11 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/portable_tensor_utils.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/parallel.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -2071,6 +2195,61 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
 }
 
+// Int8 per channel convolution, the output rows split across workers
+void EvalQuantizedPerChannelInt8(const TfLiteConvParams& params,
+                                 const OpDataConv& data,
+                                 const TfLiteEvalTensor* input,
+                                 const TfLiteEvalTensor* filter,
+                                 const int8_t* filter_data,
+                                 const TfLiteEvalTensor* bias,
+                                 TfLiteEvalTensor* output) {
+  const ConvParams op_params = ConvParamsQuantized(params, data);
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  const RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int32_t* bias_data =
+      tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  const int output_height = output_shape.Dims(1);
+  const int input_row = input_shape.Dims(2) * input_shape.Dims(3);
+  const int output_row = output_shape.Dims(2) * output_shape.Dims(3);
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) *
+                       filter_shape.Dims(1) * filter_shape.Dims(2) *
+                       filter_shape.Dims(3);
+  const int workers =
+      input_shape.Dims(0) == 1
+          ? tflite::micro::ParallelWorkers(output_height, macs)
+          : 1;
+
+  tflite::micro::ParallelFor(workers, [&](int worker, int count) {
+    int start;
+    int end;
+    tflite::micro::ParallelRange(output_height, worker, count, &start, &end);
+    if (start == end) {
+      return;
+    }
+    const tflite::micro::ConvRowSlice slice = tflite::micro::SliceConvRows(
+        start, op_params.stride_height, op_params.padding_values.height,
+        input_shape.Dims(1));
+    ConvParams slice_params = op_params;
+    slice_params.padding_values.height = slice.pad_top;
+    RuntimeShape slice_input_shape(4, input_shape.DimsData());
+    slice_input_shape.SetDim(1, slice.input_height);
+    RuntimeShape slice_output_shape(4, output_shape.DimsData());
+    slice_output_shape.SetDim(1, end - start);
+
+    optimized_integer_ops::ConvPerChannel(
+        slice_params, data.per_channel_output_multiplier,
+        data.per_channel_output_shift, slice_input_shape,
+        input_data + slice.input_row * input_row, filter_shape, filter_data,
+        bias_shape, bias_data, slice_output_shape,
+        output_data + start * output_row);
+  });
+}
+
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kConvInputTensor);
@@ -2167,30 +2346,14 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
               tflite::micro::GetTensorData<int8_t>(filter),
               tflite::micro::GetTensorShape(filter).FlatSize(),
               unpacked_filter_data);
-          reference_integer_ops::ConvPerChannel(
-              ConvParamsQuantized(params, data),
-              data.per_channel_output_multiplier, data.per_channel_output_shift,
-              tflite::micro::GetTensorShape(input),
-              tflite::micro::GetTensorData<int8_t>(input),
-              tflite::micro::GetTensorShape(filter), unpacked_filter_data,
-              tflite::micro::GetTensorShape(bias),
-              tflite::micro::GetOptionalTensorData<int32_t>(bias),
-              tflite::micro::GetTensorShape(output),
-              tflite::micro::GetTensorData<int8_t>(output));
+          EvalQuantizedPerChannelInt8(params, data, input, filter,
+                                      unpacked_filter_data, bias, output);
           break;
         }
         case kTfLiteInt8: {
-          reference_integer_ops::ConvPerChannel(
-              ConvParamsQuantized(params, data),
-              data.per_channel_output_multiplier, data.per_channel_output_shift,
-              tflite::micro::GetTensorShape(input),
-              tflite::micro::GetTensorData<int8_t>(input),
-              tflite::micro::GetTensorShape(filter),
-              tflite::micro::GetTensorData<int8_t>(filter),
-              tflite::micro::GetTensorShape(bias),
-              tflite::micro::GetOptionalTensorData<int32_t>(bias),
-              tflite::micro::GetTensorShape(output),
-              tflite::micro::GetTensorData<int8_t>(output));
+          EvalQuantizedPerChannelInt8(
+              params, data, input, filter,
+              tflite::micro::GetTensorData<int8_t>(filter), bias, output);
           break;
         }
         default:
@@ -2214,6 +2377,33 @@ TfLiteRegistration Register_CONV_2D() {
   return tflite::micro::RegisterOp(Init, ConvPrepare, Eval);
 }
 
+TfLiteStatus ConvWritePrepared(TfLiteContext* context, TfLiteNode* node,
+                               PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpDataConv& data = *(static_cast<const OpDataConv*>(node->user_data));
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kConvWeightsTensor);
+  // int4 filters are unpacked into a scratch buffer that prepare requests
+  if (filter->type == kTfLiteInt4) {
+    return kTfLiteError;
+  }
+
+  WriteOpDataConvArrays(writer, "", data,
+                        filter->dims->data[kConvQuantizedDimension]);
+  const bool packed = WritePackedConvFilter(context, node, writer, data);
+  writer->BeginOpData("tflite::OpDataConv");
+  WriteOpDataConvFields(writer, "", data, packed);
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
+TfLiteStatus ConvInitPrepared(TfLiteContext*, TfLiteNode* node,
+                              const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #endif
@@ -21,6 +21,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/types.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
 
 namespace tflite {
 
@@ -49,6 +50,13 @@ struct OpDataConv {
   // A buffer used to store unpacked filter values. This is used if the source
   // tensor is of n-bit precision that cannot be easily processed by kernels.
   int filter_buffer_index;
+
+  // bias + input offset * sum(filter) per output channel, set only in
+  // prepared op data whose filter was packed ahead of time for the ESP-NN
+  // kernels of the plain ESP32 (esp_nn_conv_packed.h); with
+  // EI_CLASSIFIER_PREPACKED_WEIGHTS the filter tensor then holds the packed
+  // filter.
+  const int32_t* filter_base;
 };
 
 extern const int kConvInputTensor;
@@ -76,6 +84,40 @@ TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
 
 TfLiteStatus ConvPrepare(TfLiteContext* context, TfLiteNode* node);
 
+// Write the per channel arrays of data (<prefix>per_channel_output_multiplier
+// and <prefix>per_channel_output_shift), then its fields, as constants.
+// packed: WritePackedConvFilter() wrote the filter of data.
+void WriteOpDataConvArrays(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, int num_channels);
+void WriteOpDataConvFields(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, bool packed = false);
+
+// Writes the int8 filter of a convolution (tensor filter_tensor of the model)
+// packed for esp_nn_conv_s8_packed_opt(), <prefix>packed_filter in place of
+// the tensor's data, and its <prefix>filter_base. False, with nothing
+// written, for a filter those kernels do not take packed; the caller checks
+// that the convolution runs on them at all (int8 input, no dilation).
+bool WritePackedConvFilter(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, int filter_tensor,
+                           const TfLiteEvalTensor* filter,
+                           const TfLiteEvalTensor* bias);
+// The same for the filter of a CONV_2D node, which the ESP-NN kernels run
+// when its input is int8 and it has no dilation
+bool WritePackedConvFilter(TfLiteContext* context, TfLiteNode* node,
+                           PreparedOpDataWriter* writer,
+                           const OpDataConv& data);
+
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h). kTfLiteError, with nothing written, for op data that
+// cannot be constant. The generic and ESP-NN kernels only.
+TfLiteStatus ConvWritePrepared(TfLiteContext* context, TfLiteNode* node,
+                               PreparedOpDataWriter* writer);
+
+// Sets node up from op data that ConvWritePrepared wrote, in place of init
+// and prepare.
+TfLiteStatus ConvInitPrepared(TfLiteContext* context, TfLiteNode* node,
+                              const void* op_data);
+
 // This is the most generic TfLiteRegistration. The actual supported types may
 // still be target dependent. The only requirement is that every implementation
 // (reference or optimized) must define this function.
@@ -13,6 +13,10 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_conv_packed.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/c_api_types.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
@@ -119,6 +123,7 @@ TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
   data->input_zero_point = input->params.zero_point;
   data->filter_zero_point = filter->params.zero_point;
   data->output_zero_point = output->params.zero_point;
+  data->filter_base = nullptr;
 
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(filter);
@@ -201,4 +206,106 @@ TfLiteStatus ConvPrepare(TfLiteContext* context, TfLiteNode* node) {
 
   return kTfLiteOk;
 }
+void WriteOpDataConvArrays(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, int num_channels) {
+  char name[64];
+  if (data.per_channel_output_multiplier != nullptr) {
+    snprintf(name, sizeof(name), "%sper_channel_output_multiplier", prefix);
+    writer->Int32Array(name, data.per_channel_output_multiplier, num_channels);
+  }
+  if (data.per_channel_output_shift != nullptr) {
+    snprintf(name, sizeof(name), "%sper_channel_output_shift", prefix);
+    writer->Int32Array(name, data.per_channel_output_shift, num_channels);
+  }
+}
+
+void WriteOpDataConvFields(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, bool packed) {
+  char name[64];
+  writer->BeginStruct("padding");
+  writer->Int("width", data.padding.width);
+  writer->Int("height", data.padding.height);
+  writer->Int("width_offset", data.padding.width_offset);
+  writer->Int("height_offset", data.padding.height_offset);
+  writer->EndStruct();
+  writer->Int("input_zero_point", data.input_zero_point);
+  writer->Int("filter_zero_point", data.filter_zero_point);
+  writer->Int("output_zero_point", data.output_zero_point);
+  writer->Int("output_multiplier", data.output_multiplier);
+  writer->Int("output_shift", data.output_shift);
+  snprintf(name, sizeof(name), "%sper_channel_output_multiplier", prefix);
+  writer->Int32Pointer("per_channel_output_multiplier",
+                       data.per_channel_output_multiplier ? name : nullptr);
+  snprintf(name, sizeof(name), "%sper_channel_output_shift", prefix);
+  writer->Int32Pointer("per_channel_output_shift",
+                       data.per_channel_output_shift ? name : nullptr);
+  writer->Int("output_activation_min", data.output_activation_min);
+  writer->Int("output_activation_max", data.output_activation_max);
+  writer->Int("filter_buffer_index", data.filter_buffer_index);
+  snprintf(name, sizeof(name), "%sfilter_base", prefix);
+  writer->Int32Pointer("filter_base", packed ? name : nullptr);
+}
+
+bool WritePackedConvFilter(PreparedOpDataWriter* writer, const char* prefix,
+                           const OpDataConv& data, int filter_tensor,
+                           const TfLiteEvalTensor* filter,
+                           const TfLiteEvalTensor* bias) {
+  if (filter->type != kTfLiteInt8 || filter->dims->size != 4 ||
+      data.per_channel_output_multiplier == nullptr ||
+      (bias != nullptr && bias->type != kTfLiteInt32)) {
+    return false;
+  }
+  const int out_channels = filter->dims->data[0];
+  const int size = filter->dims->data[1] * filter->dims->data[2] *
+                   filter->dims->data[3];
+  // a filter that an earlier node shares is packed already; the base depends
+  // on the input offset, so every node gets its own
+  const bool shared = writer->HasTensorData(filter_tensor);
+  int8_t* packed =
+      shared ? nullptr : static_cast<int8_t*>(malloc(out_channels * size));
+  int32_t* filter_base =
+      static_cast<int32_t*>(malloc(out_channels * sizeof(int32_t)));
+  char name[64];
+  snprintf(name, sizeof(name), "%spacked_filter", prefix);
+  const bool ok = filter_base != nullptr &&
+                  (shared || (packed != nullptr &&
+                              writer->TensorData(filter_tensor, name)));
+  if (ok) {
+    const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+    if (!shared) {
+      esp_nn_conv_pack_filter_s8(filter_data, out_channels, size, packed);
+      writer->Int8Array(name, packed, out_channels * size);
+    }
+    esp_nn_conv_filter_base_s8(
+        filter_data,
+        bias != nullptr ? tflite::micro::GetTensorData<int32_t>(bias)
+                        : nullptr,
+        out_channels, size, -data.input_zero_point, filter_base);
+    snprintf(name, sizeof(name), "%sfilter_base", prefix);
+    writer->Int32Array(name, filter_base, out_channels, false);
+  }
+  free(packed);
+  free(filter_base);
+  return ok;
+}
+
+bool WritePackedConvFilter(TfLiteContext* context, TfLiteNode* node,
+                           PreparedOpDataWriter* writer,
+                           const OpDataConv& data) {
+  const auto& params =
+      *(static_cast<const TfLiteConvParams*>(node->builtin_data));
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kConvInputTensor);
+  if (input->type != kTfLiteInt8 || params.dilation_width_factor != 1 ||
+      params.dilation_height_factor != 1) {
+    return false;
+  }
+  return WritePackedConvFilter(
+      writer, "", data, node->inputs->data[kConvWeightsTensor],
+      tflite::micro::GetEvalInput(context, node, kConvWeightsTensor),
+      NumInputs(node) == 3
+          ? tflite::micro::GetEvalInput(context, node, kConvBiasTensor)
+          : nullptr);
+}
+
 }  // namespace tflite
@@ -49,6 +49,18 @@ TfLiteStatus CalculateOpDataDepthwiseConv(
 
 TfLiteStatus DepthwiseConvPrepare(TfLiteContext* context, TfLiteNode* node);
 
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h). kTfLiteError, with nothing written, for op data that
+// cannot be constant. The generic and ESP-NN kernels only.
+TfLiteStatus DepthwiseConvWritePrepared(TfLiteContext* context,
+                                        TfLiteNode* node,
+                                        PreparedOpDataWriter* writer);
+
+// Sets node up from op data that DepthwiseConvWritePrepared wrote, in place
+// of init and prepare.
+TfLiteStatus DepthwiseConvInitPrepared(TfLiteContext* context,
+                                       TfLiteNode* node, const void* op_data);
+
 // This is the most generic TfLiteRegistration. The actual supported types may
 // still be target dependent. The only requirement is that every implementation
 // (reference or optimized) must define this function.
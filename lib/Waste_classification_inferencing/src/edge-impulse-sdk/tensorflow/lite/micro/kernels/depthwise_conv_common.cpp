@@ -124,6 +124,7 @@ TfLiteStatus CalculateOpDataDepthwiseConv(
   data->input_zero_point = input->params.zero_point;
   data->filter_zero_point = filter->params.zero_point;
   data->output_zero_point = output->params.zero_point;
+  data->filter_base = nullptr;
 
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(filter);
@@ -1416,6 +1416,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/parallel.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
 
 #if ESP_NN
@@ -1536,17 +1537,46 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
       const int8_t *filter_data = tflite::micro::GetTensorData<int8_t>(filter);
 
-      for (int b = 0; b < batches; ++b) {
-        esp_nn_fully_connected_s8(input_data, -data.input_zero_point,
-                                  accum_depth,
-                                  filter_data, -data.filter_zero_point,
-                                  bias_data, output_data, output_depth,
-                                  data.output_zero_point,
-                                  data.output_shift, data.output_multiplier,
-                                  data.output_activation_min,
-                                  data.output_activation_max);
-        input_data += accum_depth;
-        output_data += output_depth;
+      // one batch: the output channels split across workers
+      const int workers =
+          batches == 1
+              ? tflite::micro::ParallelWorkers(
+                    output_depth,
+                    static_cast<int64_t>(output_depth) * accum_depth)
+              : 1;
+      if (workers > 1) {
+        tflite::micro::ParallelFor(workers, [&](int worker, int count) {
+          int start;
+          int end;
+          tflite::micro::ParallelRange(output_depth, worker, count, &start,
+                                       &end);
+          if (start == end) {
+            return;
+          }
+          esp_nn_fully_connected_s8(input_data, -data.input_zero_point,
+                                    accum_depth,
+                                    filter_data + start * accum_depth,
+                                    -data.filter_zero_point,
+                                    bias_data ? bias_data + start : nullptr,
+                                    output_data + start, end - start,
+                                    data.output_zero_point,
+                                    data.output_shift, data.output_multiplier,
+                                    data.output_activation_min,
+                                    data.output_activation_max);
+        });
+      } else {
+        for (int b = 0; b < batches; ++b) {
+          esp_nn_fully_connected_s8(input_data, -data.input_zero_point,
+                                    accum_depth,
+                                    filter_data, -data.filter_zero_point,
+                                    bias_data, output_data, output_depth,
+                                    data.output_zero_point,
+                                    data.output_shift, data.output_multiplier,
+                                    data.output_activation_min,
+                                    data.output_activation_max);
+          input_data += accum_depth;
+          output_data += output_depth;
+        }
       }
 #else
       tflite::reference_integer_ops::FullyConnected(
@@ -1596,6 +1626,22 @@ TfLiteRegistration Register_FULLY_CONNECTED() {
   return tflite::micro::RegisterOp(Init, Prepare, Eval);
 }
 
+TfLiteStatus FullyConnectedWritePrepared(TfLiteContext*,
+                                         TfLiteNode* node,
+                                         PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  WriteOpDataFullyConnected(
+      writer, *(static_cast<const OpDataFullyConnected*>(node->user_data)));
+  return kTfLiteOk;
+}
+
+TfLiteStatus FullyConnectedInitPrepared(TfLiteContext*,
+                                        TfLiteNode* node, const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #else
@@ -1620,8 +1666,10 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/portable_tensor_utils.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/parallel.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -1633,6 +1681,52 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
                                            sizeof(OpDataFullyConnected));
 }
 
+// Int8 fully connected; with one batch, the output channels split across
+// workers
+void EvalQuantizedInt8(const OpDataFullyConnected& data,
+                       const TfLiteEvalTensor* input,
+                       const TfLiteEvalTensor* filter,
+                       const int8_t* filter_data,
+                       const TfLiteEvalTensor* bias,
+                       TfLiteEvalTensor* output) {
+  const FullyConnectedParams op_params = FullyConnectedParamsQuantized(data);
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  const RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int32_t* bias_data =
+      tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  const int output_dim = output_shape.DimensionsCount() - 1;
+  const int output_depth = output_shape.Dims(output_dim);
+  const int accum_depth =
+      filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  const int workers =
+      output_shape.FlatSize() == output_depth
+          ? tflite::micro::ParallelWorkers(
+                output_depth, static_cast<int64_t>(output_depth) * accum_depth)
+          : 1;
+
+  tflite::micro::ParallelFor(workers, [&](int worker, int count) {
+    int start;
+    int end;
+    tflite::micro::ParallelRange(output_depth, worker, count, &start, &end);
+    if (start == end) {
+      return;
+    }
+    RuntimeShape slice_output_shape(output_shape.DimensionsCount(),
+                                    output_shape.DimsData());
+    slice_output_shape.SetDim(output_dim, end - start);
+    tflite::optimized_integer_ops::FullyConnected(
+        op_params, input_shape, input_data, filter_shape,
+        filter_data + start * accum_depth, bias_shape,
+        bias_data ? bias_data + start : nullptr, slice_output_shape,
+        output_data + start);
+  });
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -1732,28 +1826,14 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
               tflite::micro::GetTensorData<int8_t>(filter),
               tflite::micro::GetTensorShape(filter).FlatSize(),
               unpacked_filter_data);
-          tflite::reference_integer_ops::FullyConnected(
-              FullyConnectedParamsQuantized(data),
-              tflite::micro::GetTensorShape(input),
-              tflite::micro::GetTensorData<int8_t>(input),
-              tflite::micro::GetTensorShape(filter), unpacked_filter_data,
-              tflite::micro::GetTensorShape(bias),
-              tflite::micro::GetOptionalTensorData<int32_t>(bias),
-              tflite::micro::GetTensorShape(output),
-              tflite::micro::GetTensorData<int8_t>(output));
+          EvalQuantizedInt8(data, input, filter, unpacked_filter_data, bias,
+                            output);
           break;
         }
         case kTfLiteInt8: {
-          tflite::reference_integer_ops::FullyConnected(
-              FullyConnectedParamsQuantized(data),
-              tflite::micro::GetTensorShape(input),
-              tflite::micro::GetTensorData<int8_t>(input),
-              tflite::micro::GetTensorShape(filter),
-              tflite::micro::GetTensorData<int8_t>(filter),
-              tflite::micro::GetTensorShape(bias),
-              tflite::micro::GetOptionalTensorData<int32_t>(bias),
-              tflite::micro::GetTensorShape(output),
-              tflite::micro::GetTensorData<int8_t>(output));
+          EvalQuantizedInt8(data, input, filter,
+                            tflite::micro::GetTensorData<int8_t>(filter), bias,
+                            output);
           break;
         }
         default: {
@@ -1804,6 +1884,29 @@ TfLiteRegistration Register_FULLY_CONNECTED() {
   return tflite::micro::RegisterOp(Init, Prepare, Eval);
 }
 
+TfLiteStatus FullyConnectedWritePrepared(TfLiteContext* context,
+                                         TfLiteNode* node,
+                                         PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, kFullyConnectedWeightsTensor);
+  // int4 filters are unpacked into a scratch buffer that prepare requests
+  if (filter->type == kTfLiteInt4) {
+    return kTfLiteError;
+  }
+
+  WriteOpDataFullyConnected(
+      writer, *(static_cast<const OpDataFullyConnected*>(node->user_data)));
+  return kTfLiteOk;
+}
+
+TfLiteStatus FullyConnectedInitPrepared(TfLiteContext*,
+                                        TfLiteNode* node, const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #endif
@@ -20,6 +20,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/types.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
 
 namespace tflite {
 
@@ -68,6 +69,22 @@ TfLiteStatus CalculateOpDataFullyConnected(
     TfLiteType data_type, const TfLiteTensor* input, const TfLiteTensor* filter,
     const TfLiteTensor* bias, TfLiteTensor* output, OpDataFullyConnected* data);
 
+// Writes data as a constant
+void WriteOpDataFullyConnected(PreparedOpDataWriter* writer,
+                               const OpDataFullyConnected& data);
+
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h). kTfLiteError, with nothing written, for op data that
+// cannot be constant. The generic and ESP-NN kernels only.
+TfLiteStatus FullyConnectedWritePrepared(TfLiteContext* context,
+                                         TfLiteNode* node,
+                                         PreparedOpDataWriter* writer);
+
+// Sets node up from op data that FullyConnectedWritePrepared wrote, in place
+// of init and prepare.
+TfLiteStatus FullyConnectedInitPrepared(TfLiteContext* context,
+                                        TfLiteNode* node, const void* op_data);
+
 // This is the most generic TfLiteRegistration. The actual supported types may
 // still be target dependent. The only requirement is that every implementation
 // (reference or optimized) must define this function.
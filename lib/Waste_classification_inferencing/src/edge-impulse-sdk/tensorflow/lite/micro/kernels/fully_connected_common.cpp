@@ -81,4 +81,21 @@ TfLiteStatus CalculateOpDataFullyConnected(
   return kTfLiteOk;
 }
 
+void WriteOpDataFullyConnected(PreparedOpDataWriter* writer,
+                               const OpDataFullyConnected& data) {
+  writer->BeginOpData("tflite::OpDataFullyConnected");
+  writer->Int("output_multiplier", data.output_multiplier);
+  writer->Int("output_shift", data.output_shift);
+  writer->Int("output_activation_min", data.output_activation_min);
+  writer->Int("output_activation_max", data.output_activation_max);
+  writer->Int("input_quantized_index", data.input_quantized_index);
+  writer->Int("input_zero_point", data.input_zero_point);
+  writer->Int("filter_zero_point", data.filter_zero_point);
+  writer->Int("output_zero_point", data.output_zero_point);
+#if !defined(HEXAGON)
+  writer->Int("filter_buffer_index", data.filter_buffer_index);
+#endif
+  writer->EndOpData();
+}
+
 }  // namespace tflite
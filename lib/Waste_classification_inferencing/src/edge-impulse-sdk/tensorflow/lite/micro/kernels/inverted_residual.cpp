@@ -0,0 +1,625 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "../../../../classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/inverted_residual.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/parallel.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN == 1 && ESP_NN
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
+#define EI_INVERTED_RESIDUAL_ESP_NN 1
+#else
+#define EI_INVERTED_RESIDUAL_ESP_NN 0
+#endif
+
+namespace tflite {
+
+const int kInvertedResidualInputTensor = 0;
+const int kInvertedResidualExpandWeightsTensor = 1;
+const int kInvertedResidualExpandBiasTensor = 2;
+const int kInvertedResidualDepthwiseWeightsTensor = 3;
+const int kInvertedResidualDepthwiseBiasTensor = 4;
+const int kInvertedResidualProjectWeightsTensor = 5;
+const int kInvertedResidualProjectBiasTensor = 6;
+const int kInvertedResidualExpandedTensor = 0;
+const int kInvertedResidualDepthwiseTensor = 1;
+const int kInvertedResidualProjectedTensor = 2;
+const int kInvertedResidualOutputTensor = 0;
+
+namespace {
+
+struct EvalTensors {
+  const int8_t* input;
+  const int8_t* expand_filter;
+  const int32_t* expand_bias;
+  const int8_t* depthwise_filter;
+  const int32_t* depthwise_bias;
+  const int8_t* project_filter;
+  const int32_t* project_bias;
+  int8_t* output;
+};
+
+struct OpData : OpDataInvertedResidual {
+  int buffer_idx;
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  int conv_scratch_idx;
+  int depthwise_scratch_idx;
+#endif
+};
+
+TfLiteConvParams PointwiseParams() {
+  TfLiteConvParams params;
+  params.padding = kTfLitePaddingValid;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.activation = kTfLiteActNone;  // the range is in OpDataConv
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  return params;
+}
+
+TfLiteDepthwiseConvParams DepthwiseParams3x3() {
+  TfLiteDepthwiseConvParams params;
+  params.padding = kTfLitePaddingSame;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.depth_multiplier = 1;
+  params.activation = kTfLiteActNone;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  return params;
+}
+
+TfLiteStatus PrepareConvQuantization(TfLiteContext* context,
+                                     const TfLiteTensor* input,
+                                     const TfLiteTensor* filter,
+                                     const TfLiteTensor* bias,
+                                     TfLiteTensor* output,
+                                     TfLiteFusedActivation activation,
+                                     int channels, OpDataConv* data) {
+  TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_EQ(context, filter->quantization.type,
+                    kTfLiteAffineQuantization);
+  TF_LITE_ENSURE(context, bias != nullptr);
+
+  data->per_channel_output_multiplier = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  data->per_channel_output_shift = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->per_channel_output_multiplier != nullptr &&
+                              data->per_channel_output_shift != nullptr);
+
+  TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+      context, input, filter, bias, output, activation,
+      &data->output_multiplier, &data->output_shift,
+      &data->output_activation_min, &data->output_activation_max,
+      data->per_channel_output_multiplier, data->per_channel_output_shift,
+      channels));
+
+  data->input_zero_point = input->params.zero_point;
+  data->filter_zero_point = filter->params.zero_point;
+  data->output_zero_point = output->params.zero_point;
+  data->filter_buffer_index = -1;
+  data->filter_base = nullptr;
+  return kTfLiteOk;
+}
+
+// 1x1 convolution over rows x width pixels
+void PointwiseConv(const OpData& op,
+                   const OpDataConv& data, int rows, int input_depth,
+                   const int8_t* input, const int8_t* filter,
+                   const int32_t* bias, int output_depth, int8_t* output) {
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  esp_nn_set_conv_scratch_buf(
+      op.conv_scratch_idx > -1
+          ? context->GetScratchBuffer(context, op.conv_scratch_idx)
+          : nullptr);
+
+  data_dims_t input_dims = {op.width, rows, input_depth, 1};
+  data_dims_t output_dims = {op.width, rows, output_depth, 1};
+  data_dims_t filter_dims = {1, 1, 0, 0};
+  conv_params_t conv_params = {-data.input_zero_point,
+                               data.output_zero_point,
+                               {1, 1},
+                               {0, 0},
+                               {0, 0},
+                               {data.output_activation_min,
+                                data.output_activation_max}};
+  quant_data_t quant_data = {data.per_channel_output_shift,
+                             data.per_channel_output_multiplier};
+#if EI_CLASSIFIER_PREPACKED_WEIGHTS
+  if (data.filter_base != nullptr) {
+    esp_nn_conv_s8_packed(&input_dims, input, &filter_dims, filter,
+                          data.filter_base, &output_dims, output,
+                          &conv_params, &quant_data);
+    return;
+  }
+#endif
+  esp_nn_conv_s8(&input_dims, input, &filter_dims, filter, bias, &output_dims,
+                 output, &conv_params, &quant_data);
+#else
+  const int32_t input_dims[4] = {1, rows, op.width, input_depth};
+  const int32_t filter_dims[4] = {output_depth, 1, 1, input_depth};
+  const int32_t bias_dims[1] = {output_depth};
+  const int32_t output_dims[4] = {1, rows, op.width, output_depth};
+  optimized_integer_ops::ConvPerChannel(
+      ConvParamsQuantized(PointwiseParams(), data),
+      data.per_channel_output_multiplier, data.per_channel_output_shift,
+      RuntimeShape(4, input_dims), input, RuntimeShape(4, filter_dims), filter,
+      RuntimeShape(1, bias_dims), bias, RuntimeShape(4, output_dims), output);
+#endif
+}
+
+// 3x3 depthwise convolution of a band: rows + 2 input rows (the halo
+// included) make rows output rows
+void DepthwiseBand(const OpData& op, int rows,
+                   const int8_t* input, const int8_t* filter,
+                   const int32_t* bias, int8_t* output) {
+  const OpDataConv& data = op.depthwise;
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  esp_nn_set_depthwise_conv_scratch_buf(
+      op.depthwise_scratch_idx > -1
+          ? context->GetScratchBuffer(context, op.depthwise_scratch_idx)
+          : nullptr);
+
+  data_dims_t input_dims = {op.width, rows + 2, op.expanded_depth, 1};
+  data_dims_t output_dims = {op.width, rows, op.expanded_depth, 1};
+  data_dims_t filter_dims = {3, 3, 0, 0};
+  dw_conv_params_t conv_params = {-data.input_zero_point,
+                                  data.output_zero_point,
+                                  1,
+                                  {1, 1},
+                                  {data.padding.width, data.padding.height},
+                                  {0, 0},
+                                  {data.output_activation_min,
+                                   data.output_activation_max}};
+  quant_data_t quant_data = {data.per_channel_output_shift,
+                             data.per_channel_output_multiplier};
+  esp_nn_depthwise_conv_s8(&input_dims, input, &filter_dims, filter, bias,
+                           &output_dims, output, &conv_params, &quant_data);
+#else
+  const int32_t input_dims[4] = {1, rows + 2, op.width, op.expanded_depth};
+  const int32_t filter_dims[4] = {1, 3, 3, op.expanded_depth};
+  const int32_t bias_dims[1] = {op.expanded_depth};
+  const int32_t output_dims[4] = {1, rows, op.width, op.expanded_depth};
+  optimized_integer_ops::DepthwiseConvPerChannel(
+      DepthwiseConvParamsQuantized(DepthwiseParams3x3(), data),
+      data.per_channel_output_multiplier, data.per_channel_output_shift,
+      RuntimeShape(4, input_dims), input, RuntimeShape(4, filter_dims), filter,
+      RuntimeShape(1, bias_dims), bias, RuntimeShape(4, output_dims), output);
+#endif
+}
+
+// output = residual + output, elementwise (in place is fine for both paths)
+void ResidualAdd(const OpDataAdd& data, int count, const int8_t* residual,
+                 int8_t* output) {
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  esp_nn_add_elementwise_s8(residual, output, data.input1_offset,
+                            data.input2_offset, data.input1_multiplier,
+                            data.input2_multiplier, data.input1_shift,
+                            data.input2_shift, data.left_shift, output,
+                            data.output_offset, data.output_multiplier,
+                            data.output_shift, data.output_activation_min,
+                            data.output_activation_max, count);
+#else
+  tflite::ArithmeticParams op_params;
+  op_params.left_shift = data.left_shift;
+  op_params.input1_offset = data.input1_offset;
+  op_params.input1_multiplier = data.input1_multiplier;
+  op_params.input1_shift = data.input1_shift;
+  op_params.input2_offset = data.input2_offset;
+  op_params.input2_multiplier = data.input2_multiplier;
+  op_params.input2_shift = data.input2_shift;
+  op_params.output_offset = data.output_offset;
+  op_params.output_multiplier = data.output_multiplier;
+  op_params.output_shift = data.output_shift;
+  SetActivationParams(data.output_activation_min, data.output_activation_max,
+                      &op_params);
+  const int32_t dims[1] = {count};
+  const RuntimeShape shape(1, dims);
+  optimized_integer_ops::Add(op_params, shape, residual, shape, output, shape,
+                             output);
+#endif
+}
+
+// The band buffers, and the buffers the ESP-NN kernels want
+TfLiteStatus RequestScratchBuffers(TfLiteContext* context, OpData* data) {
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+      context, data->band_size * tflite::micro::kMaxParallelWorkers,
+      &data->buffer_idx));
+
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  const int rows = data->rows_per_band;
+  data_dims_t input_dims = {data->width, rows, data->input_depth, 1};
+  data_dims_t expanded_dims = {data->width, rows, data->expanded_depth, 1};
+  data_dims_t band_dims = {data->width, rows + 2, data->expanded_depth, 1};
+  data_dims_t pointwise_filter = {1, 1, 0, 0};
+  data_dims_t depthwise_filter_dims = {3, 3, 0, 0};
+  conv_params_t conv_params = {0, 0, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+  dw_conv_params_t dw_params = {
+      0, 0, 1, {1, 1}, {data->depthwise.padding.width, 0}, {0, 0}, {-128, 127}};
+
+  int conv_scratch = esp_nn_get_conv_scratch_size(
+      &input_dims, &pointwise_filter, &expanded_dims, &conv_params);
+  const int project_scratch = esp_nn_get_conv_scratch_size(
+      &expanded_dims, &pointwise_filter, &input_dims, &conv_params);
+  if (project_scratch > conv_scratch) {
+    conv_scratch = project_scratch;
+  }
+  data->conv_scratch_idx = -1;
+  if (conv_scratch > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, conv_scratch, &data->conv_scratch_idx));
+  }
+
+  const int depthwise_scratch = esp_nn_get_depthwise_conv_scratch_size(
+      &band_dims, &depthwise_filter_dims, &expanded_dims, &dw_params);
+  data->depthwise_scratch_idx = -1;
+  if (depthwise_scratch > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, depthwise_scratch, &data->depthwise_scratch_idx));
+  }
+#endif
+  return kTfLiteOk;
+}
+
+void* Init(TfLiteContext* context, const char*, size_t) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  const auto& params =
+      *(static_cast<const TfLiteInvertedResidualParams*>(node->builtin_data));
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 7);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+  TF_LITE_ENSURE(context,
+                 node->intermediates != nullptr && node->intermediates->size == 3);
+
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualInputTensor);
+  TfLiteTensor* expand_filter = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualExpandWeightsTensor);
+  TfLiteTensor* expand_bias = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualExpandBiasTensor);
+  TfLiteTensor* depthwise_filter = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualDepthwiseWeightsTensor);
+  TfLiteTensor* depthwise_bias = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualDepthwiseBiasTensor);
+  TfLiteTensor* project_filter = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualProjectWeightsTensor);
+  TfLiteTensor* project_bias = micro_context->AllocateTempInputTensor(
+      node, kInvertedResidualProjectBiasTensor);
+  TfLiteTensor* expanded = micro_context->AllocateTempIntermediateTensor(
+      node, kInvertedResidualExpandedTensor);
+  TfLiteTensor* depthwise = micro_context->AllocateTempIntermediateTensor(
+      node, kInvertedResidualDepthwiseTensor);
+  TfLiteTensor* projected = micro_context->AllocateTempIntermediateTensor(
+      node, kInvertedResidualProjectedTensor);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(
+      node, kInvertedResidualOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && expand_filter != nullptr &&
+                              depthwise_filter != nullptr &&
+                              project_filter != nullptr &&
+                              expanded != nullptr && depthwise != nullptr &&
+                              projected != nullptr && output != nullptr);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, input->dims->data[0], 1);
+  TF_LITE_ENSURE(context, HaveSameShapes(input, output));
+
+  data->height = input->dims->data[1];
+  data->width = input->dims->data[2];
+  data->input_depth = input->dims->data[3];
+  data->expanded_depth = expand_filter->dims->data[0];
+
+  // 1x1 expand, 3x3 depthwise with a multiplier of 1, 1x1 project back
+  TF_LITE_ENSURE(context, expand_filter->dims->data[1] == 1 &&
+                              expand_filter->dims->data[2] == 1 &&
+                              expand_filter->dims->data[3] == data->input_depth);
+  TF_LITE_ENSURE(context,
+                 depthwise_filter->dims->data[1] == 3 &&
+                     depthwise_filter->dims->data[2] == 3 &&
+                     depthwise_filter->dims->data[3] == data->expanded_depth);
+  TF_LITE_ENSURE(context,
+                 project_filter->dims->data[0] == data->input_depth &&
+                     project_filter->dims->data[1] == 1 &&
+                     project_filter->dims->data[2] == 1 &&
+                     project_filter->dims->data[3] == data->expanded_depth);
+
+  TF_LITE_ENSURE_STATUS(PrepareConvQuantization(
+      context, input, expand_filter, expand_bias, expanded,
+      params.expand_activation, data->expanded_depth, &data->expand));
+  TF_LITE_ENSURE_STATUS(PrepareConvQuantization(
+      context, expanded, depthwise_filter, depthwise_bias, depthwise,
+      params.depthwise_activation, data->expanded_depth, &data->depthwise));
+  TF_LITE_ENSURE_STATUS(PrepareConvQuantization(
+      context, depthwise, project_filter, project_bias, projected,
+      params.project_activation, data->input_depth, &data->project));
+  data->expand.padding = {0, 0, 0, 0};
+  data->project.padding = {0, 0, 0, 0};
+
+  // SAME on a 3x3 stride 1 window is one pixel all round; the top and bottom
+  // one come from zero point rows in the band buffer
+  int out_width;
+  int out_height;
+  data->depthwise.padding = ComputePaddingHeightWidth(
+      1, 1, 1, 1, data->height, data->width, 3, 3, kTfLitePaddingSame,
+      &out_height, &out_width);
+  TF_LITE_ENSURE_EQ(context, data->depthwise.padding.height, 1);
+  data->depthwise.padding.height = 0;
+  data->depthwise.padding.height_offset = 0;
+
+  TfLiteAddParams add_params;
+  add_params.activation = params.add_activation;
+  add_params.pot_scale_int16 = false;
+  TF_LITE_ENSURE_STATUS(CalculateOpDataAdd(context, &add_params, input,
+                                           projected, output, &data->add));
+
+  data->rows_per_band = params.rows_per_band < 1 ? 1 : params.rows_per_band;
+  if (data->rows_per_band > data->height) {
+    data->rows_per_band = data->height;
+  }
+  const int expanded_row = data->width * data->expanded_depth;
+  data->band_size = (2 * data->rows_per_band + 2) * expanded_row;
+  TF_LITE_ENSURE_STATUS(RequestScratchBuffers(context, data));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(expand_filter);
+  micro_context->DeallocateTempTfLiteTensor(expand_bias);
+  micro_context->DeallocateTempTfLiteTensor(depthwise_filter);
+  micro_context->DeallocateTempTfLiteTensor(depthwise_bias);
+  micro_context->DeallocateTempTfLiteTensor(project_filter);
+  micro_context->DeallocateTempTfLiteTensor(project_bias);
+  micro_context->DeallocateTempTfLiteTensor(expanded);
+  micro_context->DeallocateTempTfLiteTensor(depthwise);
+  micro_context->DeallocateTempTfLiteTensor(projected);
+  micro_context->DeallocateTempTfLiteTensor(output);
+
+  return kTfLiteOk;
+}
+
+// Output rows [y0, y1) through one band buffer; y0 is on a band boundary
+void EvalRows(const OpData& data, const EvalTensors& t, int8_t* band,
+              int y0, int y1) {
+  const int rows_per_band = data.rows_per_band;
+  const int input_row = data.width * data.input_depth;
+  const int expanded_row = data.width * data.expanded_depth;
+  const int8_t padding = static_cast<int8_t>(data.expand.output_zero_point);
+  int8_t* depthwise = band + (rows_per_band + 2) * expanded_row;
+
+  // band row k holds expanded row (first output row of the band - 1 + k);
+  // row -1 is the top padding
+  if (y0 == 0) {
+    memset(band, padding, expanded_row);
+  } else {
+    PointwiseConv(data, data.expand, 1, data.input_depth,
+                  t.input + (y0 - 1) * input_row, t.expand_filter,
+                  t.expand_bias, data.expanded_depth, band);
+  }
+  int filled = 1;
+  int next_row = y0;
+
+  for (int y = y0; y < y1; y += rows_per_band) {
+    const int rows = std::min(rows_per_band, y1 - y);
+
+    const int fresh = std::min(rows + 2 - filled, data.height - next_row);
+    if (fresh > 0) {
+      PointwiseConv(data, data.expand, fresh, data.input_depth,
+                    t.input + next_row * input_row, t.expand_filter,
+                    t.expand_bias, data.expanded_depth,
+                    band + filled * expanded_row);
+      filled += fresh;
+      next_row += fresh;
+    }
+    if (filled < rows + 2) {
+      // row height is the bottom padding
+      memset(band + filled * expanded_row, padding,
+             (rows + 2 - filled) * expanded_row);
+    }
+
+    DepthwiseBand(data, rows, band, t.depthwise_filter,
+                  t.depthwise_bias, depthwise);
+    PointwiseConv(data, data.project, rows, data.expanded_depth,
+                  depthwise, t.project_filter, t.project_bias,
+                  data.input_depth, t.output + y * input_row);
+    ResidualAdd(data.add, rows * input_row, t.input + y * input_row,
+                t.output + y * input_row);
+
+    // the last two expanded rows are the top of the next band
+    memmove(band, band + rows * expanded_row, 2 * expanded_row);
+    filled = 2;
+  }
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+
+  EvalTensors t;
+  t.input = tflite::micro::GetTensorData<int8_t>(
+      tflite::micro::GetEvalInput(context, node, kInvertedResidualInputTensor));
+  t.expand_filter =
+      tflite::micro::GetTensorData<int8_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualExpandWeightsTensor));
+  t.expand_bias =
+      tflite::micro::GetTensorData<int32_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualExpandBiasTensor));
+  t.depthwise_filter =
+      tflite::micro::GetTensorData<int8_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualDepthwiseWeightsTensor));
+  t.depthwise_bias =
+      tflite::micro::GetTensorData<int32_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualDepthwiseBiasTensor));
+  t.project_filter =
+      tflite::micro::GetTensorData<int8_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualProjectWeightsTensor));
+  t.project_bias =
+      tflite::micro::GetTensorData<int32_t>(tflite::micro::GetEvalInput(
+          context, node, kInvertedResidualProjectBiasTensor));
+  t.output = tflite::micro::GetTensorData<int8_t>(
+      tflite::micro::GetEvalOutput(context, node, kInvertedResidualOutputTensor));
+
+  int8_t* bands = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, data.buffer_idx));
+  TF_LITE_ENSURE(context, bands != nullptr);
+
+  // whole bands split across workers, each with its own band buffer; ESP-NN
+  // keeps its scratch buffers in globals, so a block that needs one stays on
+  // one worker
+  const int band_count =
+      (data.height + data.rows_per_band - 1) / data.rows_per_band;
+  const int64_t macs =
+      static_cast<int64_t>(data.height) * data.width * data.expanded_depth *
+      (2 * data.input_depth + 9);
+  int workers = tflite::micro::ParallelWorkers(band_count, macs);
+#if EI_INVERTED_RESIDUAL_ESP_NN
+  if (data.conv_scratch_idx > -1 || data.depthwise_scratch_idx > -1) {
+    workers = 1;
+  }
+#endif
+
+  tflite::micro::ParallelFor(workers, [&](int worker, int count) {
+    int start;
+    int end;
+    tflite::micro::ParallelRange(band_count, worker, count, &start, &end);
+    if (start == end) {
+      return;
+    }
+    EvalRows(data, t, bands + worker * data.band_size,
+             start * data.rows_per_band,
+             std::min(end * data.rows_per_band, data.height));
+  });
+
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration Register_INVERTED_RESIDUAL() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
+}
+
+TfLiteStatus InvertedResidualWritePrepared(TfLiteContext* context,
+                                           TfLiteNode* node,
+                                           PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+
+  WriteOpDataConvArrays(writer, "expand_", data.expand, data.expanded_depth);
+  WriteOpDataConvArrays(writer, "depthwise_", data.depthwise,
+                        data.expanded_depth);
+  WriteOpDataConvArrays(writer, "project_", data.project, data.input_depth);
+  // the 1x1 convolutions run on the ESP-NN kernels whenever ESP-NN is in
+  const bool expand_packed = WritePackedConvFilter(
+      writer, "expand_", data.expand,
+      node->inputs->data[kInvertedResidualExpandWeightsTensor],
+      tflite::micro::GetEvalInput(context, node,
+                                  kInvertedResidualExpandWeightsTensor),
+      tflite::micro::GetEvalInput(context, node,
+                                  kInvertedResidualExpandBiasTensor));
+  const bool project_packed = WritePackedConvFilter(
+      writer, "project_", data.project,
+      node->inputs->data[kInvertedResidualProjectWeightsTensor],
+      tflite::micro::GetEvalInput(context, node,
+                                  kInvertedResidualProjectWeightsTensor),
+      tflite::micro::GetEvalInput(context, node,
+                                  kInvertedResidualProjectBiasTensor));
+  writer->BeginOpData("tflite::OpDataInvertedResidual");
+  writer->BeginStruct("expand");
+  WriteOpDataConvFields(writer, "expand_", data.expand, expand_packed);
+  writer->EndStruct();
+  writer->BeginStruct("depthwise");
+  WriteOpDataConvFields(writer, "depthwise_", data.depthwise);
+  writer->EndStruct();
+  writer->BeginStruct("project");
+  WriteOpDataConvFields(writer, "project_", data.project, project_packed);
+  writer->EndStruct();
+  writer->BeginStruct("add");
+  WriteOpDataAdd(writer, data.add);
+  writer->EndStruct();
+  writer->Int("height", data.height);
+  writer->Int("width", data.width);
+  writer->Int("input_depth", data.input_depth);
+  writer->Int("expanded_depth", data.expanded_depth);
+  writer->Int("rows_per_band", data.rows_per_band);
+  writer->Int("band_size", data.band_size);
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
+TfLiteStatus InvertedResidualInitPrepared(TfLiteContext* context,
+                                          TfLiteNode* node,
+                                          const void* op_data) {
+  OpData* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  TF_LITE_ENSURE(context, data != nullptr);
+  // a copy, for the scratch buffer indices; the per channel arrays stay in
+  // flash
+  static_cast<OpDataInvertedResidual&>(*data) =
+      *static_cast<const OpDataInvertedResidual*>(op_data);
+  node->user_data = data;
+  return RequestScratchBuffers(context, data);
+}
+
+}  // namespace tflite
@@ -0,0 +1,112 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_INVERTED_RESIDUAL_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_INVERTED_RESIDUAL_H_
+
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
+
+namespace tflite {
+
+// A whole int8 MobileNetV2 residual block in one node:
+//   output = ADD(input, CONV_2D 1x1(DEPTHWISE_CONV_2D 3x3(CONV_2D 1x1(input))))
+// with stride 1 and SAME padding throughout. The graph compiler emits it in
+// place of the four nodes. The expanded activation is never materialized:
+// rows_per_band output rows are computed at a time, with the expanded rows
+// they need held in a scratch buffer of (2 * rows_per_band + 2) expanded rows.
+// Every stage calls the same inner kernel as the standalone op, so the result
+// is bit exact with the unfused graph.
+typedef struct {
+  TfLiteFusedActivation expand_activation;
+  TfLiteFusedActivation depthwise_activation;
+  TfLiteFusedActivation project_activation;
+  TfLiteFusedActivation add_activation;
+  int rows_per_band;
+} TfLiteInvertedResidualParams;
+
+// Inputs: the block input and the weights of the three convolutions
+extern const int kInvertedResidualInputTensor;
+extern const int kInvertedResidualExpandWeightsTensor;
+extern const int kInvertedResidualExpandBiasTensor;
+extern const int kInvertedResidualDepthwiseWeightsTensor;
+extern const int kInvertedResidualDepthwiseBiasTensor;
+extern const int kInvertedResidualProjectWeightsTensor;
+extern const int kInvertedResidualProjectBiasTensor;
+// Intermediates: the tensors the unfused graph would have written, for their
+// quantization only (no memory is needed for them)
+extern const int kInvertedResidualExpandedTensor;
+extern const int kInvertedResidualDepthwiseTensor;
+extern const int kInvertedResidualProjectedTensor;
+// Outputs
+extern const int kInvertedResidualOutputTensor;
+
+// What prepare works out from the tensors; the kernel's op data adds the
+// scratch buffers to it
+struct OpDataInvertedResidual {
+  OpDataConv expand;
+  OpDataConv depthwise;  // padding.height is 0, the band carries its halo rows
+  OpDataConv project;
+  OpDataAdd add;
+
+  int height;
+  int width;
+  int input_depth;
+  int expanded_depth;
+  int rows_per_band;
+  // per worker: (rows_per_band + 2) expanded rows, then rows_per_band
+  // depthwise rows
+  int band_size;
+};
+
+TfLiteRegistration Register_INVERTED_RESIDUAL();
+
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h).
+TfLiteStatus InvertedResidualWritePrepared(TfLiteContext* context,
+                                           TfLiteNode* node,
+                                           PreparedOpDataWriter* writer);
+
+// Sets node up from op data that InvertedResidualWritePrepared wrote, in place
+// of init and prepare.
+TfLiteStatus InvertedResidualInitPrepared(TfLiteContext* context,
+                                          TfLiteNode* node,
+                                          const void* op_data);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_INVERTED_RESIDUAL_H_
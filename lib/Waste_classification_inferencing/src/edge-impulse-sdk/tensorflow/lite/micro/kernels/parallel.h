@@ -0,0 +1,110 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PARALLEL_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PARALLEL_H_
+
+#include <stdint.h>
+
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+namespace tflite {
+namespace micro {
+
+// Kernels split their output (rows of a convolution, channels of a fully
+// connected layer) into one contiguous range per worker and run the ranges
+// through ei_parallel_run. Every output element is computed exactly as on
+// one worker, so the result does not depend on the number of workers.
+constexpr int kMaxParallelWorkers = EI_CLASSIFIER_PARALLEL_WORKERS;
+
+// Below this many multiply-accumulates the hand-off costs more than it saves
+constexpr int64_t kParallelMinMacs = 64 * 1024;
+
+// Workers to split count output rows (or channels) of macs work across
+inline int ParallelWorkers(int count, int64_t macs) {
+  if (kMaxParallelWorkers <= 1 || macs < kParallelMinMacs) {
+    return 1;
+  }
+  return count < kMaxParallelWorkers ? (count < 1 ? 1 : count)
+                                     : kMaxParallelWorkers;
+}
+
+// The range [*start, *end) of count items that worker gets
+inline void ParallelRange(int count, int worker, int workers, int* start,
+                          int* end) {
+  *start = static_cast<int>(static_cast<int64_t>(count) * worker / workers);
+  *end = static_cast<int>(static_cast<int64_t>(count) * (worker + 1) / workers);
+}
+
+// Calls fn(worker, workers) on every worker and returns when all are done
+template <typename Fn>
+inline void ParallelFor(int workers, const Fn& fn) {
+  if (workers <= 1) {
+    fn(0, 1);
+    return;
+  }
+  ei_parallel_fn_t run = [](void* arg, int worker, int count) {
+    (*static_cast<const Fn*>(arg))(worker, count);
+  };
+  if (ei_parallel_run(run, const_cast<Fn*>(&fn), workers) != EI_IMPULSE_OK) {
+    for (int worker = 0; worker < workers; worker++) {
+      fn(worker, workers);
+    }
+  }
+}
+
+// Output rows [start, ...) of a convolution read the input from row
+// start * stride - pad on. To run the kernel on just those rows, give it the
+// input from input_row on, input_height rows of it, and pad_top rows of
+// padding; the window of every output row then lands where it did before.
+struct ConvRowSlice {
+  int input_row;
+  int input_height;
+  int pad_top;
+};
+
+inline ConvRowSlice SliceConvRows(int start, int stride, int pad,
+                                  int input_height) {
+  const int first = start * stride - pad;
+  if (first >= 0) {
+    return {first, input_height - first, 0};
+  }
+  return {0, input_height, -first};
+}
+
+}  // namespace micro
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PARALLEL_H_
@@ -0,0 +1,209 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
+
+#include <cmath>
+#include <stdio.h>
+
+namespace tflite {
+
+PreparedOpDataWriter::PreparedOpDataWriter(WriteFn write, void* user)
+    : write_(write),
+      user_(user),
+      node_(0),
+      depth_(0),
+      arena_bytes_(0),
+      tensor_data_count_(0) {}
+
+void PreparedOpDataWriter::BeginNode(int node) { node_ = node; }
+
+void PreparedOpDataWriter::Int32Array(const char* name, const int32_t* values,
+                                      int count, bool from_arena) {
+  char text[96];
+  snprintf(text, sizeof(text), "const int32_t node%d_%s[%d] = {", node_, name,
+           count);
+  Text(text);
+  for (int i = 0; i < count; i++) {
+    snprintf(text, sizeof(text), "%s%ld,", i % 8 == 0 ? "\n  " : " ",
+             static_cast<long>(values[i]));
+    Text(text);
+  }
+  Text("\n};\n");
+  if (from_arena) {
+    // prepare allocated it with AllocatePersistentBuffer, 16 byte aligned
+    arena_bytes_ += (count * sizeof(int32_t) + 15) & ~static_cast<size_t>(15);
+  }
+}
+
+void PreparedOpDataWriter::Int8Array(const char* name, const int8_t* values,
+                                     int count) {
+  char text[128];
+  snprintf(text, sizeof(text),
+           "const MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) int8_t "
+           "node%d_%s[%d] = {",
+           node_, name, count);
+  Text(text);
+  for (int i = 0; i < count; i++) {
+    snprintf(text, sizeof(text), "%s%d,", i % 16 == 0 ? "\n  " : " ",
+             values[i]);
+    Text(text);
+  }
+  Text("\n};\n");
+}
+
+bool PreparedOpDataWriter::TensorData(int tensor, const char* name) {
+  if (tensor_data_count_ == kMaxTensorData) {
+    return false;
+  }
+  tensor_data_tensor_[tensor_data_count_] = tensor;
+  snprintf(tensor_data_name_[tensor_data_count_], kMaxNameLength, "node%d_%s",
+           node_, name);
+  tensor_data_count_++;
+  return true;
+}
+
+bool PreparedOpDataWriter::HasTensorData(int tensor) const {
+  for (int i = 0; i < tensor_data_count_; i++) {
+    if (tensor_data_tensor_[i] == tensor) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void PreparedOpDataWriter::TensorDataTable(const char* name,
+                                           int tensor_count) {
+  char text[96];
+  snprintf(text, sizeof(text), "const void* const %s[%d] = {", name,
+           tensor_count);
+  Text(text);
+  for (int t = 0; t < tensor_count; t++) {
+    const char* data = "nullptr";
+    for (int i = 0; i < tensor_data_count_; i++) {
+      if (tensor_data_tensor_[i] == t) {
+        data = tensor_data_name_[i];
+      }
+    }
+    snprintf(text, sizeof(text), "\n  %s,", data);
+    Text(text);
+  }
+  Text("\n};\n\n");
+}
+
+void PreparedOpDataWriter::BeginOpData(const char* type) {
+  char text[96];
+  snprintf(text, sizeof(text), "const %s node%d_op_data = {\n", type, node_);
+  Text(text);
+  depth_ = 1;
+}
+
+void PreparedOpDataWriter::EndOpData() {
+  Text("};\n\n");
+  depth_ = 0;
+}
+
+void PreparedOpDataWriter::BeginStruct(const char* field) {
+  Indent();
+  Text("/* ");
+  Text(field);
+  Text(" */ {\n");
+  depth_++;
+}
+
+void PreparedOpDataWriter::EndStruct() {
+  depth_--;
+  Indent();
+  Text("},\n");
+}
+
+void PreparedOpDataWriter::Int(const char* field, int32_t value) {
+  char text[16];
+  snprintf(text, sizeof(text), "%ld", static_cast<long>(value));
+  Field(field, text);
+}
+
+void PreparedOpDataWriter::Bool(const char* field, bool value) {
+  Field(field, value ? "true" : "false");
+}
+
+void PreparedOpDataWriter::Float(const char* field, float value) {
+  char text[32];
+  if (std::isinf(value)) {
+    snprintf(text, sizeof(text), "%sHUGE_VALF", value < 0 ? "-" : "");
+  } else {
+    snprintf(text, sizeof(text), "%.9ef", static_cast<double>(value));
+  }
+  Field(field, text);
+}
+
+void PreparedOpDataWriter::Double(const char* field, double value) {
+  char text[32];
+  if (std::isinf(value)) {
+    snprintf(text, sizeof(text), "%sHUGE_VAL", value < 0 ? "-" : "");
+  } else {
+    snprintf(text, sizeof(text), "%.17e", value);
+  }
+  Field(field, text);
+}
+
+void PreparedOpDataWriter::Int32Pointer(const char* field, const char* name) {
+  if (name == nullptr) {
+    Field(field, "nullptr");
+    return;
+  }
+  // the kernels take int32_t*, but only read through it
+  char text[96];
+  snprintf(text, sizeof(text), "const_cast<int32_t*>(node%d_%s)", node_, name);
+  Field(field, text);
+}
+
+void PreparedOpDataWriter::Text(const char* text) { write_(user_, text); }
+
+void PreparedOpDataWriter::Field(const char* field, const char* value) {
+  Indent();
+  Text("/* ");
+  Text(field);
+  Text(" */ ");
+  Text(value);
+  Text(",\n");
+}
+
+void PreparedOpDataWriter::Indent() {
+  for (int i = 0; i < depth_; i++) {
+    Text("  ");
+  }
+}
+
+}  // namespace tflite
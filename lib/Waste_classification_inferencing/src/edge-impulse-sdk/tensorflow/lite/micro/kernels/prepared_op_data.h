@@ -0,0 +1,128 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_PREPARED_OP_DATA_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_PREPARED_OP_DATA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tflite {
+
+// Writes the op data that a kernel's prepare worked out (quantized
+// multipliers and shifts, padding, zero points) as C++ constants, for a
+// compiled model built with EI_CLASSIFIER_PREPARED_OP_DATA: the model then
+// points TfLiteNode::user_data at the constants, which stay in flash, and
+// does not run init and prepare for that node.
+//
+// A kernel writes the arrays its op data points to first, then one aggregate
+// initializer of its op data type, every field in declaration order. The
+// constants of node N are named nodeN_<name>, the op data nodeN_op_data.
+//
+// A kernel can also replace the data of a constant tensor of its node (a
+// filter in a layout its kernels read faster): it writes the new data with
+// Int8Array and names it with TensorData. The model reads it in place of the
+// tensor's own data when built with EI_CLASSIFIER_PREPACKED_WEIGHTS.
+class PreparedOpDataWriter {
+ public:
+  // The text goes to write(user, text), a piece at a time
+  typedef void (*WriteFn)(void* user, const char* text);
+
+  PreparedOpDataWriter(WriteFn write, void* user);
+
+  // Starts the constants of a node
+  void BeginNode(int node);
+
+  // const int32_t nodeN_<name>[count] = { ... }; from_arena when prepare
+  // allocated the array in the arena
+  void Int32Array(const char* name, const int32_t* values, int count,
+                  bool from_arena = true);
+
+  // const int8_t nodeN_<name>[count] = { ... }; with the model's weights
+  // (MODEL_SECTION, 16 byte aligned)
+  void Int8Array(const char* name, const int8_t* values, int count);
+
+  // The array nodeN_<name> takes the place of the data of tensor; false when
+  // the table is full, and the tensor has to keep its own data
+  bool TensorData(int tensor, const char* name);
+  // A node before this one replaced the data of tensor (a filter that nodes
+  // share)
+  bool HasTensorData(int tensor) const;
+
+  // const <type> nodeN_op_data = { ... };
+  void BeginOpData(const char* type);
+  void EndOpData();
+
+  // The fields of the op data. A nested aggregate goes between BeginStruct
+  // and EndStruct; Int32Pointer points at an array written with Int32Array,
+  // or is nullptr for no name.
+  void BeginStruct(const char* field);
+  void EndStruct();
+  void Int(const char* field, int32_t value);
+  void Bool(const char* field, bool value);
+  void Float(const char* field, float value);
+  void Double(const char* field, double value);
+  void Int32Pointer(const char* field, const char* name);
+
+  // Any other text, as is
+  void Text(const char* text);
+
+  // const void* const <name>[tensor_count] = { ... }; the replaced data of
+  // every tensor, nullptr for the others
+  void TensorDataTable(const char* name, int tensor_count);
+
+  // Arena bytes that prepare allocated for the arrays written so far, which
+  // a model with the constants does not need
+  size_t ArenaBytes() const { return arena_bytes_; }
+
+ private:
+  void Field(const char* field, const char* value);
+  void Indent();
+
+  static constexpr int kMaxTensorData = 64;
+  static constexpr int kMaxNameLength = 64;
+
+  WriteFn write_;
+  void* user_;
+  int node_;
+  int depth_;
+  size_t arena_bytes_;
+  int tensor_data_count_;
+  int tensor_data_tensor_[kMaxTensorData];
+  char tensor_data_name_[kMaxTensorData][kMaxNameLength];
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_PREPARED_OP_DATA_H_
@@ -407,6 +407,26 @@ static TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
+#if ESP_NN
+// The scratch buffer of the ESP-NN int8 kernel
+static TfLiteStatus RequestScratchBuffer(TfLiteContext* context,
+                                         const TfLiteTensor* input,
+                                         const TfLiteTensor* output,
+                                         NodeData* data) {
+  if (output->type == kTfLiteInt8 && input->type == kTfLiteInt8) {
+    const int32_t input_width = input->dims->data[1];
+    const int32_t input_height = input->dims->data[2];
+    int scratch_buf_size = esp_nn_get_softmax_scratch_size(input_width,
+                                                           input_height);
+    if (scratch_buf_size > 0) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, scratch_buf_size, &data->buffer_idx));
+    }
+  }
+  return kTfLiteOk;
+}
+#endif
+
 static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -427,16 +447,7 @@ static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       CalculateSoftmaxParams(context, input, output, params, op_data);
 
 #if ESP_NN
-  if (output->type == kTfLiteInt8 && input->type == kTfLiteInt8) {
-    const int32_t input_width = input->dims->data[1];
-    const int32_t input_height = input->dims->data[2];
-    int scratch_buf_size = esp_nn_get_softmax_scratch_size(input_width,
-                                                           input_height);
-    if (scratch_buf_size > 0) {
-      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
-        context, scratch_buf_size, &data->buffer_idx));
-    }
-  }
+  TF_LITE_ENSURE_STATUS(RequestScratchBuffer(context, input, output, data));
 #endif
 
   micro_context->DeallocateTempTfLiteTensor(input);
@@ -450,6 +461,36 @@ TfLiteRegistration Register_SOFTMAX() {
   return tflite::micro::RegisterOp(Init, Prepare, Eval);
 }
 
+TfLiteStatus SoftmaxWritePrepared(TfLiteContext*, TfLiteNode* node,
+                                  PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  return WriteSoftmaxParams(
+      writer, static_cast<const NodeData*>(node->user_data)->op_data);
+}
+
+TfLiteStatus SoftmaxInitPrepared(TfLiteContext* context, TfLiteNode* node,
+                                 const void* op_data) {
+  NodeData* data = static_cast<NodeData*>(
+      context->AllocatePersistentBuffer(context, sizeof(NodeData)));
+  TF_LITE_ENSURE(context, data != nullptr);
+  // a copy, for the scratch buffer index
+  data->op_data = *static_cast<const SoftmaxParams*>(op_data);
+  node->user_data = data;
+
+#if ESP_NN
+  data->buffer_idx = -1;
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_STATUS(RequestScratchBuffer(context, input, output, data));
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+#endif
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #else
@@ -560,6 +601,20 @@ TfLiteRegistration Register_SOFTMAX() {
   return tflite::micro::RegisterOp(SoftmaxInit, SoftmaxPrepare, SoftmaxEval);
 }
 
+TfLiteStatus SoftmaxWritePrepared(TfLiteContext*, TfLiteNode* node,
+                                  PreparedOpDataWriter* writer) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  return WriteSoftmaxParams(
+      writer, *(static_cast<const SoftmaxParams*>(node->user_data)));
+}
+
+TfLiteStatus SoftmaxInitPrepared(TfLiteContext*, TfLiteNode* node,
+                                 const void* op_data) {
+  // Eval only reads the op data, so it stays in flash
+  node->user_data = const_cast<void*>(op_data);
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
 
 #endif
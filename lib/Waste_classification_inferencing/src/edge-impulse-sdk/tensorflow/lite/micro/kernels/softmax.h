@@ -19,6 +19,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/types.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/prepared_op_data.h"
 
 namespace tflite {
 
@@ -33,6 +34,22 @@ TfLiteStatus CalculateSoftmaxParams(TfLiteContext* context,
 
 TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node);
 
+// Writes op_data as a constant; kTfLiteError, with nothing written, when it
+// points to lookup tables
+TfLiteStatus WriteSoftmaxParams(PreparedOpDataWriter* writer,
+                                const SoftmaxParams& op_data);
+
+// Writes the op data that prepare worked out for node as constants (see
+// prepared_op_data.h). kTfLiteError, with nothing written, for op data that
+// cannot be constant. The generic and ESP-NN kernels only.
+TfLiteStatus SoftmaxWritePrepared(TfLiteContext* context, TfLiteNode* node,
+                                  PreparedOpDataWriter* writer);
+
+// Sets node up from op data that SoftmaxWritePrepared wrote, in place of init
+// and prepare.
+TfLiteStatus SoftmaxInitPrepared(TfLiteContext* context, TfLiteNode* node,
+                                 const void* op_data);
+
 // This is the most generic TfLiteRegistration. The actual supported types may
 // still be target dependent. The only requirement is that every implementation
 // (reference or optimized) must define this function.
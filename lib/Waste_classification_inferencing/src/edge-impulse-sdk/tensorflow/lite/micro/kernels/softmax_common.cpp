@@ -192,4 +192,31 @@ TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
   return ret_val;
 }
 
+TfLiteStatus WriteSoftmaxParams(PreparedOpDataWriter* writer,
+                                const SoftmaxParams& op_data) {
+  // the int16 lookup tables are built in the arena by prepare
+  if (op_data.table != nullptr || op_data.exp_lut != nullptr ||
+      op_data.one_over_one_plus_x_lut != nullptr ||
+      op_data.uint8_table1 != nullptr || op_data.uint8_table2 != nullptr) {
+    return kTfLiteError;
+  }
+  writer->BeginOpData("tflite::SoftmaxParams");
+  writer->Double("beta", op_data.beta);
+  writer->Int("input_multiplier", op_data.input_multiplier);
+  writer->Int("input_left_shift", op_data.input_left_shift);
+  writer->Int("reverse_scaling_divisor", op_data.reverse_scaling_divisor);
+  writer->Int("reverse_scaling_right_shift",
+              op_data.reverse_scaling_right_shift);
+  writer->Int("diff_min", op_data.diff_min);
+  writer->Int("zero_point", op_data.zero_point);
+  writer->Float("scale", op_data.scale);
+  writer->Int32Pointer("table", nullptr);
+  writer->Int32Pointer("exp_lut", nullptr);
+  writer->Int32Pointer("one_over_one_plus_x_lut", nullptr);
+  writer->Int32Pointer("uint8_table1", nullptr);
+  writer->Int32Pointer("uint8_table2", nullptr);
+  writer->EndOpData();
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
@@ -0,0 +1,200 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/memory_planner/two_tier_memory_planner.h"
+
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+
+namespace {
+
+int AlignSize(int size) { return (size + 15) & ~15; }
+
+}  // namespace
+
+TwoTierMemoryPlanner::TwoTierMemoryPlanner()
+    : fast_arena_size_(0),
+      max_buffer_count_(0),
+      buffer_count_(0),
+      requirements_(nullptr),
+      order_(nullptr),
+      fast_ids_(nullptr),
+      greedy_scratch_(nullptr),
+      greedy_scratch_size_(0),
+      fast_size_(0),
+      need_to_calculate_placements_(true) {}
+
+TfLiteStatus TwoTierMemoryPlanner::Init(unsigned char* scratch_buffer,
+                                        int scratch_buffer_size,
+                                        int fast_arena_size) {
+  fast_arena_size_ = fast_arena_size;
+  buffer_count_ = 0;
+  fast_size_ = 0;
+  need_to_calculate_placements_ = true;
+
+  max_buffer_count_ = scratch_buffer_size / per_buffer_size();
+
+  unsigned char* next_free = scratch_buffer;
+  requirements_ = reinterpret_cast<BufferRequirements*>(next_free);
+  next_free += sizeof(BufferRequirements) * max_buffer_count_;
+
+  order_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
+
+  fast_ids_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
+
+  greedy_scratch_ = next_free;
+  greedy_scratch_size_ =
+      GreedyMemoryPlanner::per_buffer_size() * max_buffer_count_;
+  return kTfLiteOk;
+}
+
+TfLiteStatus TwoTierMemoryPlanner::AddBuffer(int size, int first_time_used,
+                                             int last_time_used,
+                                             int slow_offset,
+                                             uint64_t access_bytes) {
+  if (buffer_count_ >= max_buffer_count_) {
+    MicroPrintf("Too many buffers (max is %d)", max_buffer_count_);
+    return kTfLiteError;
+  }
+  BufferRequirements* current = &requirements_[buffer_count_];
+  current->size = size;
+  current->first_time_used = first_time_used;
+  current->last_time_used = last_time_used;
+  current->slow_offset = slow_offset;
+  current->access_bytes = access_bytes;
+  current->tier = kMemoryTierSlow;
+  current->fast_offset = 0;
+  ++buffer_count_;
+  need_to_calculate_placements_ = true;
+  return kTfLiteOk;
+}
+
+bool TwoTierMemoryPlanner::PlanFast(int count) {
+  greedy_.Init(greedy_scratch_, greedy_scratch_size_);
+  for (int i = 0; i < count; ++i) {
+    const BufferRequirements& b = requirements_[fast_ids_[i]];
+    if (greedy_.AddBuffer(AlignSize(b.size), b.first_time_used,
+                          b.last_time_used) != kTfLiteOk) {
+      return false;
+    }
+  }
+  return static_cast<int>(greedy_.GetMaximumMemorySize()) <= fast_arena_size_;
+}
+
+void TwoTierMemoryPlanner::CalculatePlacementsIfNeeded() {
+  if (!need_to_calculate_placements_) {
+    return;
+  }
+  need_to_calculate_placements_ = false;
+
+  // Sort by access_bytes / (size * lifetime), compared without dividing
+  for (int i = 0; i < buffer_count_; ++i) {
+    requirements_[i].tier = kMemoryTierSlow;
+    const BufferRequirements& b = requirements_[i];
+    const uint64_t b_cost = static_cast<uint64_t>(AlignSize(b.size)) *
+                            (b.last_time_used - b.first_time_used + 1);
+    int j = i;
+    while (j > 0) {
+      const BufferRequirements& a = requirements_[order_[j - 1]];
+      const uint64_t a_cost = static_cast<uint64_t>(AlignSize(a.size)) *
+                              (a.last_time_used - a.first_time_used + 1);
+      if (a.access_bytes * b_cost >= b.access_bytes * a_cost) {
+        break;
+      }
+      order_[j] = order_[j - 1];
+      --j;
+    }
+    order_[j] = i;
+  }
+
+  int fast_count = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    const int id = order_[i];
+    if (requirements_[id].access_bytes == 0 ||
+        AlignSize(requirements_[id].size) > fast_arena_size_) {
+      continue;
+    }
+    fast_ids_[fast_count] = id;
+    if (PlanFast(fast_count + 1)) {
+      ++fast_count;
+    }
+  }
+
+  // Plan the final set again to read back its offsets
+  fast_size_ = 0;
+  if (fast_count > 0 && PlanFast(fast_count)) {
+    fast_size_ = greedy_.GetMaximumMemorySize();
+    for (int i = 0; i < fast_count; ++i) {
+      BufferRequirements& b = requirements_[fast_ids_[i]];
+      b.tier = kMemoryTierFast;
+      greedy_.GetOffsetForBuffer(i, &b.fast_offset);
+    }
+  }
+}
+
+TfLiteStatus TwoTierMemoryPlanner::GetPlacementForBuffer(int buffer_index,
+                                                         MemoryTier* tier,
+                                                         int* offset) {
+  CalculatePlacementsIfNeeded();
+  if ((buffer_index < 0) || (buffer_index >= buffer_count_)) {
+    MicroPrintf("buffer index %d is outside range 0 to %d", buffer_index,
+                buffer_count_);
+    return kTfLiteError;
+  }
+  const BufferRequirements& b = requirements_[buffer_index];
+  *tier = b.tier;
+  *offset = b.tier == kMemoryTierFast ? b.fast_offset : b.slow_offset;
+  return kTfLiteOk;
+}
+
+size_t TwoTierMemoryPlanner::GetFastMemorySize() {
+  CalculatePlacementsIfNeeded();
+  return fast_size_;
+}
+
+uint64_t TwoTierMemoryPlanner::GetAccessBytes(MemoryTier tier) {
+  CalculatePlacementsIfNeeded();
+  uint64_t total = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    if (requirements_[i].tier == tier) {
+      total += requirements_[i].access_bytes;
+    }
+  }
+  return total;
+}
+
+}  // namespace tflite
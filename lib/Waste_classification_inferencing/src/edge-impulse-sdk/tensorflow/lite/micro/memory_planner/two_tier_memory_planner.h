@@ -0,0 +1,125 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TWO_TIER_MEMORY_PLANNER_H_
+#define TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TWO_TIER_MEMORY_PLANNER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/compatibility.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+
+namespace tflite {
+
+enum MemoryTier {
+  kMemoryTierFast = 0,  // small, e.g. internal SRAM
+  kMemoryTierSlow = 1,  // large, e.g. PSRAM
+};
+
+// Places buffers in two arenas: a small fast one and a large slow one that
+// already holds every buffer at an offline planned offset (so anything left
+// out of the fast arena simply stays where it was).
+//
+// Every buffer comes with the bytes it is expected to move (read plus written)
+// per invoke. Buffers are taken in order of bytes moved per byte of fast arena
+// per unit of lifetime, and each one is kept in the fast arena if the greedy
+// plan of everything taken so far still fits; buffers that do not overlap in
+// time share fast memory the same way they would in a single arena.
+class TwoTierMemoryPlanner {
+ public:
+  TwoTierMemoryPlanner();
+
+  // scratch_buffer is working memory for the plan, per_buffer_size() bytes
+  // for every buffer; it can be reused once the placements have been read.
+  TfLiteStatus Init(unsigned char* scratch_buffer, int scratch_buffer_size,
+                    int fast_arena_size);
+
+  // slow_offset is where the buffer sits in the slow arena, access_bytes the
+  // bytes read and written per invoke.
+  TfLiteStatus AddBuffer(int size, int first_time_used, int last_time_used,
+                         int slow_offset, uint64_t access_bytes);
+
+  int GetBufferCount() const { return buffer_count_; }
+
+  // Tier and offset within that tier's arena
+  TfLiteStatus GetPlacementForBuffer(int buffer_index, MemoryTier* tier,
+                                     int* offset);
+
+  // High-water mark of the fast arena
+  size_t GetFastMemorySize();
+
+  // Expected bytes moved per invoke in a tier
+  uint64_t GetAccessBytes(MemoryTier tier);
+
+  // Number of bytes required in order to plan a buffer.
+  static size_t per_buffer_size() {
+    return sizeof(BufferRequirements) + 2 * sizeof(int) +
+           GreedyMemoryPlanner::per_buffer_size();
+  }
+
+ private:
+  void CalculatePlacementsIfNeeded();
+  // Greedy plan of the buffers in fast_ids_, false if it does not fit
+  bool PlanFast(int count);
+
+  struct BufferRequirements {
+    int size;
+    int first_time_used;
+    int last_time_used;
+    int slow_offset;
+    uint64_t access_bytes;
+    MemoryTier tier;
+    int fast_offset;
+  };
+
+  int fast_arena_size_;
+  int max_buffer_count_;
+  int buffer_count_;
+  BufferRequirements* requirements_;
+  int* order_;     // buffer ids, most bytes moved per fast byte first
+  int* fast_ids_;  // the buffers in the fast arena, in the order taken
+  unsigned char* greedy_scratch_;
+  int greedy_scratch_size_;
+  GreedyMemoryPlanner greedy_;
+  size_t fast_size_;
+  bool need_to_calculate_placements_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TWO_TIER_MEMORY_PLANNER_H_
@@ -28,6 +28,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/depthwise_conv.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/ethosu.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/tree_ensemble_classifier.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/inverted_residual.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/fully_connected.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/micro_ops.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/pooling.h"
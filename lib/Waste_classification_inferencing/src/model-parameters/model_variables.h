@@ -41,7 +41,7 @@
 
 #include <stdint.h>
 #include "model_metadata.h"
-#include "tflite-model/tflite_learn_864078_78_compiled.h"
+#include "tflite-model/tflite_learn_864078_5_compiled.h"
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/engines.h"
 #include "edge-impulse-sdk/classifier/postprocessing/ei_postprocessing_common.h"
@@ -75,11 +75,29 @@ ei_model_dsp_t ei_dsp_blocks_864078_16[ei_dsp_blocks_864078_16_size] = {
 };
 const ei_config_tflite_eon_graph_t ei_config_graph_864078_78 = {
     .implementation_version = 1,
-    .model_init = &tflite_learn_864078_78_init,
-    .model_invoke = &tflite_learn_864078_78_invoke,
-    .model_reset = &tflite_learn_864078_78_reset,
-    .model_input = &tflite_learn_864078_78_input,
-    .model_output = &tflite_learn_864078_78_output,
+    .model_init = &tflite_learn_864078_5_init,
+    .model_invoke = &tflite_learn_864078_5_invoke,
+    .model_reset = &tflite_learn_864078_5_reset,
+    .model_input = &tflite_learn_864078_5_input,
+    .model_output = &tflite_learn_864078_5_output,
+    .model_input_quantization = &tflite_learn_864078_5_input_quantization,
+    .model_instance_init = &tflite_learn_864078_5_instance_init,
+    .model_instance_invoke = &tflite_learn_864078_5_instance_invoke,
+    .model_instance_invoke_batch = &tflite_learn_864078_5_instance_invoke_batch,
+    .model_instance_reset = &tflite_learn_864078_5_instance_reset,
+    .model_instance_input = &tflite_learn_864078_5_instance_input,
+    .model_instance_output = &tflite_learn_864078_5_instance_output,
+    .model_invoke_logits = &tflite_learn_864078_5_invoke_logits,
+    .model_logits = &tflite_learn_864078_5_logits,
+    .model_invoke_softmax = &tflite_learn_864078_5_invoke_softmax,
+    .model_invoke_start = &tflite_learn_864078_5_invoke_start,
+    .model_invoke_step = &tflite_learn_864078_5_invoke_step,
+    .model_invoke_abort = &tflite_learn_864078_5_invoke_abort,
+    .model_invoke_completed = &tflite_learn_864078_5_invoke_completed,
+#if EI_CLASSIFIER_PROFILE_OPS
+    .model_profile = &tflite_learn_864078_5_profile,
+    .model_profile_reset = &tflite_learn_864078_5_profile_reset,
+#endif
 };
 
 const uint8_t ei_output_tensors_indices_864078_78[1] = { 0 };
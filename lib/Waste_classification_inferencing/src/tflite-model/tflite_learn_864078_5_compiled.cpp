@@ -32,10 +32,15 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <new>
+#include <atomic>
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/classifier/ei_model_profile.h"
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/memory_planner/two_tier_memory_planner.h"
 
 #if EI_CLASSIFIER_PRINT_STATE
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -87,16 +92,41 @@ extern void ei_printf(const char *format, ...);
 #define EI_MAX_OVERFLOW_BUFFER_COUNT 10
 #endif // EI_MAX_OVERFLOW_BUFFER_COUNT
 
+// Size of a second, fast arena (internal RAM where tensor_arena ends up in
+// external RAM). The scratch buffers and the tensors that move the most bytes
+// for their size and lifetime are placed in it at init; 0 disables it.
+#ifndef EI_TENSOR_ARENA_FAST_SIZE
+#define EI_TENSOR_ARENA_FAST_SIZE 0
+#endif // EI_TENSOR_ARENA_FAST_SIZE
+
+// Size of each of the two buffers that the constants (filters, biases) of the
+// next node are copied into, in the background, while the current node runs
+// (see ei_copy_async_start). Nodes whose constants do not fit keep reading
+// them from flash; 0 disables staging.
+#ifndef EI_WEIGHT_STAGING_SIZE
+#define EI_WEIGHT_STAGING_SIZE 0
+#endif // EI_WEIGHT_STAGING_SIZE
+
 using namespace tflite;
 using namespace tflite::ops;
 using namespace tflite::ops::micro;
 
 namespace {
 
+#if EI_CLASSIFIER_PREPARED_OP_DATA
+// prepared_op_data[], the op data of the nodes that do not run init and
+// prepare, kPreparedArenaBytes, the arena that prepare would have taken for
+// their per channel arrays, and prepared_tensor_data[], the packed filters
+// that take the place of a tensor's data (EI_CLASSIFIER_PREPACKED_WEIGHTS)
+#include "tflite-model/tflite_learn_864078_5_prepared.h"
+#else
+constexpr int kPreparedArenaBytes = 0;
+#endif
+
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX) || defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX_GNU)
-constexpr int kTensorArenaSize = 228080;
+constexpr int kTensorArenaSize = 197504 - kPreparedArenaBytes;
 #else
-constexpr int kTensorArenaSize = 227056;
+constexpr int kTensorArenaSize = 196480 - kPreparedArenaBytes;
 #endif
 
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC)
@@ -116,15 +146,31 @@ uint8_t tensor_arena[kTensorArenaSize] ALIGN(16) __attribute__((section(".tensor
 uint8_t* tensor_arena = NULL;
 #endif
 
-static uint8_t* tensor_boundary;
-static uint8_t* current_location;
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+// Statically allocated, so it is in internal RAM even where large heap
+// allocations go to PSRAM
+#if defined (EI_TENSOR_ARENA_FAST_LOCATION)
+uint8_t tensor_arena_fast[EI_TENSOR_ARENA_FAST_SIZE] ALIGN(16) DEFINE_SECTION(STRINGIZE_VALUE_OF(EI_TENSOR_ARENA_FAST_LOCATION));
+#else
+uint8_t tensor_arena_fast[EI_TENSOR_ARENA_FAST_SIZE] ALIGN(16);
+#endif
+#endif // EI_TENSOR_ARENA_FAST_SIZE > 0
+
+#if EI_WEIGHT_STAGING_SIZE > 0
+// Statically allocated, in internal RAM like tensor_arena_fast
+#if defined (EI_WEIGHT_STAGING_LOCATION)
+uint8_t weight_staging[2][EI_WEIGHT_STAGING_SIZE] ALIGN(16) DEFINE_SECTION(STRINGIZE_VALUE_OF(EI_WEIGHT_STAGING_LOCATION));
+#else
+uint8_t weight_staging[2][EI_WEIGHT_STAGING_SIZE] ALIGN(16);
+#endif
+#endif // EI_WEIGHT_STAGING_SIZE > 0
 
 template <int SZ, class T> struct TfArray {
   int sz; T elem[SZ];
 };
 
 enum used_operators_e {
-  OP_STRIDED_SLICE, OP_PAD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONCATENATION, OP_ADD, OP_FULLY_CONNECTED, OP_RESHAPE, OP_SOFTMAX,  OP_LAST
+  OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONCATENATION, OP_INVERTED_RESIDUAL, OP_FULLY_CONNECTED, OP_RESHAPE, OP_SOFTMAX,  OP_LAST
 };
 
 struct TensorInfo_t { // subset of TfLiteTensor used for initialization from constant memory
@@ -146,12 +192,16 @@ typedef struct {
   int16_t index;
 } TfLiteEvalTensorWithIndex;
 
-TfLiteContext ctx{};
-static const int MAX_TFL_TENSOR_COUNT = 5;
-static TfLiteTensorWithIndex tflTensors[MAX_TFL_TENSOR_COUNT];
-static const int MAX_TFL_EVAL_COUNT = 5;
-static TfLiteEvalTensorWithIndex tflEvalTensors[MAX_TFL_EVAL_COUNT];
-TfLiteRegistration registrations[OP_LAST];
+static const int MAX_TFL_TENSOR_COUNT = 11;
+static const int MAX_TFL_EVAL_COUNT = 8;
+
+const char* const used_op_names[OP_LAST] = {
+  "CONV_2D", "DEPTHWISE_CONV_2D", "CONCATENATION", "INVERTED_RESIDUAL", "FULLY_CONNECTED", "RESHAPE", "SOFTMAX",
+};
+
+#if EI_CLASSIFIER_PROFILE_OPS
+static const size_t PROFILE_NO_NODE = 52;
+#endif // EI_CLASSIFIER_PROFILE_OPS
 
 namespace g0 {
 const TfArray<4, int> tensor_dimension0 = { 4, { 1,96,96,3 } };
@@ -5333,538 +5383,409 @@ const TfArray<1, float> quant246_scale = { 1, { 0.00013368880900088698, } };
 const TfLiteAffineQuantization quant246 = { (TfLiteFloatArray*)&quant246_scale, (TfLiteIntArray*)&g0::quant240_zero, 0 };
 const TfArray<1, float> quant247_scale = { 1, { 0.12109005451202393, } };
 const TfLiteAffineQuantization quant247 = { (TfLiteFloatArray*)&quant247_scale, (TfLiteIntArray*)&g0::quant216_zero, 0 };
-const TfLiteStridedSliceParams opdata0 = { 15, 13, 0, 0, 0 };
-const TfArray<4, int> inputs0 = { 4, { 0,2,3,4 } };
-const TfArray<1, int> outputs0 = { 1, { 5 } };
-const TfArray<2, int> inputs1 = { 2, { 5,6 } };
-const TfArray<1, int> outputs1 = { 1, { 7 } };
-const TfLiteConvParams opdata2 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs2 = { 3, { 7,8,9 } };
-const TfArray<1, int> outputs2 = { 1, { 10 } };
-const TfLiteStridedSliceParams opdata3 = { 15, 13, 0, 0, 0 };
-const TfArray<4, int> inputs3 = { 4, { 10,11,12,13 } };
-const TfArray<1, int> outputs3 = { 1, { 14 } };
-const TfLiteDepthwiseConvParams opdata4 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs4 = { 3, { 14,15,16 } };
-const TfArray<1, int> outputs4 = { 1, { 17 } };
-const TfLiteStridedSliceParams opdata5 = { 15, 13, 0, 0, 0 };
-const TfArray<4, int> inputs5 = { 4, { 17,18,19,20 } };
-const TfArray<1, int> outputs5 = { 1, { 21 } };
-const TfLiteConvParams opdata6 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs6 = { 3, { 21,22,23 } };
-const TfArray<1, int> outputs6 = { 1, { 24 } };
-const TfLiteConvParams opdata7 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs7 = { 3, { 24,25,26 } };
-const TfArray<1, int> outputs7 = { 1, { 27 } };
-const TfArray<2, int> inputs8 = { 2, { 27,28 } };
-const TfArray<1, int> outputs8 = { 1, { 29 } };
+const TfLiteConvParams opdata0 = { kTfLitePaddingValid, 2,2, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs0 = { 3, { 5,8,9 } };
+const TfArray<1, int> outputs0 = { 1, { 10 } };
+const TfLiteDepthwiseConvParams opdata1 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs1 = { 3, { 14,15,16 } };
+const TfArray<1, int> outputs1 = { 1, { 17 } };
+const TfLiteConvParams opdata2 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs2 = { 3, { 21,22,23 } };
+const TfArray<1, int> outputs2 = { 1, { 24 } };
+const TfLiteConvParams opdata3 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs3 = { 3, { 24,25,26 } };
+const TfArray<1, int> outputs3 = { 1, { 27 } };
+const TfLiteDepthwiseConvParams opdata4 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs4 = { 3, { 27,30,31 } };
+const TfArray<1, int> outputs4 = { 1, { 32 } };
+const TfLiteConvParams opdata5 = { kTfLitePaddingValid, 2,2, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs5 = { 3, { 36,8,9 } };
+const TfArray<1, int> outputs5 = { 1, { 39 } };
+const TfLiteDepthwiseConvParams opdata6 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs6 = { 3, { 39,15,16 } };
+const TfArray<1, int> outputs6 = { 1, { 40 } };
+const TfLiteConvParams opdata7 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs7 = { 3, { 44,22,23 } };
+const TfArray<1, int> outputs7 = { 1, { 45 } };
+const TfLiteConvParams opdata8 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs8 = { 3, { 45,25,26 } };
+const TfArray<1, int> outputs8 = { 1, { 46 } };
 const TfLiteDepthwiseConvParams opdata9 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs9 = { 3, { 29,30,31 } };
-const TfArray<1, int> outputs9 = { 1, { 32 } };
-const TfLiteStridedSliceParams opdata10 = { 13, 13, 0, 0, 0 };
-const TfArray<4, int> inputs10 = { 4, { 0,33,34,35 } };
-const TfArray<1, int> outputs10 = { 1, { 36 } };
-const TfArray<2, int> inputs11 = { 2, { 36,37 } };
-const TfArray<1, int> outputs11 = { 1, { 38 } };
-const TfLiteConvParams opdata12 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs12 = { 3, { 38,8,9 } };
-const TfArray<1, int> outputs12 = { 1, { 39 } };
-const TfLiteDepthwiseConvParams opdata13 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs13 = { 3, { 39,15,16 } };
-const TfArray<1, int> outputs13 = { 1, { 40 } };
-const TfLiteStridedSliceParams opdata14 = { 13, 13, 0, 0, 0 };
-const TfArray<4, int> inputs14 = { 4, { 40,41,42,43 } };
-const TfArray<1, int> outputs14 = { 1, { 44 } };
-const TfLiteConvParams opdata15 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs15 = { 3, { 44,22,23 } };
-const TfArray<1, int> outputs15 = { 1, { 45 } };
-const TfLiteConvParams opdata16 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs16 = { 3, { 45,25,26 } };
-const TfArray<1, int> outputs16 = { 1, { 46 } };
-const TfArray<2, int> inputs17 = { 2, { 46,47 } };
-const TfArray<1, int> outputs17 = { 1, { 48 } };
-const TfLiteDepthwiseConvParams opdata18 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs18 = { 3, { 48,30,31 } };
-const TfArray<1, int> outputs18 = { 1, { 49 } };
-const TfLiteStridedSliceParams opdata19 = { 13, 13, 0, 0, 0 };
-const TfArray<4, int> inputs19 = { 4, { 0,50,51,52 } };
-const TfArray<1, int> outputs19 = { 1, { 53 } };
-const TfArray<2, int> inputs20 = { 2, { 53,54 } };
-const TfArray<1, int> outputs20 = { 1, { 55 } };
-const TfLiteConvParams opdata21 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs21 = { 3, { 55,8,9 } };
-const TfArray<1, int> outputs21 = { 1, { 56 } };
-const TfLiteDepthwiseConvParams opdata22 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs22 = { 3, { 56,15,16 } };
-const TfArray<1, int> outputs22 = { 1, { 57 } };
-const TfLiteStridedSliceParams opdata23 = { 13, 13, 0, 0, 0 };
-const TfArray<4, int> inputs23 = { 4, { 57,58,59,60 } };
-const TfArray<1, int> outputs23 = { 1, { 61 } };
-const TfLiteConvParams opdata24 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs24 = { 3, { 61,22,23 } };
-const TfArray<1, int> outputs24 = { 1, { 62 } };
-const TfLiteConvParams opdata25 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs25 = { 3, { 62,25,26 } };
-const TfArray<1, int> outputs25 = { 1, { 63 } };
-const TfArray<2, int> inputs26 = { 2, { 63,64 } };
-const TfArray<1, int> outputs26 = { 1, { 65 } };
-const TfLiteDepthwiseConvParams opdata27 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs27 = { 3, { 65,30,31 } };
-const TfArray<1, int> outputs27 = { 1, { 66 } };
-const TfLiteStridedSliceParams opdata28 = { 13, 15, 0, 0, 0 };
-const TfArray<4, int> inputs28 = { 4, { 0,67,68,69 } };
-const TfArray<1, int> outputs28 = { 1, { 70 } };
-const TfLiteConvParams opdata29 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs29 = { 3, { 70,8,9 } };
-const TfArray<1, int> outputs29 = { 1, { 71 } };
-const TfArray<2, int> inputs30 = { 2, { 71,72 } };
-const TfArray<1, int> outputs30 = { 1, { 73 } };
-const TfLiteDepthwiseConvParams opdata31 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs31 = { 3, { 73,15,16 } };
-const TfArray<1, int> outputs31 = { 1, { 74 } };
-const TfLiteStridedSliceParams opdata32 = { 13, 13, 0, 0, 0 };
-const TfArray<4, int> inputs32 = { 4, { 74,75,76,77 } };
-const TfArray<1, int> outputs32 = { 1, { 78 } };
-const TfLiteConvParams opdata33 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs33 = { 3, { 78,22,23 } };
-const TfArray<1, int> outputs33 = { 1, { 79 } };
+const TfArray<3, int> inputs9 = { 3, { 46,30,31 } };
+const TfArray<1, int> outputs9 = { 1, { 49 } };
+const TfLiteConvParams opdata10 = { kTfLitePaddingValid, 2,2, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs10 = { 3, { 53,8,9 } };
+const TfArray<1, int> outputs10 = { 1, { 56 } };
+const TfLiteDepthwiseConvParams opdata11 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs11 = { 3, { 56,15,16 } };
+const TfArray<1, int> outputs11 = { 1, { 57 } };
+const TfLiteConvParams opdata12 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs12 = { 3, { 61,22,23 } };
+const TfArray<1, int> outputs12 = { 1, { 62 } };
+const TfLiteConvParams opdata13 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs13 = { 3, { 62,25,26 } };
+const TfArray<1, int> outputs13 = { 1, { 63 } };
+const TfLiteDepthwiseConvParams opdata14 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs14 = { 3, { 63,30,31 } };
+const TfArray<1, int> outputs14 = { 1, { 66 } };
+const TfLiteConvParams opdata15 = { kTfLitePaddingSame, 2,2, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs15 = { 3, { 70,8,9 } };
+const TfArray<1, int> outputs15 = { 1, { 71 } };
+const TfLiteDepthwiseConvParams opdata16 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs16 = { 3, { 71,15,16 } };
+const TfArray<1, int> outputs16 = { 1, { 74 } };
+const TfLiteConvParams opdata17 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs17 = { 3, { 78,22,23 } };
+const TfArray<1, int> outputs17 = { 1, { 79 } };
+const TfLiteConvParams opdata18 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs18 = { 3, { 79,25,26 } };
+const TfArray<1, int> outputs18 = { 1, { 80 } };
+const TfLiteDepthwiseConvParams opdata19 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs19 = { 3, { 80,30,31 } };
+const TfArray<1, int> outputs19 = { 1, { 83 } };
+const TfLiteConcatenationParams opdata20 = { 1, kTfLiteActNone };
+const TfArray<4, int> inputs20 = { 4, { 32,49,66,83 } };
+const TfArray<1, int> outputs20 = { 1, { 84 } };
+const TfLiteConvParams opdata21 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs21 = { 3, { 84,85,86 } };
+const TfArray<1, int> outputs21 = { 1, { 87 } };
+const TfLiteInvertedResidualParams opdata22 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs22 = { 7, { 87,88,89,91,92,94,95 } };
+const TfArray<3, int> intermediates22 = { 3, { 90,93,96 } };
+const TfArray<1, int> outputs22 = { 1, { 97 } };
+const TfLiteConvParams opdata23 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs23 = { 3, { 97,98,99 } };
+const TfArray<1, int> outputs23 = { 1, { 100 } };
+const TfLiteDepthwiseConvParams opdata24 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs24 = { 3, { 100,103,104 } };
+const TfArray<1, int> outputs24 = { 1, { 105 } };
+const TfLiteConvParams opdata25 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs25 = { 3, { 105,106,107 } };
+const TfArray<1, int> outputs25 = { 1, { 108 } };
+const TfLiteInvertedResidualParams opdata26 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs26 = { 7, { 108,109,110,112,113,115,116 } };
+const TfArray<3, int> intermediates26 = { 3, { 111,114,117 } };
+const TfArray<1, int> outputs26 = { 1, { 118 } };
+const TfLiteInvertedResidualParams opdata27 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs27 = { 7, { 118,119,120,122,123,125,126 } };
+const TfArray<3, int> intermediates27 = { 3, { 121,124,127 } };
+const TfArray<1, int> outputs27 = { 1, { 128 } };
+const TfLiteConvParams opdata28 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs28 = { 3, { 128,129,130 } };
+const TfArray<1, int> outputs28 = { 1, { 131 } };
+const TfLiteDepthwiseConvParams opdata29 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs29 = { 3, { 131,133,134 } };
+const TfArray<1, int> outputs29 = { 1, { 135 } };
+const TfLiteConvParams opdata30 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs30 = { 3, { 135,136,137 } };
+const TfArray<1, int> outputs30 = { 1, { 138 } };
+const TfLiteInvertedResidualParams opdata31 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 3 };
+const TfArray<7, int> inputs31 = { 7, { 138,139,140,142,143,145,146 } };
+const TfArray<3, int> intermediates31 = { 3, { 141,144,147 } };
+const TfArray<1, int> outputs31 = { 1, { 148 } };
+const TfLiteInvertedResidualParams opdata32 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 3 };
+const TfArray<7, int> inputs32 = { 7, { 148,149,150,152,153,155,156 } };
+const TfArray<3, int> intermediates32 = { 3, { 151,154,157 } };
+const TfArray<1, int> outputs32 = { 1, { 158 } };
+const TfLiteInvertedResidualParams opdata33 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 3 };
+const TfArray<7, int> inputs33 = { 7, { 158,159,160,162,163,165,166 } };
+const TfArray<3, int> intermediates33 = { 3, { 161,164,167 } };
+const TfArray<1, int> outputs33 = { 1, { 168 } };
 const TfLiteConvParams opdata34 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs34 = { 3, { 79,25,26 } };
-const TfArray<1, int> outputs34 = { 1, { 80 } };
-const TfArray<2, int> inputs35 = { 2, { 80,81 } };
-const TfArray<1, int> outputs35 = { 1, { 82 } };
-const TfLiteDepthwiseConvParams opdata36 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs36 = { 3, { 82,30,31 } };
-const TfArray<1, int> outputs36 = { 1, { 83 } };
-const TfLiteConcatenationParams opdata37 = { 1, kTfLiteActNone };
-const TfArray<4, int> inputs37 = { 4, { 32,49,66,83 } };
-const TfArray<1, int> outputs37 = { 1, { 84 } };
-const TfLiteConvParams opdata38 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs38 = { 3, { 84,85,86 } };
-const TfArray<1, int> outputs38 = { 1, { 87 } };
+const TfArray<3, int> inputs34 = { 3, { 168,169,170 } };
+const TfArray<1, int> outputs34 = { 1, { 171 } };
+const TfLiteDepthwiseConvParams opdata35 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs35 = { 3, { 171,172,173 } };
+const TfArray<1, int> outputs35 = { 1, { 174 } };
+const TfLiteConvParams opdata36 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
+const TfArray<3, int> inputs36 = { 3, { 174,175,176 } };
+const TfArray<1, int> outputs36 = { 1, { 177 } };
+const TfLiteInvertedResidualParams opdata37 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs37 = { 7, { 177,178,179,181,182,184,185 } };
+const TfArray<3, int> intermediates37 = { 3, { 180,183,186 } };
+const TfArray<1, int> outputs37 = { 1, { 187 } };
+const TfLiteInvertedResidualParams opdata38 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs38 = { 7, { 187,188,189,191,192,194,195 } };
+const TfArray<3, int> intermediates38 = { 3, { 190,193,196 } };
+const TfArray<1, int> outputs38 = { 1, { 197 } };
 const TfLiteConvParams opdata39 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs39 = { 3, { 87,88,89 } };
-const TfArray<1, int> outputs39 = { 1, { 90 } };
-const TfLiteDepthwiseConvParams opdata40 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs40 = { 3, { 90,91,92 } };
-const TfArray<1, int> outputs40 = { 1, { 93 } };
+const TfArray<3, int> inputs39 = { 3, { 197,198,199 } };
+const TfArray<1, int> outputs39 = { 1, { 200 } };
+const TfLiteDepthwiseConvParams opdata40 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs40 = { 3, { 200,202,203 } };
+const TfArray<1, int> outputs40 = { 1, { 204 } };
 const TfLiteConvParams opdata41 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs41 = { 3, { 93,94,95 } };
-const TfArray<1, int> outputs41 = { 1, { 96 } };
-const TfLiteAddParams opdata42 = { kTfLiteActNone };
-const TfArray<2, int> inputs42 = { 2, { 87,96 } };
-const TfArray<1, int> outputs42 = { 1, { 97 } };
-const TfLiteConvParams opdata43 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs43 = { 3, { 97,98,99 } };
-const TfArray<1, int> outputs43 = { 1, { 100 } };
-const TfArray<2, int> inputs44 = { 2, { 100,101 } };
-const TfArray<1, int> outputs44 = { 1, { 102 } };
-const TfLiteDepthwiseConvParams opdata45 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs45 = { 3, { 102,103,104 } };
-const TfArray<1, int> outputs45 = { 1, { 105 } };
+const TfArray<3, int> inputs41 = { 3, { 204,205,206 } };
+const TfArray<1, int> outputs41 = { 1, { 207 } };
+const TfLiteInvertedResidualParams opdata42 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs42 = { 7, { 207,208,209,211,212,214,215 } };
+const TfArray<3, int> intermediates42 = { 3, { 210,213,216 } };
+const TfArray<1, int> outputs42 = { 1, { 217 } };
+const TfLiteInvertedResidualParams opdata43 = { kTfLiteActRelu6, kTfLiteActRelu6, kTfLiteActNone, kTfLiteActNone, 2 };
+const TfArray<7, int> inputs43 = { 7, { 217,218,219,221,222,224,225 } };
+const TfArray<3, int> intermediates43 = { 3, { 220,223,226 } };
+const TfArray<1, int> outputs43 = { 1, { 227 } };
+const TfLiteConvParams opdata44 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs44 = { 3, { 227,228,229 } };
+const TfArray<1, int> outputs44 = { 1, { 230 } };
+const TfLiteDepthwiseConvParams opdata45 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs45 = { 3, { 230,231,232 } };
+const TfArray<1, int> outputs45 = { 1, { 233 } };
 const TfLiteConvParams opdata46 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs46 = { 3, { 105,106,107 } };
-const TfArray<1, int> outputs46 = { 1, { 108 } };
-const TfLiteConvParams opdata47 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs47 = { 3, { 108,109,110 } };
-const TfArray<1, int> outputs47 = { 1, { 111 } };
-const TfLiteDepthwiseConvParams opdata48 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs48 = { 3, { 111,112,113 } };
-const TfArray<1, int> outputs48 = { 1, { 114 } };
-const TfLiteConvParams opdata49 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs49 = { 3, { 114,115,116 } };
-const TfArray<1, int> outputs49 = { 1, { 117 } };
-const TfLiteAddParams opdata50 = { kTfLiteActNone };
-const TfArray<2, int> inputs50 = { 2, { 108,117 } };
-const TfArray<1, int> outputs50 = { 1, { 118 } };
-const TfLiteConvParams opdata51 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs51 = { 3, { 118,119,120 } };
-const TfArray<1, int> outputs51 = { 1, { 121 } };
-const TfLiteDepthwiseConvParams opdata52 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs52 = { 3, { 121,122,123 } };
-const TfArray<1, int> outputs52 = { 1, { 124 } };
-const TfLiteConvParams opdata53 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs53 = { 3, { 124,125,126 } };
-const TfArray<1, int> outputs53 = { 1, { 127 } };
-const TfLiteAddParams opdata54 = { kTfLiteActNone };
-const TfArray<2, int> inputs54 = { 2, { 118,127 } };
-const TfArray<1, int> outputs54 = { 1, { 128 } };
-const TfLiteConvParams opdata55 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs55 = { 3, { 128,129,130 } };
-const TfArray<1, int> outputs55 = { 1, { 131 } };
-const TfArray<2, int> inputs56 = { 2, { 131,101 } };
-const TfArray<1, int> outputs56 = { 1, { 132 } };
-const TfLiteDepthwiseConvParams opdata57 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs57 = { 3, { 132,133,134 } };
-const TfArray<1, int> outputs57 = { 1, { 135 } };
-const TfLiteConvParams opdata58 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs58 = { 3, { 135,136,137 } };
-const TfArray<1, int> outputs58 = { 1, { 138 } };
-const TfLiteConvParams opdata59 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs59 = { 3, { 138,139,140 } };
-const TfArray<1, int> outputs59 = { 1, { 141 } };
-const TfLiteDepthwiseConvParams opdata60 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs60 = { 3, { 141,142,143 } };
-const TfArray<1, int> outputs60 = { 1, { 144 } };
-const TfLiteConvParams opdata61 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs61 = { 3, { 144,145,146 } };
-const TfArray<1, int> outputs61 = { 1, { 147 } };
-const TfLiteAddParams opdata62 = { kTfLiteActNone };
-const TfArray<2, int> inputs62 = { 2, { 138,147 } };
-const TfArray<1, int> outputs62 = { 1, { 148 } };
-const TfLiteConvParams opdata63 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs63 = { 3, { 148,149,150 } };
-const TfArray<1, int> outputs63 = { 1, { 151 } };
-const TfLiteDepthwiseConvParams opdata64 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs64 = { 3, { 151,152,153 } };
-const TfArray<1, int> outputs64 = { 1, { 154 } };
-const TfLiteConvParams opdata65 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs65 = { 3, { 154,155,156 } };
-const TfArray<1, int> outputs65 = { 1, { 157 } };
-const TfLiteAddParams opdata66 = { kTfLiteActNone };
-const TfArray<2, int> inputs66 = { 2, { 148,157 } };
-const TfArray<1, int> outputs66 = { 1, { 158 } };
-const TfLiteConvParams opdata67 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs67 = { 3, { 158,159,160 } };
-const TfArray<1, int> outputs67 = { 1, { 161 } };
-const TfLiteDepthwiseConvParams opdata68 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs68 = { 3, { 161,162,163 } };
-const TfArray<1, int> outputs68 = { 1, { 164 } };
-const TfLiteConvParams opdata69 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs69 = { 3, { 164,165,166 } };
-const TfArray<1, int> outputs69 = { 1, { 167 } };
-const TfLiteAddParams opdata70 = { kTfLiteActNone };
-const TfArray<2, int> inputs70 = { 2, { 158,167 } };
-const TfArray<1, int> outputs70 = { 1, { 168 } };
-const TfLiteConvParams opdata71 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs71 = { 3, { 168,169,170 } };
-const TfArray<1, int> outputs71 = { 1, { 171 } };
-const TfLiteDepthwiseConvParams opdata72 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs72 = { 3, { 171,172,173 } };
-const TfArray<1, int> outputs72 = { 1, { 174 } };
-const TfLiteConvParams opdata73 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs73 = { 3, { 174,175,176 } };
-const TfArray<1, int> outputs73 = { 1, { 177 } };
-const TfLiteConvParams opdata74 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs74 = { 3, { 177,178,179 } };
-const TfArray<1, int> outputs74 = { 1, { 180 } };
-const TfLiteDepthwiseConvParams opdata75 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs75 = { 3, { 180,181,182 } };
-const TfArray<1, int> outputs75 = { 1, { 183 } };
-const TfLiteConvParams opdata76 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs76 = { 3, { 183,184,185 } };
-const TfArray<1, int> outputs76 = { 1, { 186 } };
-const TfLiteAddParams opdata77 = { kTfLiteActNone };
-const TfArray<2, int> inputs77 = { 2, { 177,186 } };
-const TfArray<1, int> outputs77 = { 1, { 187 } };
-const TfLiteConvParams opdata78 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs78 = { 3, { 187,188,189 } };
-const TfArray<1, int> outputs78 = { 1, { 190 } };
-const TfLiteDepthwiseConvParams opdata79 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs79 = { 3, { 190,191,192 } };
-const TfArray<1, int> outputs79 = { 1, { 193 } };
-const TfLiteConvParams opdata80 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs80 = { 3, { 193,194,195 } };
-const TfArray<1, int> outputs80 = { 1, { 196 } };
-const TfLiteAddParams opdata81 = { kTfLiteActNone };
-const TfArray<2, int> inputs81 = { 2, { 187,196 } };
-const TfArray<1, int> outputs81 = { 1, { 197 } };
-const TfLiteConvParams opdata82 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs82 = { 3, { 197,198,199 } };
-const TfArray<1, int> outputs82 = { 1, { 200 } };
-const TfArray<2, int> inputs83 = { 2, { 200,101 } };
-const TfArray<1, int> outputs83 = { 1, { 201 } };
-const TfLiteDepthwiseConvParams opdata84 = { kTfLitePaddingValid, 2,2, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs84 = { 3, { 201,202,203 } };
-const TfArray<1, int> outputs84 = { 1, { 204 } };
-const TfLiteConvParams opdata85 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs85 = { 3, { 204,205,206 } };
-const TfArray<1, int> outputs85 = { 1, { 207 } };
-const TfLiteConvParams opdata86 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs86 = { 3, { 207,208,209 } };
-const TfArray<1, int> outputs86 = { 1, { 210 } };
-const TfLiteDepthwiseConvParams opdata87 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs87 = { 3, { 210,211,212 } };
-const TfArray<1, int> outputs87 = { 1, { 213 } };
-const TfLiteConvParams opdata88 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs88 = { 3, { 213,214,215 } };
-const TfArray<1, int> outputs88 = { 1, { 216 } };
-const TfLiteAddParams opdata89 = { kTfLiteActNone };
-const TfArray<2, int> inputs89 = { 2, { 207,216 } };
-const TfArray<1, int> outputs89 = { 1, { 217 } };
-const TfLiteConvParams opdata90 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs90 = { 3, { 217,218,219 } };
-const TfArray<1, int> outputs90 = { 1, { 220 } };
-const TfLiteDepthwiseConvParams opdata91 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs91 = { 3, { 220,221,222 } };
-const TfArray<1, int> outputs91 = { 1, { 223 } };
-const TfLiteConvParams opdata92 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs92 = { 3, { 223,224,225 } };
-const TfArray<1, int> outputs92 = { 1, { 226 } };
-const TfLiteAddParams opdata93 = { kTfLiteActNone };
-const TfArray<2, int> inputs93 = { 2, { 217,226 } };
-const TfArray<1, int> outputs93 = { 1, { 227 } };
-const TfLiteConvParams opdata94 = { kTfLitePaddingSame, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs94 = { 3, { 227,228,229 } };
-const TfArray<1, int> outputs94 = { 1, { 230 } };
-const TfLiteDepthwiseConvParams opdata95 = { kTfLitePaddingSame, 1,1, 1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs95 = { 3, { 230,231,232 } };
-const TfArray<1, int> outputs95 = { 1, { 233 } };
-const TfLiteConvParams opdata96 = { kTfLitePaddingSame, 1,1, kTfLiteActNone, 1,1 };
-const TfArray<3, int> inputs96 = { 3, { 233,234,235 } };
-const TfArray<1, int> outputs96 = { 1, { 236 } };
-const TfLiteConvParams opdata97 = { kTfLitePaddingValid, 1,1, kTfLiteActRelu6, 1,1 };
-const TfArray<3, int> inputs97 = { 3, { 236,237,238 } };
-const TfArray<1, int> outputs97 = { 1, { 239 } };
-const TfLiteFullyConnectedParams opdata98 = { kTfLiteActRelu, kTfLiteFullyConnectedWeightsFormatDefault, false, false };
-const TfArray<3, int> inputs98 = { 3, { 239,240,241 } };
-const TfArray<1, int> outputs98 = { 1, { 242 } };
-const TfLiteReshapeParams opdata99 = { { 0, 0, 0, 0, 0, 0, 0, 0, }, 0 };
-const TfArray<2, int> inputs99 = { 2, { 242,243 } };
-const TfArray<1, int> outputs99 = { 1, { 244 } };
-const TfLiteFullyConnectedParams opdata100 = { kTfLiteActNone, kTfLiteFullyConnectedWeightsFormatDefault, false, false };
-const TfArray<3, int> inputs100 = { 3, { 244,245,246 } };
-const TfArray<1, int> outputs100 = { 1, { 247 } };
-const TfLiteSoftmaxParams opdata101 = { 1 };
-const TfArray<1, int> inputs101 = { 1, { 247 } };
-const TfArray<1, int> outputs101 = { 1, { 1 } };
+const TfArray<3, int> inputs46 = { 3, { 233,234,235 } };
+const TfArray<1, int> outputs46 = { 1, { 236 } };
+const TfLiteConvParams opdata47 = { kTfLitePaddingValid, 1,1, kTfLiteActRelu6, 1,1 };
+const TfArray<3, int> inputs47 = { 3, { 236,237,238 } };
+const TfArray<1, int> outputs47 = { 1, { 239 } };
+const TfLiteFullyConnectedParams opdata48 = { kTfLiteActRelu, kTfLiteFullyConnectedWeightsFormatDefault, false, false };
+const TfArray<3, int> inputs48 = { 3, { 239,240,241 } };
+const TfArray<1, int> outputs48 = { 1, { 242 } };
+const TfLiteReshapeParams opdata49 = { { 0, 0, 0, 0, 0, 0, 0, 0, }, 0 };
+const TfArray<2, int> inputs49 = { 2, { 242,243 } };
+const TfArray<1, int> outputs49 = { 1, { 244 } };
+const TfLiteFullyConnectedParams opdata50 = { kTfLiteActNone, kTfLiteFullyConnectedWeightsFormatDefault, false, false };
+const TfArray<3, int> inputs50 = { 3, { 244,245,246 } };
+const TfArray<1, int> outputs50 = { 1, { 247 } };
+const TfLiteSoftmaxParams opdata51 = { 1 };
+const TfArray<1, int> inputs51 = { 1, { 247 } };
+const TfArray<1, int> outputs51 = { 1, { 1 } };
 };
 
 TensorInfo_t tensorData[] = {
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 60528), (TfLiteIntArray*)&g0::tensor_dimension0, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 29952), (TfLiteIntArray*)&g0::tensor_dimension0, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension1, 9, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant1))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data2, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data3, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data4, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension5, 8352, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 29952), (TfLiteIntArray*)&g0::tensor_dimension5, 8352, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data6, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11520), (TfLiteIntArray*)&g0::tensor_dimension7, 8640, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension7, 8640, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data8, (TfLiteIntArray*)&g0::tensor_dimension8, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant8))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data9, (TfLiteIntArray*)&g0::tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant9))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension10, 11520, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data11, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data12, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data13, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11520), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data15, (TfLiteIntArray*)&g0::tensor_dimension15, 144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant15))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data16, (TfLiteIntArray*)&g0::tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant16))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11520), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data18, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data19, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data20, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10752), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11520), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data22, (TfLiteIntArray*)&g0::tensor_dimension22, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant22))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data23, (TfLiteIntArray*)&g0::tensor_dimension23, 32, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant23))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 57600), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data25, (TfLiteIntArray*)&g0::tensor_dimension25, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant25))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data26, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant26))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30576), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data28, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension29, 30576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data30, (TfLiteIntArray*)&g0::tensor_dimension30, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant30))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data31, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant31))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 102000), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 57600), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data33, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data34, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data35, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9216), (TfLiteIntArray*)&g0::tensor_dimension36, 8928, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36288), (TfLiteIntArray*)&g0::tensor_dimension36, 8928, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data37, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension38, 9216, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data41, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data42, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data43, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30576), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13056), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 64512), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data47, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension29, 30576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 95088), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 64512), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data50, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data51, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data52, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9216), (TfLiteIntArray*)&g0::tensor_dimension36, 8928, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 43200), (TfLiteIntArray*)&g0::tensor_dimension36, 8928, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data54, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension38, 9216, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension39, 12288, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data58, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data59, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data60, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12288), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30576), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13056), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 71424), (TfLiteIntArray*)&g0::tensor_dimension24, 4992, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension27, 29952, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data64, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension29, 30576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 88176), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 71424), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data67, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data68, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data69, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9984), (TfLiteIntArray*)&g0::tensor_dimension70, 7488, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 50112), (TfLiteIntArray*)&g0::tensor_dimension70, 7488, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant0))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10752), (TfLiteIntArray*)&g0::tensor_dimension21, 9984, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data72, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10752), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension14, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data75, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data76, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data77, (TfLiteIntArray*)&g0::tensor_dimension2, 16, {kTfLiteNoQuantization, nullptr}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10752), (TfLiteIntArray*)&g0::tensor_dimension78, 9216, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension79, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30576), (TfLiteIntArray*)&g0::tensor_dimension80, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 768), (TfLiteIntArray*)&g0::tensor_dimension78, 9216, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension79, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant24))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension80, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data81, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension29, 30576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30576), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension32, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data85, (TfLiteIntArray*)&g0::tensor_dimension85, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant85))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data86, (TfLiteIntArray*)&g0::tensor_dimension23, 32, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant86))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 55296), (TfLiteIntArray*)&g0::tensor_dimension87, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant87))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data88, (TfLiteIntArray*)&g0::tensor_dimension25, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant88))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data89, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant89))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data91, (TfLiteIntArray*)&g0::tensor_dimension30, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant91))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data92, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant92))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data94, (TfLiteIntArray*)&g0::tensor_dimension85, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant94))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data95, (TfLiteIntArray*)&g0::tensor_dimension23, 32, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant95))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension87, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant96))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension87, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant97))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension87, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant96))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension87, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant97))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data98, (TfLiteIntArray*)&g0::tensor_dimension25, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant98))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data99, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant99))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension84, 27648, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data101, (TfLiteIntArray*)&g0::tensor_dimension6, 32, {kTfLiteNoQuantization, nullptr}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension102, 30000, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data103, (TfLiteIntArray*)&g0::tensor_dimension30, 432, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant103))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data104, (TfLiteIntArray*)&g0::tensor_dimension26, 192, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant104))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 30000), (TfLiteIntArray*)&g0::tensor_dimension105, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension105, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data106, (TfLiteIntArray*)&g0::tensor_dimension106, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant106))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data107, (TfLiteIntArray*)&g0::tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant107))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 36912), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant108))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 34560), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant108))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data109, (TfLiteIntArray*)&g0::tensor_dimension109, 1536, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant109))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data110, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant110))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data112, (TfLiteIntArray*)&g0::tensor_dimension112, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant112))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data113, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant113))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data115, (TfLiteIntArray*)&g0::tensor_dimension115, 1536, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant115))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data116, (TfLiteIntArray*)&g0::tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant116))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant117))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant117))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 27648), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant118))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data119, (TfLiteIntArray*)&g0::tensor_dimension109, 1536, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant119))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data120, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant120))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data122, (TfLiteIntArray*)&g0::tensor_dimension112, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant122))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data123, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant123))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data125, (TfLiteIntArray*)&g0::tensor_dimension115, 1536, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant125))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data126, (TfLiteIntArray*)&g0::tensor_dimension9, 64, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant126))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant127))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant128))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant127))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension108, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant128))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data129, (TfLiteIntArray*)&g0::tensor_dimension109, 1536, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant129))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data130, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant130))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 16224), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension111, 13824, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension132, 16224, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data133, (TfLiteIntArray*)&g0::tensor_dimension112, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant133))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data134, (TfLiteIntArray*)&g0::tensor_dimension110, 384, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant134))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 16224), (TfLiteIntArray*)&g0::tensor_dimension135, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension135, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data136, (TfLiteIntArray*)&g0::tensor_dimension136, 2304, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant136))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data137, (TfLiteIntArray*)&g0::tensor_dimension137, 96, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant137))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12960), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant138))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10368), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant138))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data139, (TfLiteIntArray*)&g0::tensor_dimension139, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant139))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data140, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant140))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data142, (TfLiteIntArray*)&g0::tensor_dimension142, 1296, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant142))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data143, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant143))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data145, (TfLiteIntArray*)&g0::tensor_dimension145, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant145))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data146, (TfLiteIntArray*)&g0::tensor_dimension137, 96, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant146))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant147))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant148))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant147))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11232), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant148))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data149, (TfLiteIntArray*)&g0::tensor_dimension139, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant149))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data150, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant150))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data152, (TfLiteIntArray*)&g0::tensor_dimension142, 1296, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant152))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data153, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant153))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data155, (TfLiteIntArray*)&g0::tensor_dimension145, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant155))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data156, (TfLiteIntArray*)&g0::tensor_dimension137, 96, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant156))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant157))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12960), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant158))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant157))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 10368), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant158))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data159, (TfLiteIntArray*)&g0::tensor_dimension139, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant159))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data160, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant160))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data162, (TfLiteIntArray*)&g0::tensor_dimension142, 1296, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant162))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data163, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant163))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data165, (TfLiteIntArray*)&g0::tensor_dimension145, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant165))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data166, (TfLiteIntArray*)&g0::tensor_dimension137, 96, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant166))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant167))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant168))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant167))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension138, 864, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant168))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data169, (TfLiteIntArray*)&g0::tensor_dimension139, 3456, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant169))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data170, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant170))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data172, (TfLiteIntArray*)&g0::tensor_dimension142, 1296, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant172))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data173, (TfLiteIntArray*)&g0::tensor_dimension140, 576, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant173))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 5184), (TfLiteIntArray*)&g0::tensor_dimension141, 5184, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data175, (TfLiteIntArray*)&g0::tensor_dimension175, 4608, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant175))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data176, (TfLiteIntArray*)&g0::tensor_dimension176, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant176))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 18432), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant177))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 13824), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant177))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data178, (TfLiteIntArray*)&g0::tensor_dimension178, 6144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant178))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data179, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant179))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data181, (TfLiteIntArray*)&g0::tensor_dimension181, 1728, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant181))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data182, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant182))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data184, (TfLiteIntArray*)&g0::tensor_dimension184, 6144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant184))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data185, (TfLiteIntArray*)&g0::tensor_dimension176, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant185))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant186))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 17280), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant187))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant186))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 14976), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant187))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data188, (TfLiteIntArray*)&g0::tensor_dimension178, 6144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant188))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data189, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant189))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data191, (TfLiteIntArray*)&g0::tensor_dimension181, 1728, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant191))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data192, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant192))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data194, (TfLiteIntArray*)&g0::tensor_dimension184, 6144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant194))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data195, (TfLiteIntArray*)&g0::tensor_dimension176, 128, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant195))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant196))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant197))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant196))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension177, 1152, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant197))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data198, (TfLiteIntArray*)&g0::tensor_dimension178, 6144, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant198))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data199, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant199))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9408), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension180, 6912, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension201, 9408, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data202, (TfLiteIntArray*)&g0::tensor_dimension181, 1728, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant202))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data203, (TfLiteIntArray*)&g0::tensor_dimension179, 768, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant203))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12864), (TfLiteIntArray*)&g0::tensor_dimension181, 1728, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6912), (TfLiteIntArray*)&g0::tensor_dimension181, 1728, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data205, (TfLiteIntArray*)&g0::tensor_dimension205, 10752, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant205))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data206, (TfLiteIntArray*)&g0::tensor_dimension206, 224, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant206))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 14592), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant207))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6048), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant207))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data208, (TfLiteIntArray*)&g0::tensor_dimension208, 18816, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant208))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data209, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant209))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9072), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data211, (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant211))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data212, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant212))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6048), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 3024), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data214, (TfLiteIntArray*)&g0::tensor_dimension214, 18816, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant214))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data215, (TfLiteIntArray*)&g0::tensor_dimension206, 224, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant215))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant216))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 12096), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant217))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6560), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant217))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data218, (TfLiteIntArray*)&g0::tensor_dimension208, 18816, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant218))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data219, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant219))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9072), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data221, (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant221))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data222, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant222))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6048), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 3024), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data224, (TfLiteIntArray*)&g0::tensor_dimension214, 18816, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant224))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data225, (TfLiteIntArray*)&g0::tensor_dimension206, 224, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant225))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 512), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant226))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant227))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant226))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 3024), (TfLiteIntArray*)&g0::tensor_dimension207, 504, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant227))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data228, (TfLiteIntArray*)&g0::tensor_dimension208, 18816, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant228))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data229, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant229))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 9072), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 0), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data231, (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant231))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data232, (TfLiteIntArray*)&g0::tensor_dimension209, 1344, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant232))}, },
-{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 6048), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
+{ kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 3024), (TfLiteIntArray*)&g0::tensor_dimension210, 3024, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant10))}, },
 { kTfLiteMmapRo, kTfLiteInt8, (int32_t*)g0::tensor_data234, (TfLiteIntArray*)&g0::tensor_dimension234, 37632, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant234))}, },
 { kTfLiteMmapRo, kTfLiteInt32, (int32_t*)g0::tensor_data235, (TfLiteIntArray*)&g0::tensor_dimension235, 448, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant235))}, },
 { kTfLiteArenaRw, kTfLiteInt8, (int32_t*)(tensor_arena + 11520), (TfLiteIntArray*)&g0::tensor_dimension236, 1008, {kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&g0::quant236))}, },
@@ -5882,157 +5803,107 @@ TensorInfo_t tensorData[] = {
 };
 
 #ifndef TF_LITE_STATIC_MEMORY
-TfLiteNode tflNodes[102] = {
-{ (TfLiteIntArray*)&g0::inputs0, (TfLiteIntArray*)&g0::outputs0, (TfLiteIntArray*)&g0::inputs0, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata0)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs2, (TfLiteIntArray*)&g0::outputs2, (TfLiteIntArray*)&g0::inputs2, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata2)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs3, (TfLiteIntArray*)&g0::outputs3, (TfLiteIntArray*)&g0::inputs3, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata3)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs4, (TfLiteIntArray*)&g0::outputs4, (TfLiteIntArray*)&g0::inputs4, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata4)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs5, (TfLiteIntArray*)&g0::outputs5, (TfLiteIntArray*)&g0::inputs5, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata5)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs6, (TfLiteIntArray*)&g0::outputs6, (TfLiteIntArray*)&g0::inputs6, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata6)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs7, (TfLiteIntArray*)&g0::outputs7, (TfLiteIntArray*)&g0::inputs7, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata7)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs8, (TfLiteIntArray*)&g0::outputs8, (TfLiteIntArray*)&g0::inputs8, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs9, (TfLiteIntArray*)&g0::outputs9, (TfLiteIntArray*)&g0::inputs9, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata9)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs10, (TfLiteIntArray*)&g0::outputs10, (TfLiteIntArray*)&g0::inputs10, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata10)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs12, (TfLiteIntArray*)&g0::outputs12, (TfLiteIntArray*)&g0::inputs12, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata12)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs13, (TfLiteIntArray*)&g0::outputs13, (TfLiteIntArray*)&g0::inputs13, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata13)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs14, (TfLiteIntArray*)&g0::outputs14, (TfLiteIntArray*)&g0::inputs14, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata14)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs15, (TfLiteIntArray*)&g0::outputs15, (TfLiteIntArray*)&g0::inputs15, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata15)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs16, (TfLiteIntArray*)&g0::outputs16, (TfLiteIntArray*)&g0::inputs16, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata16)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs17, (TfLiteIntArray*)&g0::outputs17, (TfLiteIntArray*)&g0::inputs17, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs18, (TfLiteIntArray*)&g0::outputs18, (TfLiteIntArray*)&g0::inputs18, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata18)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs19, (TfLiteIntArray*)&g0::outputs19, (TfLiteIntArray*)&g0::inputs19, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata19)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs20, (TfLiteIntArray*)&g0::outputs20, (TfLiteIntArray*)&g0::inputs20, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs21, (TfLiteIntArray*)&g0::outputs21, (TfLiteIntArray*)&g0::inputs21, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata21)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs22, (TfLiteIntArray*)&g0::outputs22, (TfLiteIntArray*)&g0::inputs22, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata22)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs23, (TfLiteIntArray*)&g0::outputs23, (TfLiteIntArray*)&g0::inputs23, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata23)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs24, (TfLiteIntArray*)&g0::outputs24, (TfLiteIntArray*)&g0::inputs24, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata24)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs25, (TfLiteIntArray*)&g0::outputs25, (TfLiteIntArray*)&g0::inputs25, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata25)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs26, (TfLiteIntArray*)&g0::outputs26, (TfLiteIntArray*)&g0::inputs26, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs27, (TfLiteIntArray*)&g0::outputs27, (TfLiteIntArray*)&g0::inputs27, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata27)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs28, (TfLiteIntArray*)&g0::outputs28, (TfLiteIntArray*)&g0::inputs28, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata28)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs29, (TfLiteIntArray*)&g0::outputs29, (TfLiteIntArray*)&g0::inputs29, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata29)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs30, (TfLiteIntArray*)&g0::outputs30, (TfLiteIntArray*)&g0::inputs30, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs31, (TfLiteIntArray*)&g0::outputs31, (TfLiteIntArray*)&g0::inputs31, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata31)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs32, (TfLiteIntArray*)&g0::outputs32, (TfLiteIntArray*)&g0::inputs32, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata32)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs33, (TfLiteIntArray*)&g0::outputs33, (TfLiteIntArray*)&g0::inputs33, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata33)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs34, (TfLiteIntArray*)&g0::outputs34, (TfLiteIntArray*)&g0::inputs34, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata34)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs35, (TfLiteIntArray*)&g0::outputs35, (TfLiteIntArray*)&g0::inputs35, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs36, (TfLiteIntArray*)&g0::outputs36, (TfLiteIntArray*)&g0::inputs36, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata36)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs37, (TfLiteIntArray*)&g0::outputs37, (TfLiteIntArray*)&g0::inputs37, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata37)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs38, (TfLiteIntArray*)&g0::outputs38, (TfLiteIntArray*)&g0::inputs38, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata38)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs39, (TfLiteIntArray*)&g0::outputs39, (TfLiteIntArray*)&g0::inputs39, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata39)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs40, (TfLiteIntArray*)&g0::outputs40, (TfLiteIntArray*)&g0::inputs40, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata40)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs41, (TfLiteIntArray*)&g0::outputs41, (TfLiteIntArray*)&g0::inputs41, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata41)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs42, (TfLiteIntArray*)&g0::outputs42, (TfLiteIntArray*)&g0::inputs42, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata42)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs43, (TfLiteIntArray*)&g0::outputs43, (TfLiteIntArray*)&g0::inputs43, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata43)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs44, (TfLiteIntArray*)&g0::outputs44, (TfLiteIntArray*)&g0::inputs44, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs45, (TfLiteIntArray*)&g0::outputs45, (TfLiteIntArray*)&g0::inputs45, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata45)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs46, (TfLiteIntArray*)&g0::outputs46, (TfLiteIntArray*)&g0::inputs46, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata46)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs47, (TfLiteIntArray*)&g0::outputs47, (TfLiteIntArray*)&g0::inputs47, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata47)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs48, (TfLiteIntArray*)&g0::outputs48, (TfLiteIntArray*)&g0::inputs48, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata48)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs49, (TfLiteIntArray*)&g0::outputs49, (TfLiteIntArray*)&g0::inputs49, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata49)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs50, (TfLiteIntArray*)&g0::outputs50, (TfLiteIntArray*)&g0::inputs50, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata50)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs51, (TfLiteIntArray*)&g0::outputs51, (TfLiteIntArray*)&g0::inputs51, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata51)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs52, (TfLiteIntArray*)&g0::outputs52, (TfLiteIntArray*)&g0::inputs52, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata52)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs53, (TfLiteIntArray*)&g0::outputs53, (TfLiteIntArray*)&g0::inputs53, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata53)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs54, (TfLiteIntArray*)&g0::outputs54, (TfLiteIntArray*)&g0::inputs54, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata54)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs55, (TfLiteIntArray*)&g0::outputs55, (TfLiteIntArray*)&g0::inputs55, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata55)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs56, (TfLiteIntArray*)&g0::outputs56, (TfLiteIntArray*)&g0::inputs56, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs57, (TfLiteIntArray*)&g0::outputs57, (TfLiteIntArray*)&g0::inputs57, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata57)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs58, (TfLiteIntArray*)&g0::outputs58, (TfLiteIntArray*)&g0::inputs58, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata58)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs59, (TfLiteIntArray*)&g0::outputs59, (TfLiteIntArray*)&g0::inputs59, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata59)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs60, (TfLiteIntArray*)&g0::outputs60, (TfLiteIntArray*)&g0::inputs60, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata60)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs61, (TfLiteIntArray*)&g0::outputs61, (TfLiteIntArray*)&g0::inputs61, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata61)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs62, (TfLiteIntArray*)&g0::outputs62, (TfLiteIntArray*)&g0::inputs62, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata62)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs63, (TfLiteIntArray*)&g0::outputs63, (TfLiteIntArray*)&g0::inputs63, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata63)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs64, (TfLiteIntArray*)&g0::outputs64, (TfLiteIntArray*)&g0::inputs64, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata64)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs65, (TfLiteIntArray*)&g0::outputs65, (TfLiteIntArray*)&g0::inputs65, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata65)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs66, (TfLiteIntArray*)&g0::outputs66, (TfLiteIntArray*)&g0::inputs66, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata66)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs67, (TfLiteIntArray*)&g0::outputs67, (TfLiteIntArray*)&g0::inputs67, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata67)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs68, (TfLiteIntArray*)&g0::outputs68, (TfLiteIntArray*)&g0::inputs68, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata68)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs69, (TfLiteIntArray*)&g0::outputs69, (TfLiteIntArray*)&g0::inputs69, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata69)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs70, (TfLiteIntArray*)&g0::outputs70, (TfLiteIntArray*)&g0::inputs70, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata70)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs71, (TfLiteIntArray*)&g0::outputs71, (TfLiteIntArray*)&g0::inputs71, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata71)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs72, (TfLiteIntArray*)&g0::outputs72, (TfLiteIntArray*)&g0::inputs72, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata72)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs73, (TfLiteIntArray*)&g0::outputs73, (TfLiteIntArray*)&g0::inputs73, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata73)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs74, (TfLiteIntArray*)&g0::outputs74, (TfLiteIntArray*)&g0::inputs74, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata74)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs75, (TfLiteIntArray*)&g0::outputs75, (TfLiteIntArray*)&g0::inputs75, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata75)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs76, (TfLiteIntArray*)&g0::outputs76, (TfLiteIntArray*)&g0::inputs76, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata76)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs77, (TfLiteIntArray*)&g0::outputs77, (TfLiteIntArray*)&g0::inputs77, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata77)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs78, (TfLiteIntArray*)&g0::outputs78, (TfLiteIntArray*)&g0::inputs78, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata78)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs79, (TfLiteIntArray*)&g0::outputs79, (TfLiteIntArray*)&g0::inputs79, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata79)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs80, (TfLiteIntArray*)&g0::outputs80, (TfLiteIntArray*)&g0::inputs80, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata80)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs81, (TfLiteIntArray*)&g0::outputs81, (TfLiteIntArray*)&g0::inputs81, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata81)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs82, (TfLiteIntArray*)&g0::outputs82, (TfLiteIntArray*)&g0::inputs82, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata82)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs83, (TfLiteIntArray*)&g0::outputs83, (TfLiteIntArray*)&g0::inputs83, nullptr, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs84, (TfLiteIntArray*)&g0::outputs84, (TfLiteIntArray*)&g0::inputs84, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata84)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs85, (TfLiteIntArray*)&g0::outputs85, (TfLiteIntArray*)&g0::inputs85, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata85)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs86, (TfLiteIntArray*)&g0::outputs86, (TfLiteIntArray*)&g0::inputs86, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata86)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs87, (TfLiteIntArray*)&g0::outputs87, (TfLiteIntArray*)&g0::inputs87, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata87)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs88, (TfLiteIntArray*)&g0::outputs88, (TfLiteIntArray*)&g0::inputs88, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata88)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs89, (TfLiteIntArray*)&g0::outputs89, (TfLiteIntArray*)&g0::inputs89, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata89)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs90, (TfLiteIntArray*)&g0::outputs90, (TfLiteIntArray*)&g0::inputs90, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata90)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs91, (TfLiteIntArray*)&g0::outputs91, (TfLiteIntArray*)&g0::inputs91, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata91)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs92, (TfLiteIntArray*)&g0::outputs92, (TfLiteIntArray*)&g0::inputs92, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata92)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs93, (TfLiteIntArray*)&g0::outputs93, (TfLiteIntArray*)&g0::inputs93, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata93)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs94, (TfLiteIntArray*)&g0::outputs94, (TfLiteIntArray*)&g0::inputs94, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata94)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs95, (TfLiteIntArray*)&g0::outputs95, (TfLiteIntArray*)&g0::inputs95, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata95)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs96, (TfLiteIntArray*)&g0::outputs96, (TfLiteIntArray*)&g0::inputs96, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata96)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs97, (TfLiteIntArray*)&g0::outputs97, (TfLiteIntArray*)&g0::inputs97, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata97)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs98, (TfLiteIntArray*)&g0::outputs98, (TfLiteIntArray*)&g0::inputs98, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata98)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs99, (TfLiteIntArray*)&g0::outputs99, (TfLiteIntArray*)&g0::inputs99, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata99)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs100, (TfLiteIntArray*)&g0::outputs100, (TfLiteIntArray*)&g0::inputs100, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata100)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs101, (TfLiteIntArray*)&g0::outputs101, (TfLiteIntArray*)&g0::inputs101, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata101)), nullptr, 0, },
+TfLiteNode tflNodes[52] = {
+{ (TfLiteIntArray*)&g0::inputs0, (TfLiteIntArray*)&g0::outputs0, (TfLiteIntArray*)&g0::inputs0, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata0)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata1)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs2, (TfLiteIntArray*)&g0::outputs2, (TfLiteIntArray*)&g0::inputs2, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata2)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs3, (TfLiteIntArray*)&g0::outputs3, (TfLiteIntArray*)&g0::inputs3, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata3)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs4, (TfLiteIntArray*)&g0::outputs4, (TfLiteIntArray*)&g0::inputs4, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata4)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs5, (TfLiteIntArray*)&g0::outputs5, (TfLiteIntArray*)&g0::inputs5, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata5)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs6, (TfLiteIntArray*)&g0::outputs6, (TfLiteIntArray*)&g0::inputs6, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata6)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs7, (TfLiteIntArray*)&g0::outputs7, (TfLiteIntArray*)&g0::inputs7, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata7)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs8, (TfLiteIntArray*)&g0::outputs8, (TfLiteIntArray*)&g0::inputs8, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata8)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs9, (TfLiteIntArray*)&g0::outputs9, (TfLiteIntArray*)&g0::inputs9, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata9)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs10, (TfLiteIntArray*)&g0::outputs10, (TfLiteIntArray*)&g0::inputs10, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata10)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata11)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs12, (TfLiteIntArray*)&g0::outputs12, (TfLiteIntArray*)&g0::inputs12, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata12)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs13, (TfLiteIntArray*)&g0::outputs13, (TfLiteIntArray*)&g0::inputs13, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata13)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs14, (TfLiteIntArray*)&g0::outputs14, (TfLiteIntArray*)&g0::inputs14, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata14)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs15, (TfLiteIntArray*)&g0::outputs15, (TfLiteIntArray*)&g0::inputs15, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata15)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs16, (TfLiteIntArray*)&g0::outputs16, (TfLiteIntArray*)&g0::inputs16, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata16)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs17, (TfLiteIntArray*)&g0::outputs17, (TfLiteIntArray*)&g0::inputs17, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata17)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs18, (TfLiteIntArray*)&g0::outputs18, (TfLiteIntArray*)&g0::inputs18, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata18)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs19, (TfLiteIntArray*)&g0::outputs19, (TfLiteIntArray*)&g0::inputs19, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata19)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs20, (TfLiteIntArray*)&g0::outputs20, (TfLiteIntArray*)&g0::inputs20, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata20)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs21, (TfLiteIntArray*)&g0::outputs21, (TfLiteIntArray*)&g0::inputs21, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata21)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs22, (TfLiteIntArray*)&g0::outputs22, (TfLiteIntArray*)&g0::intermediates22, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata22)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs23, (TfLiteIntArray*)&g0::outputs23, (TfLiteIntArray*)&g0::inputs23, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata23)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs24, (TfLiteIntArray*)&g0::outputs24, (TfLiteIntArray*)&g0::inputs24, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata24)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs25, (TfLiteIntArray*)&g0::outputs25, (TfLiteIntArray*)&g0::inputs25, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata25)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs26, (TfLiteIntArray*)&g0::outputs26, (TfLiteIntArray*)&g0::intermediates26, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata26)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs27, (TfLiteIntArray*)&g0::outputs27, (TfLiteIntArray*)&g0::intermediates27, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata27)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs28, (TfLiteIntArray*)&g0::outputs28, (TfLiteIntArray*)&g0::inputs28, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata28)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs29, (TfLiteIntArray*)&g0::outputs29, (TfLiteIntArray*)&g0::inputs29, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata29)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs30, (TfLiteIntArray*)&g0::outputs30, (TfLiteIntArray*)&g0::inputs30, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata30)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs31, (TfLiteIntArray*)&g0::outputs31, (TfLiteIntArray*)&g0::intermediates31, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata31)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs32, (TfLiteIntArray*)&g0::outputs32, (TfLiteIntArray*)&g0::intermediates32, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata32)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs33, (TfLiteIntArray*)&g0::outputs33, (TfLiteIntArray*)&g0::intermediates33, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata33)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs34, (TfLiteIntArray*)&g0::outputs34, (TfLiteIntArray*)&g0::inputs34, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata34)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs35, (TfLiteIntArray*)&g0::outputs35, (TfLiteIntArray*)&g0::inputs35, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata35)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs36, (TfLiteIntArray*)&g0::outputs36, (TfLiteIntArray*)&g0::inputs36, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata36)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs37, (TfLiteIntArray*)&g0::outputs37, (TfLiteIntArray*)&g0::intermediates37, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata37)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs38, (TfLiteIntArray*)&g0::outputs38, (TfLiteIntArray*)&g0::intermediates38, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata38)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs39, (TfLiteIntArray*)&g0::outputs39, (TfLiteIntArray*)&g0::inputs39, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata39)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs40, (TfLiteIntArray*)&g0::outputs40, (TfLiteIntArray*)&g0::inputs40, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata40)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs41, (TfLiteIntArray*)&g0::outputs41, (TfLiteIntArray*)&g0::inputs41, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata41)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs42, (TfLiteIntArray*)&g0::outputs42, (TfLiteIntArray*)&g0::intermediates42, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata42)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs43, (TfLiteIntArray*)&g0::outputs43, (TfLiteIntArray*)&g0::intermediates43, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata43)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs44, (TfLiteIntArray*)&g0::outputs44, (TfLiteIntArray*)&g0::inputs44, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata44)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs45, (TfLiteIntArray*)&g0::outputs45, (TfLiteIntArray*)&g0::inputs45, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata45)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs46, (TfLiteIntArray*)&g0::outputs46, (TfLiteIntArray*)&g0::inputs46, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata46)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs47, (TfLiteIntArray*)&g0::outputs47, (TfLiteIntArray*)&g0::inputs47, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata47)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs48, (TfLiteIntArray*)&g0::outputs48, (TfLiteIntArray*)&g0::inputs48, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata48)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs49, (TfLiteIntArray*)&g0::outputs49, (TfLiteIntArray*)&g0::inputs49, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata49)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs50, (TfLiteIntArray*)&g0::outputs50, (TfLiteIntArray*)&g0::inputs50, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata50)), nullptr, 0, nullptr, false, },
+{ (TfLiteIntArray*)&g0::inputs51, (TfLiteIntArray*)&g0::outputs51, (TfLiteIntArray*)&g0::inputs51, nullptr, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata51)), nullptr, 0, nullptr, false, },
 };
 #else
-TfLiteNode tflNodes[102] = {
+TfLiteNode tflNodes[52] = {
 { (TfLiteIntArray*)&g0::inputs0, (TfLiteIntArray*)&g0::outputs0, (TfLiteIntArray*)&g0::inputs0, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata0)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs1, (TfLiteIntArray*)&g0::outputs1, (TfLiteIntArray*)&g0::inputs1, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata1)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs2, (TfLiteIntArray*)&g0::outputs2, (TfLiteIntArray*)&g0::inputs2, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata2)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs3, (TfLiteIntArray*)&g0::outputs3, (TfLiteIntArray*)&g0::inputs3, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata3)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs4, (TfLiteIntArray*)&g0::outputs4, (TfLiteIntArray*)&g0::inputs4, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata4)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs5, (TfLiteIntArray*)&g0::outputs5, (TfLiteIntArray*)&g0::inputs5, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata5)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs6, (TfLiteIntArray*)&g0::outputs6, (TfLiteIntArray*)&g0::inputs6, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata6)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs7, (TfLiteIntArray*)&g0::outputs7, (TfLiteIntArray*)&g0::inputs7, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata7)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs8, (TfLiteIntArray*)&g0::outputs8, (TfLiteIntArray*)&g0::inputs8, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs8, (TfLiteIntArray*)&g0::outputs8, (TfLiteIntArray*)&g0::inputs8, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata8)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs9, (TfLiteIntArray*)&g0::outputs9, (TfLiteIntArray*)&g0::inputs9, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata9)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs10, (TfLiteIntArray*)&g0::outputs10, (TfLiteIntArray*)&g0::inputs10, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata10)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs11, (TfLiteIntArray*)&g0::outputs11, (TfLiteIntArray*)&g0::inputs11, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata11)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs12, (TfLiteIntArray*)&g0::outputs12, (TfLiteIntArray*)&g0::inputs12, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata12)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs13, (TfLiteIntArray*)&g0::outputs13, (TfLiteIntArray*)&g0::inputs13, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata13)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs14, (TfLiteIntArray*)&g0::outputs14, (TfLiteIntArray*)&g0::inputs14, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata14)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs15, (TfLiteIntArray*)&g0::outputs15, (TfLiteIntArray*)&g0::inputs15, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata15)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs16, (TfLiteIntArray*)&g0::outputs16, (TfLiteIntArray*)&g0::inputs16, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata16)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs17, (TfLiteIntArray*)&g0::outputs17, (TfLiteIntArray*)&g0::inputs17, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs17, (TfLiteIntArray*)&g0::outputs17, (TfLiteIntArray*)&g0::inputs17, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata17)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs18, (TfLiteIntArray*)&g0::outputs18, (TfLiteIntArray*)&g0::inputs18, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata18)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs19, (TfLiteIntArray*)&g0::outputs19, (TfLiteIntArray*)&g0::inputs19, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata19)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs20, (TfLiteIntArray*)&g0::outputs20, (TfLiteIntArray*)&g0::inputs20, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs20, (TfLiteIntArray*)&g0::outputs20, (TfLiteIntArray*)&g0::inputs20, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata20)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs21, (TfLiteIntArray*)&g0::outputs21, (TfLiteIntArray*)&g0::inputs21, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata21)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs22, (TfLiteIntArray*)&g0::outputs22, (TfLiteIntArray*)&g0::inputs22, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata22)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs22, (TfLiteIntArray*)&g0::outputs22, (TfLiteIntArray*)&g0::intermediates22, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata22)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs23, (TfLiteIntArray*)&g0::outputs23, (TfLiteIntArray*)&g0::inputs23, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata23)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs24, (TfLiteIntArray*)&g0::outputs24, (TfLiteIntArray*)&g0::inputs24, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata24)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs25, (TfLiteIntArray*)&g0::outputs25, (TfLiteIntArray*)&g0::inputs25, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata25)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs26, (TfLiteIntArray*)&g0::outputs26, (TfLiteIntArray*)&g0::inputs26, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs27, (TfLiteIntArray*)&g0::outputs27, (TfLiteIntArray*)&g0::inputs27, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata27)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs26, (TfLiteIntArray*)&g0::outputs26, (TfLiteIntArray*)&g0::intermediates26, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata26)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs27, (TfLiteIntArray*)&g0::outputs27, (TfLiteIntArray*)&g0::intermediates27, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata27)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs28, (TfLiteIntArray*)&g0::outputs28, (TfLiteIntArray*)&g0::inputs28, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata28)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs29, (TfLiteIntArray*)&g0::outputs29, (TfLiteIntArray*)&g0::inputs29, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata29)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs30, (TfLiteIntArray*)&g0::outputs30, (TfLiteIntArray*)&g0::inputs30, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs31, (TfLiteIntArray*)&g0::outputs31, (TfLiteIntArray*)&g0::inputs31, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata31)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs32, (TfLiteIntArray*)&g0::outputs32, (TfLiteIntArray*)&g0::inputs32, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata32)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs33, (TfLiteIntArray*)&g0::outputs33, (TfLiteIntArray*)&g0::inputs33, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata33)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs30, (TfLiteIntArray*)&g0::outputs30, (TfLiteIntArray*)&g0::inputs30, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata30)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs31, (TfLiteIntArray*)&g0::outputs31, (TfLiteIntArray*)&g0::intermediates31, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata31)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs32, (TfLiteIntArray*)&g0::outputs32, (TfLiteIntArray*)&g0::intermediates32, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata32)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs33, (TfLiteIntArray*)&g0::outputs33, (TfLiteIntArray*)&g0::intermediates33, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata33)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs34, (TfLiteIntArray*)&g0::outputs34, (TfLiteIntArray*)&g0::inputs34, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata34)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs35, (TfLiteIntArray*)&g0::outputs35, (TfLiteIntArray*)&g0::inputs35, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs35, (TfLiteIntArray*)&g0::outputs35, (TfLiteIntArray*)&g0::inputs35, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata35)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs36, (TfLiteIntArray*)&g0::outputs36, (TfLiteIntArray*)&g0::inputs36, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata36)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs37, (TfLiteIntArray*)&g0::outputs37, (TfLiteIntArray*)&g0::inputs37, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata37)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs38, (TfLiteIntArray*)&g0::outputs38, (TfLiteIntArray*)&g0::inputs38, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata38)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs37, (TfLiteIntArray*)&g0::outputs37, (TfLiteIntArray*)&g0::intermediates37, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata37)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs38, (TfLiteIntArray*)&g0::outputs38, (TfLiteIntArray*)&g0::intermediates38, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata38)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs39, (TfLiteIntArray*)&g0::outputs39, (TfLiteIntArray*)&g0::inputs39, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata39)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs40, (TfLiteIntArray*)&g0::outputs40, (TfLiteIntArray*)&g0::inputs40, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata40)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs41, (TfLiteIntArray*)&g0::outputs41, (TfLiteIntArray*)&g0::inputs41, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata41)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs42, (TfLiteIntArray*)&g0::outputs42, (TfLiteIntArray*)&g0::inputs42, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata42)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs43, (TfLiteIntArray*)&g0::outputs43, (TfLiteIntArray*)&g0::inputs43, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata43)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs44, (TfLiteIntArray*)&g0::outputs44, (TfLiteIntArray*)&g0::inputs44, nullptr, nullptr, nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs42, (TfLiteIntArray*)&g0::outputs42, (TfLiteIntArray*)&g0::intermediates42, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata42)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs43, (TfLiteIntArray*)&g0::outputs43, (TfLiteIntArray*)&g0::intermediates43, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata43)), nullptr, 0, },
+{ (TfLiteIntArray*)&g0::inputs44, (TfLiteIntArray*)&g0::outputs44, (TfLiteIntArray*)&g0::inputs44, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata44)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs45, (TfLiteIntArray*)&g0::outputs45, (TfLiteIntArray*)&g0::inputs45, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata45)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs46, (TfLiteIntArray*)&g0::outputs46, (TfLiteIntArray*)&g0::inputs46, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata46)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs47, (TfLiteIntArray*)&g0::outputs47, (TfLiteIntArray*)&g0::inputs47, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata47)), nullptr, 0, },
@@ -6040,66 +5911,16 @@ TfLiteNode tflNodes[102] = {
 { (TfLiteIntArray*)&g0::inputs49, (TfLiteIntArray*)&g0::outputs49, (TfLiteIntArray*)&g0::inputs49, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata49)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs50, (TfLiteIntArray*)&g0::outputs50, (TfLiteIntArray*)&g0::inputs50, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata50)), nullptr, 0, },
 { (TfLiteIntArray*)&g0::inputs51, (TfLiteIntArray*)&g0::outputs51, (TfLiteIntArray*)&g0::inputs51, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata51)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs52, (TfLiteIntArray*)&g0::outputs52, (TfLiteIntArray*)&g0::inputs52, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata52)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs53, (TfLiteIntArray*)&g0::outputs53, (TfLiteIntArray*)&g0::inputs53, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata53)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs54, (TfLiteIntArray*)&g0::outputs54, (TfLiteIntArray*)&g0::inputs54, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata54)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs55, (TfLiteIntArray*)&g0::outputs55, (TfLiteIntArray*)&g0::inputs55, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata55)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs56, (TfLiteIntArray*)&g0::outputs56, (TfLiteIntArray*)&g0::inputs56, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs57, (TfLiteIntArray*)&g0::outputs57, (TfLiteIntArray*)&g0::inputs57, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata57)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs58, (TfLiteIntArray*)&g0::outputs58, (TfLiteIntArray*)&g0::inputs58, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata58)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs59, (TfLiteIntArray*)&g0::outputs59, (TfLiteIntArray*)&g0::inputs59, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata59)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs60, (TfLiteIntArray*)&g0::outputs60, (TfLiteIntArray*)&g0::inputs60, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata60)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs61, (TfLiteIntArray*)&g0::outputs61, (TfLiteIntArray*)&g0::inputs61, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata61)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs62, (TfLiteIntArray*)&g0::outputs62, (TfLiteIntArray*)&g0::inputs62, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata62)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs63, (TfLiteIntArray*)&g0::outputs63, (TfLiteIntArray*)&g0::inputs63, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata63)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs64, (TfLiteIntArray*)&g0::outputs64, (TfLiteIntArray*)&g0::inputs64, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata64)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs65, (TfLiteIntArray*)&g0::outputs65, (TfLiteIntArray*)&g0::inputs65, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata65)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs66, (TfLiteIntArray*)&g0::outputs66, (TfLiteIntArray*)&g0::inputs66, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata66)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs67, (TfLiteIntArray*)&g0::outputs67, (TfLiteIntArray*)&g0::inputs67, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata67)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs68, (TfLiteIntArray*)&g0::outputs68, (TfLiteIntArray*)&g0::inputs68, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata68)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs69, (TfLiteIntArray*)&g0::outputs69, (TfLiteIntArray*)&g0::inputs69, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata69)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs70, (TfLiteIntArray*)&g0::outputs70, (TfLiteIntArray*)&g0::inputs70, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata70)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs71, (TfLiteIntArray*)&g0::outputs71, (TfLiteIntArray*)&g0::inputs71, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata71)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs72, (TfLiteIntArray*)&g0::outputs72, (TfLiteIntArray*)&g0::inputs72, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata72)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs73, (TfLiteIntArray*)&g0::outputs73, (TfLiteIntArray*)&g0::inputs73, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata73)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs74, (TfLiteIntArray*)&g0::outputs74, (TfLiteIntArray*)&g0::inputs74, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata74)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs75, (TfLiteIntArray*)&g0::outputs75, (TfLiteIntArray*)&g0::inputs75, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata75)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs76, (TfLiteIntArray*)&g0::outputs76, (TfLiteIntArray*)&g0::inputs76, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata76)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs77, (TfLiteIntArray*)&g0::outputs77, (TfLiteIntArray*)&g0::inputs77, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata77)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs78, (TfLiteIntArray*)&g0::outputs78, (TfLiteIntArray*)&g0::inputs78, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata78)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs79, (TfLiteIntArray*)&g0::outputs79, (TfLiteIntArray*)&g0::inputs79, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata79)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs80, (TfLiteIntArray*)&g0::outputs80, (TfLiteIntArray*)&g0::inputs80, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata80)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs81, (TfLiteIntArray*)&g0::outputs81, (TfLiteIntArray*)&g0::inputs81, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata81)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs82, (TfLiteIntArray*)&g0::outputs82, (TfLiteIntArray*)&g0::inputs82, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata82)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs83, (TfLiteIntArray*)&g0::outputs83, (TfLiteIntArray*)&g0::inputs83, nullptr, nullptr, nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs84, (TfLiteIntArray*)&g0::outputs84, (TfLiteIntArray*)&g0::inputs84, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata84)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs85, (TfLiteIntArray*)&g0::outputs85, (TfLiteIntArray*)&g0::inputs85, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata85)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs86, (TfLiteIntArray*)&g0::outputs86, (TfLiteIntArray*)&g0::inputs86, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata86)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs87, (TfLiteIntArray*)&g0::outputs87, (TfLiteIntArray*)&g0::inputs87, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata87)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs88, (TfLiteIntArray*)&g0::outputs88, (TfLiteIntArray*)&g0::inputs88, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata88)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs89, (TfLiteIntArray*)&g0::outputs89, (TfLiteIntArray*)&g0::inputs89, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata89)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs90, (TfLiteIntArray*)&g0::outputs90, (TfLiteIntArray*)&g0::inputs90, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata90)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs91, (TfLiteIntArray*)&g0::outputs91, (TfLiteIntArray*)&g0::inputs91, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata91)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs92, (TfLiteIntArray*)&g0::outputs92, (TfLiteIntArray*)&g0::inputs92, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata92)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs93, (TfLiteIntArray*)&g0::outputs93, (TfLiteIntArray*)&g0::inputs93, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata93)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs94, (TfLiteIntArray*)&g0::outputs94, (TfLiteIntArray*)&g0::inputs94, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata94)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs95, (TfLiteIntArray*)&g0::outputs95, (TfLiteIntArray*)&g0::inputs95, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata95)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs96, (TfLiteIntArray*)&g0::outputs96, (TfLiteIntArray*)&g0::inputs96, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata96)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs97, (TfLiteIntArray*)&g0::outputs97, (TfLiteIntArray*)&g0::inputs97, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata97)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs98, (TfLiteIntArray*)&g0::outputs98, (TfLiteIntArray*)&g0::inputs98, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata98)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs99, (TfLiteIntArray*)&g0::outputs99, (TfLiteIntArray*)&g0::inputs99, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata99)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs100, (TfLiteIntArray*)&g0::outputs100, (TfLiteIntArray*)&g0::inputs100, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata100)), nullptr, 0, },
-{ (TfLiteIntArray*)&g0::inputs101, (TfLiteIntArray*)&g0::outputs101, (TfLiteIntArray*)&g0::inputs101, nullptr, const_cast<void*>(static_cast<const void*>(&g0::opdata101)), nullptr, 0, },
 };
 #endif
 
 used_operators_e used_ops[] =
-{OP_STRIDED_SLICE, OP_PAD, OP_CONV_2D, OP_STRIDED_SLICE, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_CONV_2D, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_PAD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_CONV_2D, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_PAD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_CONV_2D, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_STRIDED_SLICE, OP_CONV_2D, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONCATENATION, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_PAD, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_FULLY_CONNECTED, OP_RESHAPE, OP_FULLY_CONNECTED, OP_SOFTMAX, };
+{OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONCATENATION, OP_CONV_2D, OP_INVERTED_RESIDUAL, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_INVERTED_RESIDUAL, OP_INVERTED_RESIDUAL, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_INVERTED_RESIDUAL, OP_INVERTED_RESIDUAL, OP_INVERTED_RESIDUAL, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_INVERTED_RESIDUAL, OP_INVERTED_RESIDUAL, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_INVERTED_RESIDUAL, OP_INVERTED_RESIDUAL, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D, OP_CONV_2D, OP_FULLY_CONNECTED, OP_RESHAPE, OP_FULLY_CONNECTED, OP_SOFTMAX, };
 
 
 // Indices into tflTensors and tflNodes for subgraphs
 const size_t tflTensors_subgraph_index[] = {0, 248, };
-const size_t tflNodes_subgraph_index[] = {0, 102, };
+const size_t tflNodes_subgraph_index[] = {0, 52, };
 
 // Input/output tensors
 static const int in_tensor_indices[] = {
@@ -6110,33 +5931,211 @@ static const int out_tensor_indices[] = {
   1, 
 };
 
+// Tensors that are a view into another arena tensor: view, tensor it is in
+static const int16_t tensor_views[][2] = {
+  { 5, 0 }, { 14, 10 }, { 21, 17 }, { 36, 0 }, { 44, 40 }, { 53, 0 }, { 61, 57 }, { 70, 0 }, { 78, 74 }, 
+};
 
-size_t current_subgraph_index = 0;
 
-static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
-  tensor->type = tensorData[i].type;
-  tensor->is_variable = false;
+#if EI_WEIGHT_STAGING_SIZE > 0
+// The constant inputs of one node, copied into one of the weight_staging buffers
+static const int MAX_STAGED_TENSORS = 8;
+typedef struct {
+  int node;
+  size_t count;
+  int16_t tensor[MAX_STAGED_TENSORS];
+  ei_copy_block_t blocks[MAX_STAGED_TENSORS];
+} StagedNode;
+#endif // EI_WEIGHT_STAGING_SIZE > 0
+
+typedef struct {
+  size_t bytes;
+  size_t offset;
+} scratch_buffer_t;
+
+static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx, size_t bytes);
+static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* ctx, size_t bytes,
+                                                int* buffer_idx);
+static void* GetScratchBufferImpl(struct TfLiteContext* ctx, int buffer_idx);
+static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context, int tensor_idx);
+static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context, int tensor_idx);
+
+struct ModelInstance;
+
+class EonMicroContext : public MicroContext {
+ public:
+
+  EonMicroContext(ModelInstance* instance, TfLiteContext* ctx)
+    : MicroContext(nullptr, nullptr, nullptr), instance_(instance), ctx_(ctx) { }
+
+  ModelInstance* instance() const {
+    return instance_;
+  }
+
+  void* AllocatePersistentBuffer(size_t bytes) {
+    return AllocatePersistentBufferImpl(ctx_, bytes);
+  }
+
+  TfLiteStatus RequestScratchBufferInArena(size_t bytes,
+                                           int* buffer_index) {
+  return RequestScratchBufferInArenaImpl(ctx_, bytes, buffer_index);
+  }
+
+  void* GetScratchBuffer(int buffer_index) {
+    return GetScratchBufferImpl(ctx_, buffer_index);
+  }
+
+  TfLiteTensor* AllocateTempTfLiteTensor(int tensor_index) {
+    return GetTensorImpl(ctx_, tensor_index);
+  }
+
+  void DeallocateTempTfLiteTensor(TfLiteTensor*) {
+    return;
+  }
+
+  bool IsAllTempTfLiteTensorDeallocated() {
+    return true;
+  }
+
+  TfLiteEvalTensor* GetEvalTensor(int tensor_index) {
+    return GetEvalTensorImpl(ctx_, tensor_index);
+  }
+
+ private:
+  ModelInstance* instance_;
+  TfLiteContext* ctx_;
+};
+
+// Everything init, invoke and reset change: the arena, the op data of the
+// kernels (TfLiteNode::user_data) and the context they call back into. The
+// functions without an instance argument run on default_instance;
+// tflite_learn_864078_5_instance_init() creates more, so several inferences
+// can run at once, one thread each. tensor_arena_fast and weight_staging are
+// single blocks of memory, only default_instance uses them.
+struct ModelInstance {
+  TfLiteContext ctx{};
+  EonMicroContext micro_context{this, &ctx};
+  TfLiteRegistration registrations[OP_LAST] = {};
+  TfLiteNode nodes[52] = {};
+  bool static_buffers = false; // uses tensor_arena_fast and weight_staging
+  // Next node and end of the inference invoke_step runs, equal when none is
+  // under way
+  size_t step_node = 0;
+  size_t step_end = 0;
+  // The last node of the stepped inference has run, and nothing has invoked
+  // the instance since
+  bool step_completed = false;
+
+  uint8_t* arena = nullptr;
+  uint8_t* tensor_boundary = nullptr;
+  uint8_t* current_location = nullptr;
+  size_t current_subgraph_index = 0;
+
+  TfLiteTensorWithIndex tflTensors[MAX_TFL_TENSOR_COUNT] = {};
+  TfLiteEvalTensorWithIndex tflEvalTensors[MAX_TFL_EVAL_COUNT] = {};
+
+  void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT] = {};
+  size_t overflow_buffers_ix = 0;
+
+  // Scratch buffers only live for the invoke of the node that asked for them, so
+  // all nodes share one region, as large as the largest node needs. Prepare
+  // hands out offsets into it, the region is allocated once every node has been
+  // prepared.
+  scratch_buffer_t scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT] = {};
+  size_t scratch_buffers_ix = 0;
+  size_t scratch_node_bytes = 0;
+  size_t scratch_region_bytes = 0;
+  uint8_t *scratch_region = nullptr;
+
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+  // Offset in tensor_arena_fast of the tensors placed there, -1 for the others
+  int32_t tensor_fast_offset[248] = {};
+  size_t fast_arena_bytes = 0;
+  uint64_t fast_access_bytes = 0;
+  uint64_t slow_access_bytes = 0;
+#endif
 
+#if EI_WEIGHT_STAGING_SIZE > 0
+  StagedNode staged_nodes[2] = { { -1, 0 }, { -1, 0 } };
+  // the node being invoked reads these instead of flash, nullptr for none
+  const StagedNode* staged_active = nullptr;
+#if EI_CLASSIFIER_PROFILE_OPS
+  uint64_t staged_node_count = 0;
+  uint64_t staged_bytes = 0;
+  uint64_t staging_wait_us = 0;
+#endif
+#endif // EI_WEIGHT_STAGING_SIZE > 0
+
+#if EI_CLASSIFIER_PROFILE_OPS
+  ei_node_profile_t node_profiles[52] = {};
+  size_t profile_node = PROFILE_NO_NODE; // node being initialized or prepared
+  uint32_t profile_invokes = 0;
+  size_t profile_overflow_bytes = 0;
+  // arena use at the end of init; the arena can be gone by the time it is read
+  size_t profile_activation_bytes = 0;
+  size_t profile_persistent_bytes = 0;
+#endif // EI_CLASSIFIER_PROFILE_OPS
+};
+
+static ModelInstance default_instance;
+
+static ModelInstance* GetInstance(const struct TfLiteContext* context) {
+  return static_cast<EonMicroContext*>(context->impl_)->instance();
+}
+
+// Offset of tensor i in the arena
+static int TensorArenaOffset(size_t i) {
 #if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  tensor->allocation_type = tensorData[i].allocation_type;
+  return (int)(uintptr_t)tensorData[i].data;
 #else
-  tensor->allocation_type = (tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize) ? kTfLiteArenaRw : kTfLiteMmapRo;
+  return (int)((uint8_t*)tensorData[i].data - tensor_arena);
 #endif
-  tensor->bytes = tensorData[i].bytes;
-  tensor->dims = tensorData[i].dims;
+}
 
+static bool IsArenaTensor(size_t i) {
 #if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  if(tensor->allocation_type == kTfLiteArenaRw){
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
+  return tensorData[i].allocation_type == kTfLiteArenaRw;
+#else
+  return tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize;
+#endif
+}
 
-    tensor->data.data =  start;
+// Data of constant tensor i, the packed filter from the prepared op data if
+// there is one
+static void* ConstTensorData(size_t i) {
+#if EI_CLASSIFIER_PREPACKED_WEIGHTS
+  if (prepared_tensor_data[i]) {
+    return const_cast<void*>(prepared_tensor_data[i]);
   }
-  else {
-      tensor->data.data = tensorData[i].data;
+#endif
+  return tensorData[i].data;
+}
+
+// Data of tensor i in instance
+static void* TensorDataPtr(const ModelInstance* instance, size_t i) {
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+  if (instance->tensor_fast_offset[i] >= 0) {
+    return tensor_arena_fast + instance->tensor_fast_offset[i];
   }
+#endif
+  if (IsArenaTensor(i)) {
+    return instance->arena + TensorArenaOffset(i);
+  }
+  return ConstTensorData(i);
+}
+
+static void init_tflite_tensor(const ModelInstance* instance, size_t i, TfLiteTensor *tensor) {
+  tensor->type = tensorData[i].type;
+  tensor->is_variable = false;
+
+#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
+  tensor->allocation_type = tensorData[i].allocation_type;
 #else
-  tensor->data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
+  tensor->allocation_type = IsArenaTensor(i) ? kTfLiteArenaRw : kTfLiteMmapRo;
+#endif
+  tensor->bytes = tensorData[i].bytes;
+  tensor->dims = tensorData[i].dims;
+  tensor->data.data = TensorDataPtr(instance, i);
   tensor->quantization = tensorData[i].quantization;
   if (tensor->quantization.type == kTfLiteAffineQuantization) {
     TfLiteAffineQuantization const* quant = ((TfLiteAffineQuantization const*)(tensorData[i].quantization.params));
@@ -6146,36 +6145,33 @@ static void init_tflite_tensor(size_t i, TfLiteTensor *tensor) {
 
 }
 
-static void init_tflite_eval_tensor(int i, TfLiteEvalTensor *tensor) {
+static void init_tflite_eval_tensor(const ModelInstance* instance, int i, TfLiteEvalTensor *tensor) {
 
   tensor->type = tensorData[i].type;
 
   tensor->dims = tensorData[i].dims;
 
-#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-  auto allocation_type = tensorData[i].allocation_type;
-  if(allocation_type == kTfLiteArenaRw) {
-    uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
-
-    tensor->data.data =  start;
-  }
-  else {
-    tensor->data.data = tensorData[i].data;
+  tensor->data.data = TensorDataPtr(instance, i);
+#if EI_WEIGHT_STAGING_SIZE > 0
+  const StagedNode* staged = instance->staged_active;
+  if (staged) {
+    for (size_t ix = 0; ix < staged->count; ix++) {
+      if (staged->tensor[ix] == i) {
+        tensor->data.data = staged->blocks[ix].dst;
+      }
+    }
   }
-#else
-  tensor->data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
+#endif
 }
 
-static void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
-static size_t overflow_buffers_ix = 0;
 static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx,
                                        size_t bytes) {
+  ModelInstance* instance = GetInstance(ctx);
   void *ptr;
   uint32_t align_bytes = (bytes % 16) ? 16 - (bytes % 16) : 0;
 
-  if (current_location - (bytes + align_bytes) < tensor_boundary) {
-    if (overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
+  if (instance->current_location - (bytes + align_bytes) < instance->tensor_boundary) {
+    if (instance->overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
       ei_printf("ERR: Failed to allocate persistent buffer of size %d, does not fit in tensor arena and reached EI_MAX_OVERFLOW_BUFFER_COUNT\n",
         (int)bytes);
       return NULL;
@@ -6188,33 +6184,37 @@ static void * AllocatePersistentBufferImpl(struct TfLiteContext* ctx,
       ei_printf("ERR: Failed to allocate persistent buffer of size %d\n", (int)bytes);
       return NULL;
     }
-    overflow_buffers[overflow_buffers_ix++] = ptr;
+    instance->overflow_buffers[instance->overflow_buffers_ix++] = ptr;
+#if EI_CLASSIFIER_PROFILE_OPS
+    instance->profile_overflow_bytes += bytes;
+    if (instance->profile_node != PROFILE_NO_NODE) {
+      instance->node_profiles[instance->profile_node].persistent_bytes += bytes;
+    }
+#endif
     return ptr;
   }
 
-  current_location -= bytes;
+  instance->current_location -= bytes;
 
   // align to the left aligned boundary of 16 bytes
-  current_location -= 15; // for alignment
-  current_location += 16 - ((uintptr_t)(current_location) & 15);
+  instance->current_location -= 15; // for alignment
+  instance->current_location += 16 - ((uintptr_t)(instance->current_location) & 15);
 
-  ptr = current_location;
+  ptr = instance->current_location;
   memset(ptr, 0, bytes);
+#if EI_CLASSIFIER_PROFILE_OPS
+  if (instance->profile_node != PROFILE_NO_NODE) {
+    instance->node_profiles[instance->profile_node].persistent_bytes += bytes;
+  }
+#endif
 
   return ptr;
 }
 
-typedef struct {
-  size_t bytes;
-  void *ptr;
-} scratch_buffer_t;
-
-static scratch_buffer_t scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT];
-static size_t scratch_buffers_ix = 0;
-
 static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* ctx, size_t bytes,
                                                 int* buffer_idx) {
-  if (scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
+  ModelInstance* instance = GetInstance(ctx);
+  if (instance->scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
     ei_printf("ERR: Failed to allocate scratch buffer of size %d, reached EI_MAX_SCRATCH_BUFFER_COUNT\n",
       (int)bytes);
     return kTfLiteError;
@@ -6222,45 +6222,52 @@ static TfLiteStatus RequestScratchBufferInArenaImpl(struct TfLiteContext* ctx, s
 
   scratch_buffer_t b;
   b.bytes = bytes;
+  b.offset = instance->scratch_node_bytes;
 
-  b.ptr = AllocatePersistentBufferImpl(ctx, b.bytes);
-  if (!b.ptr) {
-    ei_printf("ERR: Failed to allocate scratch buffer of size %d\n",
-      (int)bytes);
-    return kTfLiteError;
+  instance->scratch_node_bytes += (bytes + 15) & ~(size_t)15;
+  if (instance->scratch_node_bytes > instance->scratch_region_bytes) {
+    instance->scratch_region_bytes = instance->scratch_node_bytes;
   }
 
-  scratch_buffers[scratch_buffers_ix] = b;
-  *buffer_idx = scratch_buffers_ix;
+  instance->scratch_buffers[instance->scratch_buffers_ix] = b;
+  *buffer_idx = instance->scratch_buffers_ix;
+#if EI_CLASSIFIER_PROFILE_OPS
+  if (instance->profile_node != PROFILE_NO_NODE) {
+    instance->node_profiles[instance->profile_node].scratch_bytes += bytes;
+  }
+#endif
 
-  scratch_buffers_ix++;
+  instance->scratch_buffers_ix++;
 
   return kTfLiteOk;
 }
 
 static void* GetScratchBufferImpl(struct TfLiteContext* ctx, int buffer_idx) {
-  if (buffer_idx > (int)scratch_buffers_ix) {
+  ModelInstance* instance = GetInstance(ctx);
+  if (buffer_idx < 0 || buffer_idx >= (int)instance->scratch_buffers_ix || !instance->scratch_region) {
     return NULL;
   }
-  return scratch_buffers[buffer_idx].ptr;
+  return instance->scratch_region + instance->scratch_buffers[buffer_idx].offset;
 }
 
 static const uint16_t TENSOR_IX_UNUSED = 0x7FFF;
 
-static void ResetTensors() {
+static void ResetTensors(ModelInstance* instance) {
   for (size_t ix = 0; ix < MAX_TFL_TENSOR_COUNT; ix++) {
-    tflTensors[ix].index = TENSOR_IX_UNUSED;
+    instance->tflTensors[ix].index = TENSOR_IX_UNUSED;
   }
   for (size_t ix = 0; ix < MAX_TFL_EVAL_COUNT; ix++) {
-    tflEvalTensors[ix].index = TENSOR_IX_UNUSED;
+    instance->tflEvalTensors[ix].index = TENSOR_IX_UNUSED;
   }
 }
 
 static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context,
                                int tensor_idx) {
+  ModelInstance* instance = GetInstance(context);
 
-  tensor_idx = tflTensors_subgraph_index[current_subgraph_index] + tensor_idx;
+  tensor_idx = tflTensors_subgraph_index[instance->current_subgraph_index] + tensor_idx;
 
+  TfLiteTensorWithIndex* tflTensors = instance->tflTensors;
   for (size_t ix = 0; ix < MAX_TFL_TENSOR_COUNT; ix++) {
     // already used? OK!
     if (tflTensors[ix].index == tensor_idx) {
@@ -6269,7 +6276,7 @@ static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context,
     // passed all the ones we've used, so end of the list?
     if (tflTensors[ix].index == TENSOR_IX_UNUSED) {
       // init the tensor
-      init_tflite_tensor(tensor_idx, &tflTensors[ix].tensor);
+      init_tflite_tensor(instance, tensor_idx, &tflTensors[ix].tensor);
       tflTensors[ix].index = tensor_idx;
       return &tflTensors[ix].tensor;
     }
@@ -6281,9 +6288,11 @@ static TfLiteTensor* GetTensorImpl(const struct TfLiteContext* context,
 
 static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context,
                                        int tensor_idx) {
+  ModelInstance* instance = GetInstance(context);
 
-  tensor_idx = tflTensors_subgraph_index[current_subgraph_index] + tensor_idx;
+  tensor_idx = tflTensors_subgraph_index[instance->current_subgraph_index] + tensor_idx;
 
+  TfLiteEvalTensorWithIndex* tflEvalTensors = instance->tflEvalTensors;
   for (size_t ix = 0; ix < MAX_TFL_EVAL_COUNT; ix++) {
     // already used? OK!
     if (tflEvalTensors[ix].index == tensor_idx) {
@@ -6292,7 +6301,7 @@ static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context,
     // passed all the ones we've used, so end of the list?
     if (tflEvalTensors[ix].index == TENSOR_IX_UNUSED) {
       // init the tensor
-      init_tflite_eval_tensor(tensor_idx, &tflEvalTensors[ix].tensor);
+      init_tflite_eval_tensor(instance, tensor_idx, &tflEvalTensors[ix].tensor);
       tflEvalTensors[ix].index = tensor_idx;
       return &tflEvalTensors[ix].tensor;
     }
@@ -6302,62 +6311,379 @@ static TfLiteEvalTensor* GetEvalTensorImpl(const struct TfLiteContext* context,
   return nullptr;
 }
 
-class EonMicroContext : public MicroContext {
- public:
- 
-  EonMicroContext(): MicroContext(nullptr, nullptr, nullptr) { }
 
-  void* AllocatePersistentBuffer(size_t bytes) {
-    return AllocatePersistentBufferImpl(nullptr, bytes);
+#if EI_CLASSIFIER_PROFILE_OPS
+static void ProfileCopyDims(const TfLiteIntArray* dims, int32_t* out, uint8_t* count) {
+  *count = 0;
+  for (int ix = 0; dims && ix < dims->size && ix < EI_PROFILE_MAX_DIMS; ix++) {
+    out[(*count)++] = dims->data[ix];
   }
+}
 
-  TfLiteStatus RequestScratchBufferInArena(size_t bytes,
-                                           int* buffer_index) {
-  return RequestScratchBufferInArenaImpl(nullptr, bytes, buffer_index);
+// Operators and shapes, and the allocations about to be made; times are kept
+static void ProfileInit(ModelInstance* instance) {
+  for (size_t i = 0; i < 52; ++i) {
+    ei_node_profile_t* p = &instance->node_profiles[i];
+    p->op = used_op_names[used_ops[i]];
+    p->node = (uint16_t)i;
+    ProfileCopyDims(tensorData[tflNodes[i].inputs->data[0]].dims, p->input_dims, &p->input_dims_count);
+    ProfileCopyDims(tensorData[tflNodes[i].outputs->data[0]].dims, p->output_dims, &p->output_dims_count);
+    p->persistent_bytes = 0;
+    p->scratch_bytes = 0;
   }
+  instance->profile_overflow_bytes = 0;
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
 
-  void* GetScratchBuffer(int buffer_index) {
-    return GetScratchBufferImpl(nullptr, buffer_index);
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+typedef struct {
+  int16_t first_node;   // -1 for tensors the graph does not touch
+  int16_t last_node;
+  int16_t buffer;       // planner buffer, -1 for views and unplanned tensors
+  uint64_t access_bytes;
+} FastArenaTensorUse;
+
+// Times a node reads every byte of its first input: a convolution reads each
+// input pixel once for every filter tap it falls under
+static uint32_t InputReadsPerByte(size_t i) {
+  const TfLiteIntArray* filter = nullptr;
+  int strides = 1;
+  switch (used_ops[i]) {
+    case OP_CONV_2D: {
+      const TfLiteConvParams* params = (const TfLiteConvParams*)tflNodes[i].builtin_data;
+      filter = tensorData[tflNodes[i].inputs->data[1]].dims;
+      strides = params->stride_width * params->stride_height;
+      break;
+    }
+    case OP_DEPTHWISE_CONV_2D: {
+      const TfLiteDepthwiseConvParams* params = (const TfLiteDepthwiseConvParams*)tflNodes[i].builtin_data;
+      filter = tensorData[tflNodes[i].inputs->data[1]].dims;
+      strides = params->stride_width * params->stride_height;
+      break;
+    }
+    case OP_INVERTED_RESIDUAL:
+      return 2; // the expand convolution, then the residual add
+    default:
+      return 1;
   }
- 
-  TfLiteTensor* AllocateTempTfLiteTensor(int tensor_index) {
-    return GetTensorImpl(nullptr, tensor_index);
+  uint32_t reads = (uint32_t)(filter->data[1] * filter->data[2] / strides);
+  return reads ? reads : 1;
+}
+
+static uint32_t OutputTouchesPerByte(size_t i) {
+  // the residual add reads and writes the projected rows again
+  return used_ops[i] == OP_INVERTED_RESIDUAL ? 3 : 1;
+}
+
+// Moves the scratch buffers and the hottest tensors into tensor_arena_fast.
+// Runs once every node has been prepared (kernels look up tensor data on
+// every invoke, not in prepare). Everything that stays behind keeps its
+// place in the arena, so running out of fast memory only costs speed.
+static TfLiteStatus PlanFastArena(ModelInstance* instance, size_t node_count) {
+  int32_t* tensor_fast_offset = instance->tensor_fast_offset;
+  for (size_t i = 0; i < 248; ++i) {
+    tensor_fast_offset[i] = -1;
   }
+  instance->fast_arena_bytes = 0;
+  instance->fast_access_bytes = 0;
+  instance->slow_access_bytes = 0;
 
-  void DeallocateTempTfLiteTensor(TfLiteTensor* tensor) {
-    return;
+  // kernels ask for scratch for their innermost loops, it goes first
+  size_t fast_offset = 0;
+  if (instance->scratch_region_bytes > 0 && instance->scratch_region_bytes <= EI_TENSOR_ARENA_FAST_SIZE) {
+    instance->scratch_region = tensor_arena_fast;
+    fast_offset = (instance->scratch_region_bytes + 15) & ~(size_t)15;
   }
 
-  bool IsAllTempTfLiteTensorDeallocated() {
-    return true;
+  // working memory: the free part of the arena between tensors and op data
+  uint8_t* work = (uint8_t*)(((uintptr_t)instance->tensor_boundary + 15) & ~(uintptr_t)15);
+  if (work + 248 * (sizeof(FastArenaTensorUse) + tflite::TwoTierMemoryPlanner::per_buffer_size()) > instance->current_location) {
+    ei_printf("WARN: no room to plan the fast arena, all tensors stay in the tensor arena\n");
+    instance->fast_arena_bytes = fast_offset;
+    return kTfLiteOk;
+  }
+  FastArenaTensorUse* use = (FastArenaTensorUse*)work;
+  for (size_t t = 0; t < 248; ++t) {
+    use[t].first_node = -1;
+    use[t].last_node = -1;
+    use[t].buffer = -1;
+    use[t].access_bytes = 0;
   }
 
-  TfLiteEvalTensor* GetEvalTensor(int tensor_index) {
-    return GetEvalTensorImpl(nullptr, tensor_index);
+  for (size_t i = 0; i < node_count; ++i) {
+    const TfLiteIntArray* lists[2] = { tflNodes[i].inputs, tflNodes[i].outputs };
+    for (int l = 0; l < 2; ++l) {
+      for (int ix = 0; ix < lists[l]->size; ++ix) {
+        int t = lists[l]->data[ix];
+        if (t < 0 || tensorData[t].allocation_type != kTfLiteArenaRw) {
+          continue;
+        }
+        if (use[t].first_node < 0) {
+          use[t].first_node = (int16_t)i;
+        }
+        use[t].last_node = (int16_t)i;
+        uint32_t touches = l == 1 ? OutputTouchesPerByte(i) : ix == 0 ? InputReadsPerByte(i) : 1;
+        use[t].access_bytes += (uint64_t)tensorData[t].bytes * touches;
+      }
+    }
+  }
+  // the input is written before the first node, the output read after the last
+  for (size_t ix = 0; ix < sizeof(in_tensor_indices) / sizeof(in_tensor_indices[0]); ++ix) {
+    use[in_tensor_indices[ix]].first_node = 0;
+    use[in_tensor_indices[ix]].access_bytes += tensorData[in_tensor_indices[ix]].bytes;
+  }
+  for (size_t ix = 0; ix < sizeof(out_tensor_indices) / sizeof(out_tensor_indices[0]); ++ix) {
+    use[out_tensor_indices[ix]].last_node = (int16_t)(node_count - 1);
+    use[out_tensor_indices[ix]].access_bytes += tensorData[out_tensor_indices[ix]].bytes;
+  }
+  // a view lives and moves with the tensor it is in
+  for (size_t ix = 0; ix < sizeof(tensor_views) / sizeof(tensor_views[0]); ++ix) {
+    FastArenaTensorUse* view = &use[tensor_views[ix][0]];
+    FastArenaTensorUse* base = &use[tensor_views[ix][1]];
+    if (view->first_node < 0) {
+      continue;
+    }
+    if (base->first_node < 0 || view->first_node < base->first_node) {
+      base->first_node = view->first_node;
+    }
+    if (view->last_node > base->last_node) {
+      base->last_node = view->last_node;
+    }
+    base->access_bytes += view->access_bytes;
+    view->first_node = -1;
   }
 
-};
+  tflite::TwoTierMemoryPlanner planner;
+  uint8_t* planner_scratch = work + 248 * sizeof(FastArenaTensorUse);
+  planner.Init(planner_scratch, (int)(instance->current_location - planner_scratch),
+    (int)(EI_TENSOR_ARENA_FAST_SIZE - fast_offset));
+  for (size_t t = 0; t < 248; ++t) {
+    if (use[t].first_node < 0) {
+      continue;
+    }
+    use[t].buffer = (int16_t)planner.GetBufferCount();
+    TF_LITE_ENSURE_STATUS(planner.AddBuffer((int)tensorData[t].bytes, use[t].first_node,
+      use[t].last_node, TensorArenaOffset(t), use[t].access_bytes));
+  }
 
+  for (size_t t = 0; t < 248; ++t) {
+    if (use[t].buffer < 0) {
+      continue;
+    }
+    tflite::MemoryTier tier;
+    int offset;
+    TF_LITE_ENSURE_STATUS(planner.GetPlacementForBuffer(use[t].buffer, &tier, &offset));
+    if (tier == tflite::kMemoryTierFast) {
+      tensor_fast_offset[t] = (int32_t)(fast_offset + offset);
+    }
+  }
+  for (size_t ix = 0; ix < sizeof(tensor_views) / sizeof(tensor_views[0]); ++ix) {
+    int view = tensor_views[ix][0];
+    int base = tensor_views[ix][1];
+    if (tensor_fast_offset[base] >= 0) {
+      tensor_fast_offset[view] = tensor_fast_offset[base] + TensorArenaOffset(view) - TensorArenaOffset(base);
+    }
+  }
 
-} // namespace
+  instance->fast_arena_bytes = fast_offset + planner.GetFastMemorySize();
+  instance->fast_access_bytes = planner.GetAccessBytes(tflite::kMemoryTierFast);
+  instance->slow_access_bytes = planner.GetAccessBytes(tflite::kMemoryTierSlow);
+  return kTfLiteOk;
+}
+#endif // EI_TENSOR_ARENA_FAST_SIZE > 0
 
-TfLiteStatus tflite_learn_864078_5_init( void*(*alloc_fnc)(size_t,size_t) ) {
-#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
-  if (!tensor_arena) {
-    ei_printf("ERR: failed to allocate tensor arena\n");
+#if EI_WEIGHT_STAGING_SIZE > 0
+// Start copying the constant inputs of node i into weight_staging[i % 2].
+// Nothing is copied when they do not all fit.
+static void StageNode(ModelInstance* instance, size_t i) {
+  StagedNode* staged = &instance->staged_nodes[i % 2];
+  staged->node = (int)i;
+  staged->count = 0;
+
+  size_t offset = 0;
+  const TfLiteIntArray* inputs = tflNodes[i].inputs;
+  for (int ix = 0; ix < inputs->size; ix++) {
+    int t = inputs->data[ix];
+    if (t < 0 || tensorData[t].allocation_type != kTfLiteMmapRo) {
+      continue;
+    }
+    size_t bytes = tensorData[t].bytes;
+    if (staged->count == MAX_STAGED_TENSORS || offset + bytes > EI_WEIGHT_STAGING_SIZE) {
+      staged->count = 0;
+      return;
+    }
+    staged->tensor[staged->count] = (int16_t)t;
+    staged->blocks[staged->count].dst = weight_staging[i % 2] + offset;
+    staged->blocks[staged->count].src = ConstTensorData(t);
+    staged->blocks[staged->count].size = bytes;
+    staged->count++;
+    offset += (bytes + 15) & ~(size_t)15;
+  }
+  if (staged->count > 0 && ei_copy_async_start(staged->blocks, staged->count) != EI_IMPULSE_OK) {
+    staged->count = 0;
+  }
+}
+
+// Wait for the constants of node i, which were copied while node i - 1 ran,
+// point node i at them and start on those of node i + 1. The first node reads
+// flash, there is nothing before it to hide the copy behind.
+static void StagingBegin(ModelInstance* instance, size_t i, size_t node_count) {
+#if EI_CLASSIFIER_PROFILE_OPS
+  uint64_t start_us = ei_read_timer_us();
+#endif
+  ei_copy_async_wait();
+#if EI_CLASSIFIER_PROFILE_OPS
+  instance->staging_wait_us += ei_read_timer_us() - start_us;
+#endif
+
+  const StagedNode* staged = &instance->staged_nodes[i % 2];
+  instance->staged_active = (staged->node == (int)i && staged->count > 0) ? staged : nullptr;
+#if EI_CLASSIFIER_PROFILE_OPS
+  if (instance->staged_active) {
+    instance->staged_node_count++;
+    for (size_t ix = 0; ix < staged->count; ix++) {
+      instance->staged_bytes += staged->blocks[ix].size;
+    }
+  }
+#endif
+  if (i + 1 < node_count) {
+    StageNode(instance, i + 1);
+  }
+}
+#endif // EI_WEIGHT_STAGING_SIZE > 0
+
+#if EI_CLASSIFIER_PREPARED_OP_DATA || EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+// Fingerprints (FNV-1a) of the model the prepared op data are written from.
+// The shape signature covers the operator, inputs and outputs of every node
+// and the type and dims of every tensor. The weight checksum covers the
+// constant tensors and the quantization parameters of every tensor, which
+// the prepared multipliers, shifts and packed filters are computed from.
+static uint32_t Fnv1a(uint32_t hash, const void* data, size_t bytes) {
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < bytes; ++i) {
+    hash = (hash ^ p[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t Fnv1aIntArray(uint32_t hash, const TfLiteIntArray* array) {
+  hash = Fnv1a(hash, &array->size, sizeof(array->size));
+  return Fnv1a(hash, array->data, array->size * sizeof(array->data[0]));
+}
+
+static uint32_t PreparedShapeSignature() {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < 52; ++i) {
+    const int32_t op = used_ops[i];
+    hash = Fnv1a(hash, &op, sizeof(op));
+    hash = Fnv1aIntArray(hash, tflNodes[i].inputs);
+    hash = Fnv1aIntArray(hash, tflNodes[i].outputs);
+  }
+  for (size_t i = 0; i < 248; ++i) {
+    const int32_t type = tensorData[i].type;
+    hash = Fnv1a(hash, &type, sizeof(type));
+    hash = Fnv1aIntArray(hash, tensorData[i].dims);
+  }
+  return hash;
+}
+
+static uint32_t PreparedWeightChecksum() {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < 248; ++i) {
+    const TensorInfo_t& t = tensorData[i];
+    if (t.allocation_type == kTfLiteMmapRo) {
+      hash = Fnv1a(hash, t.data, t.bytes);
+    }
+    if (t.quantization.type == kTfLiteAffineQuantization) {
+      const TfLiteAffineQuantization* q =
+          static_cast<const TfLiteAffineQuantization*>(t.quantization.params);
+      hash = Fnv1a(hash, q->scale->data, q->scale->size * sizeof(q->scale->data[0]));
+      hash = Fnv1aIntArray(hash, q->zero_point);
+      const int32_t dimension = q->quantized_dimension;
+      hash = Fnv1a(hash, &dimension, sizeof(dimension));
+    }
+  }
+  return hash;
+}
+#endif // EI_CLASSIFIER_PREPARED_OP_DATA || EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+
+#if EI_CLASSIFIER_PREPARED_OP_DATA
+static_assert(kPreparedNodeCount == 52,
+              "tflite_learn_864078_5_prepared.h is not from this model");
+static_assert(sizeof(prepared_op_data) / sizeof(prepared_op_data[0]) == 52,
+              "tflite_learn_864078_5_prepared.h is not from this model");
+static_assert(sizeof(prepared_tensor_data) / sizeof(prepared_tensor_data[0]) == 248,
+              "tflite_learn_864078_5_prepared.h is not from this model");
+
+// The fingerprints cannot be computed at compile time, so the first init
+// compares them with the ones in the header and refuses to set the model up
+// from op data of another model
+static std::atomic<bool> prepared_op_data_checked(false);
+
+static TfLiteStatus CheckPreparedOpData() {
+  if (prepared_op_data_checked.load()) {
+    return kTfLiteOk;
+  }
+  const uint32_t shape_signature = PreparedShapeSignature();
+  const uint32_t weight_checksum = PreparedWeightChecksum();
+  if (shape_signature != kPreparedShapeSignature || weight_checksum != kPreparedWeightChecksum) {
+    ei_printf("ERR: tflite_learn_864078_5_prepared.h is not from this model "
+              "(shape signature %08x, weight checksum %08x; the header has %08x, %08x), "
+              "write it again with benchmark/eon_prepare\n",
+              (unsigned)shape_signature, (unsigned)weight_checksum,
+              (unsigned)kPreparedShapeSignature, (unsigned)kPreparedWeightChecksum);
     return kTfLiteError;
   }
-#else
-  memset(tensor_arena, 0, kTensorArenaSize);
+  prepared_op_data_checked = true;
+  return kTfLiteOk;
+}
+#endif
+
+// Prepares node i, or sets it up from its prepared op data
+static TfLiteStatus PrepareNode(ModelInstance* instance, size_t i) {
+  TfLiteContext* ctx = &instance->ctx;
+  TfLiteNode* node = &instance->nodes[i];
+#if EI_CLASSIFIER_PREPARED_OP_DATA
+  const void* op_data = prepared_op_data[i];
+  if (op_data) {
+    switch (used_ops[i]) {
+      case OP_CONV_2D:
+        return ConvInitPrepared(ctx, node, op_data);
+      case OP_DEPTHWISE_CONV_2D:
+        return DepthwiseConvInitPrepared(ctx, node, op_data);
+      case OP_INVERTED_RESIDUAL:
+        return InvertedResidualInitPrepared(ctx, node, op_data);
+      case OP_FULLY_CONNECTED:
+        return FullyConnectedInitPrepared(ctx, node, op_data);
+      case OP_SOFTMAX:
+        return SoftmaxInitPrepared(ctx, node, op_data);
+      default:
+        return kTfLiteError;
+    }
+  }
+#endif
+  return instance->registrations[used_ops[i]].prepare(ctx, node);
+}
+
+// Init and prepare every node of instance into instance->arena, which the
+// caller has allocated (and zeroed)
+static TfLiteStatus InitInstance(ModelInstance* instance) {
+#if EI_CLASSIFIER_PREPARED_OP_DATA
+  TF_LITE_ENSURE_STATUS(CheckPreparedOpData());
+#endif
+  instance->tensor_boundary = instance->arena;
+  instance->current_location = instance->arena + kTensorArenaSize;
+  instance->current_subgraph_index = 0;
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+  for (size_t i = 0; i < 248; ++i) {
+    instance->tensor_fast_offset[i] = -1;
+  }
 #endif
-  tensor_boundary = tensor_arena;
-  current_location = tensor_arena + kTensorArenaSize;
+  memcpy(instance->nodes, tflNodes, sizeof(tflNodes));
 
-  EonMicroContext micro_context_;
-  
   // Set microcontext as the context ptr
-  ctx.impl_ = static_cast<void*>(&micro_context_);
+  TfLiteContext& ctx = instance->ctx;
+  ctx.impl_ = static_cast<void*>(&instance->micro_context);
   // Setup tflitecontext functions
   ctx.AllocatePersistentBuffer = &AllocatePersistentBufferImpl;
   ctx.RequestScratchBufferInArena = &RequestScratchBufferInArenaImpl;
@@ -6369,151 +6695,582 @@ TfLiteStatus tflite_learn_864078_5_init( void*(*alloc_fnc)(size_t,size_t) ) {
   ctx.tensors_size = 248;
   for (size_t i = 0; i < 248; ++i) {
     TfLiteTensor tensor;
-    init_tflite_tensor(i, &tensor);
+    init_tflite_tensor(instance, i, &tensor);
     if (tensor.allocation_type == kTfLiteArenaRw) {
       auto data_end_ptr = (uint8_t*)tensor.data.data + tensorData[i].bytes;
-      if (data_end_ptr > tensor_boundary) {
-        tensor_boundary = data_end_ptr;
+      if (data_end_ptr > instance->tensor_boundary) {
+        instance->tensor_boundary = data_end_ptr;
       }
     }
   }
 
-  if (tensor_boundary > current_location /* end of arena size */) {
+  if (instance->tensor_boundary > instance->current_location /* end of arena size */) {
     ei_printf("ERR: tensor arena is too small, does not fit model - even without scratch buffers\n");
     return kTfLiteError;
   }
 
-  registrations[OP_STRIDED_SLICE] = Register_STRIDED_SLICE();
-  registrations[OP_PAD] = Register_PAD();
+  TfLiteRegistration* registrations = instance->registrations;
   registrations[OP_CONV_2D] = Register_CONV_2D();
   registrations[OP_DEPTHWISE_CONV_2D] = Register_DEPTHWISE_CONV_2D();
   registrations[OP_CONCATENATION] = Register_CONCATENATION();
-  registrations[OP_ADD] = Register_ADD();
+  registrations[OP_INVERTED_RESIDUAL] = Register_INVERTED_RESIDUAL();
   registrations[OP_FULLY_CONNECTED] = Register_FULLY_CONNECTED();
   registrations[OP_RESHAPE] = Register_RESHAPE();
   registrations[OP_SOFTMAX] = Register_SOFTMAX();
 
+#if EI_CLASSIFIER_PROFILE_OPS
+  ProfileInit(instance);
+#endif
+
+  TfLiteNode* nodes = instance->nodes;
   for (size_t g = 0; g < 1; ++g) {
-    current_subgraph_index = g;
+    instance->current_subgraph_index = g;
     for(size_t i = tflNodes_subgraph_index[g]; i < tflNodes_subgraph_index[g+1]; ++i) {
+#if EI_CLASSIFIER_PROFILE_OPS
+      instance->profile_node = i;
+#endif
+#if EI_CLASSIFIER_PREPARED_OP_DATA
+      if (prepared_op_data[i]) {
+        continue;
+      }
+#endif
       if (registrations[used_ops[i]].init) {
-        tflNodes[i].user_data = registrations[used_ops[i]].init(&ctx, (const char*)tflNodes[i].builtin_data, 0);
+        nodes[i].user_data = registrations[used_ops[i]].init(&ctx, (const char*)nodes[i].builtin_data, 0);
       }
     }
   }
-  current_subgraph_index = 0;
+  instance->current_subgraph_index = 0;
 
   for(size_t g = 0; g < 1; ++g) {
-    current_subgraph_index = g;
+    instance->current_subgraph_index = g;
     for(size_t i = tflNodes_subgraph_index[g]; i < tflNodes_subgraph_index[g+1]; ++i) {
       if (registrations[used_ops[i]].prepare) {
-        ResetTensors();
-        TfLiteStatus status = registrations[used_ops[i]].prepare(&ctx, &tflNodes[i]);
+        ResetTensors(instance);
+        instance->scratch_node_bytes = 0;
+#if EI_CLASSIFIER_PROFILE_OPS
+        instance->profile_node = i;
+#endif
+        TfLiteStatus status = PrepareNode(instance, i);
         if (status != kTfLiteOk) {
           return status;
         }
       }
     }
   }
-  current_subgraph_index = 0;
+  instance->current_subgraph_index = 0;
+#if EI_CLASSIFIER_PROFILE_OPS
+  instance->profile_node = PROFILE_NO_NODE;
+#endif
 
-  return kTfLiteOk;
-}
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+  if (instance->static_buffers) {
+    TF_LITE_ENSURE_STATUS(PlanFastArena(instance, 52));
+  }
+#endif
 
-TfLiteStatus tflite_learn_864078_5_input(int index, TfLiteTensor *tensor) {
-  init_tflite_tensor(in_tensor_indices[index], tensor);
-  return kTfLiteOk;
-}
+  if (instance->scratch_region_bytes > 0 && !instance->scratch_region) {
+    instance->scratch_region = (uint8_t*)AllocatePersistentBufferImpl(&ctx, instance->scratch_region_bytes);
+    if (!instance->scratch_region) {
+      ei_printf("ERR: Failed to allocate scratch buffers of size %d\n", (int)instance->scratch_region_bytes);
+      return kTfLiteError;
+    }
+  }
 
-TfLiteStatus tflite_learn_864078_5_output(int index, TfLiteTensor *tensor) {
-  init_tflite_tensor(out_tensor_indices[index], tensor);
+#if EI_CLASSIFIER_PROFILE_OPS
+  instance->profile_activation_bytes = (size_t)(instance->tensor_boundary - instance->arena);
+  instance->profile_persistent_bytes = (size_t)(instance->arena + kTensorArenaSize - instance->current_location);
+#endif
   return kTfLiteOk;
 }
 
-TfLiteStatus tflite_learn_864078_5_invoke() {
-  for (size_t i = 0; i < 102; ++i) {
-    ResetTensors();
+static TfLiteStatus InvokeNode(ModelInstance* instance, size_t i) {
+  TfLiteNode* nodes = instance->nodes;
+  ResetTensors(instance);
+#if EI_WEIGHT_STAGING_SIZE > 0
+  if (instance->static_buffers) {
+    StagingBegin(instance, i, 52);
+  }
+#endif
 
-    TfLiteStatus status = registrations[used_ops[i]].invoke(&ctx, &tflNodes[i]);
+#if EI_CLASSIFIER_PROFILE_OPS
+  uint64_t start_us = ei_read_timer_us();
+  uint32_t start_cycles = ei_profile_read_cycles();
+#endif
 
-#if EI_CLASSIFIER_PRINT_STATE
-    ei_printf("layer %lu\n", i);
-    ei_printf("    inputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].inputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].inputs->data[ix]];
+  TfLiteStatus status = instance->registrations[used_ops[i]].invoke(&instance->ctx, &nodes[i]);
+#if EI_WEIGHT_STAGING_SIZE > 0
+  instance->staged_active = nullptr;
+#endif
+
+#if EI_CLASSIFIER_PROFILE_OPS
+  uint32_t cycles = ei_profile_read_cycles() - start_cycles;
+  uint32_t us = (uint32_t)(ei_read_timer_us() - start_us);
+  ei_node_profile_t* p = &instance->node_profiles[i];
+  p->runs++;
+  p->last_us = us;
+  p->total_us += us;
+  p->total_cycles += cycles;
+  if (us > p->max_us) {
+    p->max_us = us;
+  }
+#endif
 
-      size_t data_ptr = (size_t)d.data;
+#if EI_CLASSIFIER_PRINT_STATE
+  ei_printf("layer %lu\n", i);
+  ei_printf("    inputs:\n");
+  for (size_t ix = 0; ix < nodes[i].inputs->size; ix++) {
+    auto d = tensorData[nodes[i].inputs->data[ix]];
 
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+    size_t data_ptr = (size_t)TensorDataPtr(instance, nodes[i].inputs->data[ix]);
 
-      if (d.type == TfLiteType::kTfLiteInt8) {
-        int8_t* data = (int8_t*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes; jx++) {
-          ei_printf("%d ", data[jx]);
-        }
+    if (d.type == TfLiteType::kTfLiteInt8) {
+      int8_t* data = (int8_t*)data_ptr;
+      ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
+      for (size_t jx = 0; jx < d.bytes; jx++) {
+        ei_printf("%d ", data[jx]);
       }
-      else {
-        float* data = (float*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes / 4; jx++) {
-          ei_printf("%f ", data[jx]);
-        }
+    }
+    else {
+      float* data = (float*)data_ptr;
+      ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
+      for (size_t jx = 0; jx < d.bytes / 4; jx++) {
+        ei_printf("%f ", data[jx]);
       }
-      ei_printf("\n");
     }
     ei_printf("\n");
+  }
+  ei_printf("\n");
 
-    ei_printf("    outputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].outputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].outputs->data[ix]];
-
-      size_t data_ptr = (size_t)d.data;
+  ei_printf("    outputs:\n");
+  for (size_t ix = 0; ix < nodes[i].outputs->size; ix++) {
+    auto d = tensorData[nodes[i].outputs->data[ix]];
 
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+    size_t data_ptr = (size_t)TensorDataPtr(instance, nodes[i].outputs->data[ix]);
 
-      if (d.type == TfLiteType::kTfLiteInt8) {
-        int8_t* data = (int8_t*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes; jx++) {
-          ei_printf("%d ", data[jx]);
-        }
+    if (d.type == TfLiteType::kTfLiteInt8) {
+      int8_t* data = (int8_t*)data_ptr;
+      ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
+      for (size_t jx = 0; jx < d.bytes; jx++) {
+        ei_printf("%d ", data[jx]);
       }
-      else {
-        float* data = (float*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes / 4; jx++) {
-          ei_printf("%f ", data[jx]);
-        }
+    }
+    else {
+      float* data = (float*)data_ptr;
+      ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
+      for (size_t jx = 0; jx < d.bytes / 4; jx++) {
+        ei_printf("%f ", data[jx]);
       }
-      ei_printf("\n");
     }
     ei_printf("\n");
+  }
+  ei_printf("\n");
 #endif // EI_CLASSIFIER_PRINT_STATE
 
+  return status;
+}
+
+static TfLiteStatus InvokeInstance(ModelInstance* instance) {
+  // a full invoke overwrites whatever a stepped one left in the arena
+  instance->step_node = instance->step_end = 0;
+  instance->step_completed = false;
+  for (size_t i = 0; i < 52; ++i) {
+    TF_LITE_ENSURE_STATUS(InvokeNode(instance, i));
+  }
+#if EI_CLASSIFIER_PROFILE_OPS
+  instance->profile_invokes++;
+#endif
+  return kTfLiteOk;
+}
+
+// Runs every node but the final SOFTMAX, which leaves the logits in its input
+static TfLiteStatus InvokeLogits(ModelInstance* instance) {
+  instance->step_node = instance->step_end = 0;
+  instance->step_completed = false;
+  for (size_t i = 0; i < 51; ++i) {
+    TF_LITE_ENSURE_STATUS(InvokeNode(instance, i));
+  }
+#if EI_CLASSIFIER_PROFILE_OPS
+  instance->profile_invokes++;
+#endif
+  return kTfLiteOk;
+}
+
+// Runs the next nodes of the inference StartSteps set up: at most max_nodes (0
+// for no limit), and none once budget_us (0 for none) has gone by, but always
+// at least one. A node is never split, so a slice can overrun the budget by
+// the time of its last node. *done once the last node has run.
+static TfLiteStatus InvokeStep(ModelInstance* instance, size_t max_nodes, uint32_t budget_us, bool* done) {
+  *done = false;
+  if (instance->step_node >= instance->step_end) {
+    return kTfLiteError;
+  }
+  uint64_t start_us = ei_read_timer_us();
+  size_t ran = 0;
+  do {
+    TfLiteStatus status = InvokeNode(instance, instance->step_node);
     if (status != kTfLiteOk) {
+      instance->step_node = instance->step_end = 0;
+      instance->step_completed = false;
       return status;
     }
+    instance->step_node++;
+    ran++;
+  } while (instance->step_node < instance->step_end && (max_nodes == 0 || ran < max_nodes) &&
+           (budget_us == 0 || ei_read_timer_us() - start_us < budget_us));
+
+  if (instance->step_node == instance->step_end) {
+    instance->step_node = instance->step_end = 0;
+    instance->step_completed = true;
+    *done = true;
+#if EI_CLASSIFIER_PROFILE_OPS
+    instance->profile_invokes++;
+#endif
   }
   return kTfLiteOk;
 }
 
-TfLiteStatus tflite_learn_864078_5_reset( void (*free_fnc)(void* ptr) ) {
-#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  free_fnc(tensor_arena);
+// Drops the inference InvokeStep was working through
+static void AbortSteps(ModelInstance* instance) {
+  instance->step_node = instance->step_end = 0;
+  instance->step_completed = false;
+#if EI_WEIGHT_STAGING_SIZE > 0
+  if (instance->static_buffers) {
+    // the constants of the node after the last one that ran may be on their way
+    ei_copy_async_wait();
+  }
 #endif
+}
 
+// Runs every node on all instances before moving on to the next node, so the
+// weights of a node are fetched once for the whole batch and stay in cache
+static TfLiteStatus InvokeBatch(ModelInstance** instances, size_t count) {
+  for (size_t b = 0; b < count; ++b) {
+    instances[b]->step_node = instances[b]->step_end = 0;
+    instances[b]->step_completed = false;
+  }
+  for (size_t i = 0; i < 52; ++i) {
+    for (size_t b = 0; b < count; ++b) {
+      TF_LITE_ENSURE_STATUS(InvokeNode(instances[b], i));
+    }
+  }
+#if EI_CLASSIFIER_PROFILE_OPS
+  for (size_t b = 0; b < count; ++b) {
+    instances[b]->profile_invokes++;
+  }
+#endif
+  return kTfLiteOk;
+}
+
+// Frees what init allocated outside the arena; the arena itself is the caller's
+static void ResetInstance(ModelInstance* instance) {
   // scratch buffers are allocated within the arena, so just reset the counter so memory can be reused
-  scratch_buffers_ix = 0;
+  instance->scratch_buffers_ix = 0;
+  instance->scratch_region_bytes = 0;
+  instance->scratch_region = nullptr;
 
   // overflow buffers are on the heap, so free them first
-  for (size_t ix = 0; ix < overflow_buffers_ix; ix++) {
-    ei_free(overflow_buffers[ix]);
+  for (size_t ix = 0; ix < instance->overflow_buffers_ix; ix++) {
+    ei_free(instance->overflow_buffers[ix]);
+  }
+  instance->overflow_buffers_ix = 0;
+  instance->step_node = instance->step_end = 0;
+  instance->step_completed = false;
+#if EI_WEIGHT_STAGING_SIZE > 0
+  if (instance->static_buffers) {
+    // an invoke that failed can leave a copy in flight
+    ei_copy_async_wait();
+  }
+  instance->staged_nodes[0].node = -1;
+  instance->staged_nodes[1].node = -1;
+#endif
+}
+
+#if EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+// Writes the op data of node i; kTfLiteError for a node (or a kernel
+// configuration) that has to be prepared at boot
+static TfLiteStatus WritePreparedNode(ModelInstance* instance, size_t i,
+                                      tflite::PreparedOpDataWriter* writer) {
+  TfLiteContext* ctx = &instance->ctx;
+  TfLiteNode* node = &instance->nodes[i];
+  switch (used_ops[i]) {
+    case OP_CONV_2D:
+      return ConvWritePrepared(ctx, node, writer);
+    case OP_DEPTHWISE_CONV_2D:
+      return DepthwiseConvWritePrepared(ctx, node, writer);
+    case OP_INVERTED_RESIDUAL:
+      return InvertedResidualWritePrepared(ctx, node, writer);
+    case OP_FULLY_CONNECTED:
+      return FullyConnectedWritePrepared(ctx, node, writer);
+    case OP_SOFTMAX:
+      return SoftmaxWritePrepared(ctx, node, writer);
+    default:
+      return kTfLiteError;
+  }
+}
+#endif // EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+
+} // namespace
+
+TfLiteStatus tflite_learn_864078_5_init( void*(*alloc_fnc)(size_t,size_t) ) {
+  ModelInstance* instance = &default_instance;
+  instance->static_buffers = true;
+#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
+  instance->arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
+  if (!instance->arena) {
+    ei_printf("ERR: failed to allocate tensor arena\n");
+    return kTfLiteError;
+  }
+#else
+  instance->arena = tensor_arena;
+  memset(tensor_arena, 0, kTensorArenaSize);
+#endif
+  return InitInstance(instance);
+}
+
+TfLiteStatus tflite_learn_864078_5_input(int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(&default_instance, in_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_output(int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(&default_instance, out_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+// Type, shape and quantization of tensor i from the constant tensor data, no data
+static void DescribeTensor(size_t i, TfLiteTensor *tensor) {
+  memset(tensor, 0, sizeof(TfLiteTensor));
+  tensor->type = tensorData[i].type;
+  tensor->bytes = tensorData[i].bytes;
+  tensor->dims = tensorData[i].dims;
+  tensor->quantization = tensorData[i].quantization;
+  if (tensor->quantization.type == kTfLiteAffineQuantization) {
+    TfLiteAffineQuantization const* quant = ((TfLiteAffineQuantization const*)(tensorData[i].quantization.params));
+    tensor->params.scale = quant->scale->data[0];
+    tensor->params.zero_point = quant->zero_point->data[0];
+  }
+}
+
+TfLiteStatus tflite_learn_864078_5_input_quantization(int index, TfLiteTensor *tensor) {
+  DescribeTensor(in_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_node_shape(size_t index, const char** op, const void** params,
+                                              TfLiteTensor* input, TfLiteTensor* filter, TfLiteTensor* output) {
+  if (index >= sizeof(used_ops) / sizeof(used_ops[0])) {
+    return kTfLiteError;
+  }
+  const TfLiteNode* node = &tflNodes[index];
+  *op = used_op_names[used_ops[index]];
+  *params = node->builtin_data;
+  DescribeTensor(node->inputs->data[0], input);
+  if (node->inputs->size > 1) {
+    DescribeTensor(node->inputs->data[1], filter);
+  }
+  else {
+    memset(filter, 0, sizeof(TfLiteTensor));
+  }
+  DescribeTensor(node->outputs->data[0], output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke() {
+  return InvokeInstance(&default_instance);
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_logits(void* instance) {
+  return InvokeLogits(instance ? static_cast<ModelInstance*>(instance) : &default_instance);
+}
+
+TfLiteStatus tflite_learn_864078_5_logits(void* instance, TfLiteTensor* tensor) {
+  ModelInstance* model = instance ? static_cast<ModelInstance*>(instance) : &default_instance;
+  init_tflite_tensor(model, model->nodes[51].inputs->data[0], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_softmax(void* instance) {
+  return InvokeNode(instance ? static_cast<ModelInstance*>(instance) : &default_instance, 51);
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_start(void* instance, bool logits) {
+  ModelInstance* model = instance ? static_cast<ModelInstance*>(instance) : &default_instance;
+  AbortSteps(model);
+  model->step_end = logits ? 51 : 52;
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_step(void* instance, size_t max_nodes, uint32_t budget_us, bool* done) {
+  return InvokeStep(instance ? static_cast<ModelInstance*>(instance) : &default_instance, max_nodes, budget_us, done);
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_abort(void* instance) {
+  AbortSteps(instance ? static_cast<ModelInstance*>(instance) : &default_instance);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_invoke_completed(void* instance, bool* completed) {
+  *completed = (instance ? static_cast<ModelInstance*>(instance) : &default_instance)->step_completed;
+  return kTfLiteOk;
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+TfLiteStatus tflite_learn_864078_5_profile(ei_model_profile_t* profile) {
+  const ModelInstance* instance = &default_instance;
+  profile->nodes = instance->node_profiles;
+  profile->node_count = 52;
+  profile->invokes = instance->profile_invokes;
+  profile->arena_size = kTensorArenaSize;
+  profile->activation_bytes = instance->profile_activation_bytes;
+  profile->persistent_bytes = instance->profile_persistent_bytes;
+  profile->overflow_bytes = instance->profile_overflow_bytes;
+#if EI_TENSOR_ARENA_FAST_SIZE > 0
+  profile->fast_arena_size = EI_TENSOR_ARENA_FAST_SIZE;
+  profile->fast_arena_bytes = instance->fast_arena_bytes;
+  profile->fast_access_bytes = instance->fast_access_bytes;
+  profile->slow_access_bytes = instance->slow_access_bytes;
+#else
+  profile->fast_arena_size = 0;
+  profile->fast_arena_bytes = 0;
+  profile->fast_access_bytes = 0;
+  profile->slow_access_bytes = 0;
+#endif
+#if EI_WEIGHT_STAGING_SIZE > 0
+  profile->staging_size = EI_WEIGHT_STAGING_SIZE;
+  profile->staged_nodes = instance->staged_node_count;
+  profile->staged_bytes = instance->staged_bytes;
+  profile->staging_wait_us = instance->staging_wait_us;
+#else
+  profile->staging_size = 0;
+  profile->staged_nodes = 0;
+  profile->staged_bytes = 0;
+  profile->staging_wait_us = 0;
+#endif
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_profile_reset() {
+  ModelInstance* instance = &default_instance;
+  for (size_t i = 0; i < 52; ++i) {
+    instance->node_profiles[i].runs = 0;
+    instance->node_profiles[i].last_us = 0;
+    instance->node_profiles[i].max_us = 0;
+    instance->node_profiles[i].total_us = 0;
+    instance->node_profiles[i].total_cycles = 0;
+  }
+  instance->profile_invokes = 0;
+#if EI_WEIGHT_STAGING_SIZE > 0
+  instance->staged_node_count = 0;
+  instance->staged_bytes = 0;
+  instance->staging_wait_us = 0;
+#endif
+  return kTfLiteOk;
+}
+#endif // EI_CLASSIFIER_PROFILE_OPS
+
+#if EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+TfLiteStatus tflite_learn_864078_5_write_prepared(void (*write)(void* user, const char* text), void* user) {
+  ModelInstance* instance = &default_instance;
+  if (!instance->arena) {
+    return kTfLiteError;
+  }
+  tflite::PreparedOpDataWriter writer(write, user);
+  writer.Text("// Op data of tflite_learn_864078_5, prepared on the host (benchmark/eon_prepare).\n"
+              "// Included by tflite_learn_864078_5_compiled.cpp, inside its namespace,\n"
+              "// when EI_CLASSIFIER_PREPARED_OP_DATA is set. Write it again whenever the\n"
+              "// model changes.\n"
+              "#ifndef tflite_learn_864078_5_PREPARED_H\n"
+              "#define tflite_learn_864078_5_PREPARED_H\n\n");
+
+  bool prepared[52];
+  for (size_t i = 0; i < 52; ++i) {
+    ResetTensors(instance);
+    writer.BeginNode((int)i);
+    prepared[i] = WritePreparedNode(instance, i, &writer) == kTfLiteOk;
+  }
+
+  char line[64];
+  writer.Text("const void* const prepared_op_data[52] = {\n");
+  for (size_t i = 0; i < 52; ++i) {
+    if (prepared[i]) {
+      snprintf(line, sizeof(line), "  &node%d_op_data,\n", (int)i);
+    }
+    else {
+      snprintf(line, sizeof(line), "  nullptr,\n");
+    }
+    writer.Text(line);
+  }
+  writer.Text("};\n\n");
+  writer.TensorDataTable("prepared_tensor_data", 248);
+  snprintf(line, sizeof(line), "constexpr int kPreparedArenaBytes = %d;\n\n", (int)writer.ArenaBytes());
+  writer.Text(line);
+  writer.Text("// The model these were written from, checked at init\n");
+  snprintf(line, sizeof(line), "constexpr int kPreparedNodeCount = %d;\n", 52);
+  writer.Text(line);
+  snprintf(line, sizeof(line), "constexpr uint32_t kPreparedShapeSignature = 0x%08x;\n",
+           (unsigned)PreparedShapeSignature());
+  writer.Text(line);
+  snprintf(line, sizeof(line), "constexpr uint32_t kPreparedWeightChecksum = 0x%08x;\n",
+           (unsigned)PreparedWeightChecksum());
+  writer.Text(line);
+  writer.Text("\n#endif // tflite_learn_864078_5_PREPARED_H\n");
+  return kTfLiteOk;
+}
+#endif // EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+
+TfLiteStatus tflite_learn_864078_5_reset( void (*free_fnc)(void* ptr) ) {
+#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
+  free_fnc(default_instance.arena);
+  default_instance.arena = nullptr;
+#endif
+  ResetInstance(&default_instance);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_init(void** instance_ptr, void*(*alloc_fnc)(size_t,size_t) ) {
+  void* memory = alloc_fnc(16, sizeof(ModelInstance));
+  *instance_ptr = memory;
+  if (!memory) {
+    ei_printf("ERR: failed to allocate model instance\n");
+    return kTfLiteError;
+  }
+  ModelInstance* instance = new (memory) ModelInstance();
+  instance->arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
+  if (!instance->arena) {
+    ei_printf("ERR: failed to allocate tensor arena\n");
+    return kTfLiteError;
+  }
+  return InitInstance(instance);
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_input(void* instance, int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(static_cast<ModelInstance*>(instance), in_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_output(void* instance, int index, TfLiteTensor *tensor) {
+  init_tflite_tensor(static_cast<ModelInstance*>(instance), out_tensor_indices[index], tensor);
+  return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_invoke(void* instance) {
+  return InvokeInstance(static_cast<ModelInstance*>(instance));
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_invoke_batch(void** instances, size_t count) {
+  return InvokeBatch(reinterpret_cast<ModelInstance**>(instances), count);
+}
+
+TfLiteStatus tflite_learn_864078_5_instance_reset(void* instance_ptr, void (*free_fnc)(void* ptr) ) {
+  ModelInstance* instance = static_cast<ModelInstance*>(instance_ptr);
+  if (!instance) {
+    return kTfLiteOk;
+  }
+  ResetInstance(instance);
+  if (instance->arena) {
+    free_fnc(instance->arena);
   }
-  overflow_buffers_ix = 0;
+  instance->~ModelInstance();
+  free_fnc(instance);
   return kTfLiteOk;
 }
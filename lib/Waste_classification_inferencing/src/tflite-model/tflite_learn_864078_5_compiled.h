@@ -34,6 +34,8 @@
 #define tflite_learn_864078_5_GEN_H
 
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/classifier/ei_model_profile.h"
 
 // Sets up the model with init and prepare steps.
 TfLiteStatus tflite_learn_864078_5_init( void*(*alloc_fnc)(size_t,size_t) );
@@ -41,10 +43,65 @@ TfLiteStatus tflite_learn_864078_5_init( void*(*alloc_fnc)(size_t,size_t) );
 TfLiteStatus tflite_learn_864078_5_input(int index, TfLiteTensor* tensor);
 // Returns the output tensor with the given index.
 TfLiteStatus tflite_learn_864078_5_output(int index, TfLiteTensor* tensor);
+// Returns type, shape and quantization of the input tensor with the given
+// index, without data. Reads constant data only, the model does not have to
+// be set up and may be invoked on another thread meanwhile.
+TfLiteStatus tflite_learn_864078_5_input_quantization(int index, TfLiteTensor* tensor);
+// Returns the builtin operator of node index (e.g. "CONV_2D"), its builtin
+// params (TfLiteConvParams, ...) and, like input_quantization, the type,
+// shape and quantization of its first two inputs and its output (filter is
+// zeroed for a node with one input). Reads constant data only.
+TfLiteStatus tflite_learn_864078_5_node_shape(size_t index, const char** op, const void** params,
+                                              TfLiteTensor* input, TfLiteTensor* filter, TfLiteTensor* output);
 // Runs inference for the model.
 TfLiteStatus tflite_learn_864078_5_invoke();
+// Runs inference up to the input of the final SOFTMAX (beta 1), the logits, on
+// an instance or on the model above (instance is nullptr).
+TfLiteStatus tflite_learn_864078_5_invoke_logits(void* instance);
+// Returns the logits tensor of an instance or of the model above.
+TfLiteStatus tflite_learn_864078_5_logits(void* instance, TfLiteTensor* tensor);
+// Runs the final SOFTMAX over the logits of invoke_logits, into the output.
+TfLiteStatus tflite_learn_864078_5_invoke_softmax(void* instance);
+// Starts an inference that invoke_step runs a few nodes at a time, over every
+// node or, with logits, up to the logits. Nothing else may invoke the instance
+// until the last step is done or invoke_abort drops it.
+TfLiteStatus tflite_learn_864078_5_invoke_start(void* instance, bool logits);
+// Runs the next nodes of that inference: at most max_nodes (0 for no limit),
+// and no new one once budget_us (0 for none) has gone by; at least one node.
+// *done once the last one has run.
+TfLiteStatus tflite_learn_864078_5_invoke_step(void* instance, size_t max_nodes, uint32_t budget_us, bool* done);
+// Drops the inference invoke_step is working through.
+TfLiteStatus tflite_learn_864078_5_invoke_abort(void* instance);
+// *completed once invoke_step has run the last node of the inference
+// invoke_start began, until the instance is started, aborted or invoked again.
+TfLiteStatus tflite_learn_864078_5_invoke_completed(void* instance, bool* completed);
 //Frees memory allocated
 TfLiteStatus tflite_learn_864078_5_reset( void (*free)(void* ptr) );
+// Sets up another copy of the model, with its own arena and op data, in
+// *instance. The copies and the model above can run at the same time on
+// different threads. Call instance_reset on *instance even when this fails.
+TfLiteStatus tflite_learn_864078_5_instance_init(void** instance, void*(*alloc_fnc)(size_t,size_t) );
+// Returns the input tensor with the given index of an instance.
+TfLiteStatus tflite_learn_864078_5_instance_input(void* instance, int index, TfLiteTensor* tensor);
+// Returns the output tensor with the given index of an instance.
+TfLiteStatus tflite_learn_864078_5_instance_output(void* instance, int index, TfLiteTensor* tensor);
+// Runs inference on an instance.
+TfLiteStatus tflite_learn_864078_5_instance_invoke(void* instance);
+// Runs inference on count instances at once, layer by layer.
+TfLiteStatus tflite_learn_864078_5_instance_invoke_batch(void** instances, size_t count);
+// Frees an instance and everything it allocated.
+TfLiteStatus tflite_learn_864078_5_instance_reset(void* instance, void (*free)(void* ptr) );
+#if EI_CLASSIFIER_PROFILE_OPS
+// Per-node times (since the last profile reset) and arena use of the last init.
+TfLiteStatus tflite_learn_864078_5_profile(ei_model_profile_t* profile);
+// Clears the times.
+TfLiteStatus tflite_learn_864078_5_profile_reset();
+#endif
+#if EI_CLASSIFIER_PREPARED_OP_DATA_WRITER
+// Writes, through write, tflite_learn_864078_5_prepared.h: the op data of the
+// model set up by init, for a build with EI_CLASSIFIER_PREPARED_OP_DATA.
+TfLiteStatus tflite_learn_864078_5_write_prepared(void (*write)(void* user, const char* text), void* user);
+#endif
 
 
 // Returns the number of input tensors.
@@ -55,5 +112,9 @@ inline size_t tflite_learn_864078_5_inputs() {
 inline size_t tflite_learn_864078_5_outputs() {
   return 1;
 }
+// Returns the number of nodes.
+inline size_t tflite_learn_864078_5_nodes() {
+  return 52;
+}
 
 #endif
@@ -1,10 +1,12 @@
 from flask import Flask, request, jsonify, send_from_directory
 from flask_socketio import SocketIO, emit
 from flask_cors import CORS
-from datetime import datetime
+from werkzeug.serving import WSGIRequestHandler
+from datetime import datetime, timedelta
 import pandas as pd
 import os
 import json
+import struct
 
 app = Flask(__name__, static_folder="static", static_url_path="")
 CORS(app)
@@ -19,10 +21,18 @@ CSV_FILE = os.path.join(DATA_DIR, "predictions.csv")
 # Ensure data directory exists
 os.makedirs(DATA_DIR, exist_ok=True)
 
-# Initialize CSV if it doesn't exist
+# count: predictions a record stands for, the device coalesces repeats under backpressure
+CSV_COLUMNS = ["timestamp", "category", "confidence", "device_id", "count"]
+
+# Initialize CSV if it doesn't exist, add the count column to an older one
 if not os.path.exists(CSV_FILE):
-    df = pd.DataFrame(columns=["timestamp", "category", "confidence", "device_id"])
+    df = pd.DataFrame(columns=CSV_COLUMNS)
     df.to_csv(CSV_FILE, index=False)
+else:
+    df = pd.read_csv(CSV_FILE)
+    if "count" not in df.columns:
+        df["count"] = 1
+        df[CSV_COLUMNS].to_csv(CSV_FILE, index=False)
 
 
 @app.route("/")
@@ -31,6 +41,78 @@ def index():
     return send_from_directory("static", "index.html")
 
 
+def store_predictions(items):
+    """Keep, log and broadcast predictions that already carry a timestamp
+
+    Every row is built and written before anything is kept, so a request that
+    fails here stores nothing and can be sent again.
+    """
+    for data in items:
+        data.setdefault("count", 1)
+
+    # Log to CSV with correct column order, raises on a missing or malformed field
+    df = pd.DataFrame(items)
+    df = df[CSV_COLUMNS]
+    df["confidence"] = df["confidence"].astype(float)
+    df["count"] = df["count"].astype(int)
+    df.to_csv(CSV_FILE, mode="a", header=False, index=False)
+
+    predictions_list.extend(items)
+
+    # Keep only last 50 predictions in memory
+    del predictions_list[:-50]
+
+    # Broadcast to all connected clients via WebSocket
+    for data in items:
+        socketio.emit("new_prediction", data)
+
+
+# Binary batch from the ESP32-CAM uplink, see include/uplink.h
+BATCH_HEADER = struct.Struct("<4sBBBBI")
+BATCH_RECORD = struct.Struct("<IIHBB")
+
+
+def parse_batch(body):
+    """Decode a prediction batch into dicts, newest timestamps relative to now"""
+    if len(body) < BATCH_HEADER.size:
+        raise ValueError("batch too short")
+    magic, version, id_length, label_count, record_count, sent_ms = BATCH_HEADER.unpack_from(body)
+    if magic != b"WCB1" or version != 1:
+        raise ValueError("not a version 1 prediction batch")
+
+    offset = BATCH_HEADER.size
+    device_id = body[offset : offset + id_length].decode("utf-8", "replace")
+    offset += id_length
+    labels = []
+    for _ in range(label_count):
+        if offset >= len(body):
+            raise ValueError("truncated label table")
+        length = body[offset]
+        labels.append(body[offset + 1 : offset + 1 + length].decode("utf-8", "replace"))
+        offset += 1 + length
+    if len(body) != offset + record_count * BATCH_RECORD.size:
+        raise ValueError("batch size does not match its record count")
+
+    # device clock is millis(), anchor it at the time the batch arrived
+    now = datetime.now()
+    items = []
+    for sequence, device_ms, confidence, label, count in BATCH_RECORD.iter_unpack(body[offset:]):
+        if label >= label_count:
+            raise ValueError(f"label index {label} out of range")
+        age_ms = (sent_ms - device_ms) & 0xFFFFFFFF
+        items.append(
+            {
+                "timestamp": (now - timedelta(milliseconds=age_ms)).isoformat(),
+                "category": labels[label],
+                "confidence": confidence / 65535.0,
+                "device_id": device_id,
+                "sequence": sequence,
+                "count": count,
+            }
+        )
+    return items
+
+
 @app.route("/api/prediction", methods=["POST"])
 def receive_prediction():
     """Receive prediction from ESP32-CAM"""
@@ -40,20 +122,7 @@ def receive_prediction():
         # Add timestamp
         data["timestamp"] = datetime.now().isoformat()
 
-        # Store in memory
-        predictions_list.append(data)
-
-        # Keep only last 50 predictions in memory
-        if len(predictions_list) > 50:
-            predictions_list.pop(0)
-
-        # Log to CSV with correct column order
-        df = pd.DataFrame([data])
-        df = df[["timestamp", "category", "confidence", "device_id"]]
-        df.to_csv(CSV_FILE, mode="a", header=False, index=False)
-
-        # Broadcast to all connected clients via WebSocket
-        socketio.emit("new_prediction", data)
+        store_predictions([data])
 
         print(f"📊 Received prediction: {data['category']} ({data['confidence']:.2%})")
 
@@ -64,6 +133,23 @@ def receive_prediction():
         return jsonify({"status": "error", "message": str(e)}), 400
 
 
+@app.route("/api/predictions/batch", methods=["POST"])
+def receive_prediction_batch():
+    """Receive a binary batch of predictions from the ESP32-CAM uplink"""
+    try:
+        items = parse_batch(request.get_data())
+        if items:
+            store_predictions(items)
+
+        print(f"📊 Received batch of {len(items)} predictions")
+
+        return jsonify({"status": "success", "received": len(items)}), 200
+
+    except Exception as e:
+        print(f"❌ Error receiving prediction batch: {str(e)}")
+        return jsonify({"status": "error", "message": str(e)}), 400
+
+
 @app.route("/api/predictions", methods=["GET"])
 def get_predictions():
     """Get recent predictions"""
@@ -91,20 +177,23 @@ def get_stats():
                 }
             ), 200
 
-        # Calculate statistics
+        # Calculate statistics, a record counts for every prediction coalesced into it
         df = pd.DataFrame(predictions_list)
+        df["weighted_confidence"] = df["confidence"] * df["count"]
+        by_category = df.groupby("category")[["count", "weighted_confidence"]].sum()
 
-        category_counts = df["category"].value_counts().to_dict()
-        avg_confidence = df["confidence"].mean()
-        most_common = df["category"].mode()[0] if len(df) > 0 else "none"
+        category_counts = {k: int(v) for k, v in by_category["count"].items()}
+        total = int(df["count"].sum())
+        avg_confidence = df["weighted_confidence"].sum() / total
+        most_common = by_category["count"].idxmax()
 
         # Calculate average confidence per category
         avg_confidence_per_category = (
-            df.groupby("category")["confidence"].mean().to_dict()
+            (by_category["weighted_confidence"] / by_category["count"]).to_dict()
         )
 
         stats = {
-            "total_classifications": len(predictions_list),
+            "total_classifications": total,
             "category_counts": category_counts,
             "average_confidence": float(avg_confidence),
             "most_common_category": most_common,
@@ -138,6 +227,9 @@ if __name__ == "__main__":
     print("API: http://localhost:5000/api/*")
     print("=" * 50 + "\n")
 
+    # HTTP/1.1 so the ESP32-CAM uplink can keep its connection open
+    WSGIRequestHandler.protocol_version = "HTTP/1.1"
+
     # Run without the Flask debug reloader and allow Werkzeug explicitly
     socketio.run(
         app,
@@ -1,6 +1,5 @@
 // Category colors and icons
 let espStreamStatus = 'disconnected'; // Stream status tracking
-let snapshotTimer = null; // polling timer for snapshot-based streaming
 
 const categoryColors = {
     'battery': '#FFD700',
@@ -214,50 +213,33 @@ function connectToStream() {
         return;
     }
     
-    const snapshotUrl = (ts) => `http://${espIp}/snapshot?t=${ts}`;
+    const streamUrl = `http://${espIp}/stream`;
     const videoStream = document.getElementById('videoStream');
     const videoOverlay = document.getElementById('videoOverlay');
     
     // Set up stream directly
     updateStreamStatus('connecting');
     
-    // Clear any previous polling timer
-    if (snapshotTimer) {
-        clearInterval(snapshotTimer);
-        snapshotTimer = null;
-    }
-
-    // Start polling snapshots (~10 FPS)
-    const fps = 15; // increase snapshot polling to ~15 FPS
-    const interval = Math.max(40, Math.floor(1000 / fps));
-    
     // First frame handler to hide overlay when an image loads
     videoStream.onload = () => {
         if (espStreamStatus !== 'streaming') {
-            console.log('✅ Snapshot stream connected');
+            console.log('✅ MJPEG stream connected');
         }
         videoOverlay.classList.add('hidden');
         updateStreamStatus('streaming');
     };
 
-    // Error handler: show overlay and stop polling
+    // Error handler: stream refused (too many viewers) or lost
     videoStream.onerror = () => {
         videoOverlay.classList.remove('hidden');
-        videoOverlay.innerHTML = '<p>❌ Failed to fetch snapshot<br>Check IP address and network</p>';
+        videoOverlay.innerHTML = '<p>❌ Failed to open stream<br>Check IP address and network</p>';
         updateStreamStatus('disconnected');
-        if (snapshotTimer) {
-            clearInterval(snapshotTimer);
-            snapshotTimer = null;
-        }
     };
 
-    // Kick off immediately, then poll
-    videoStream.src = snapshotUrl(Date.now());
+    // One long-lived multipart response, the ESP32 pushes every frame.
+    // Cache-bust so reconnecting opens a new stream instead of reusing the old one.
+    videoStream.src = `${streamUrl}?t=${Date.now()}`;
     videoOverlay.classList.add('hidden');
-    snapshotTimer = setInterval(() => {
-        // Bust cache with timestamp
-        videoStream.src = snapshotUrl(Date.now());
-    }, interval);
     
     // Save IP to localStorage
     localStorage.setItem('esp32cam_ip', espIp);
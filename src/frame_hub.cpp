@@ -0,0 +1,84 @@
+#include "frame_hub.h"
+
+FrameHub::FrameHub(uint8_t *memory, size_t frame_capacity)
+    : latest_(nullptr),
+      sequence_(0),
+      requested_(false),
+      published_(0),
+      skipped_busy_(0),
+      skipped_oversize_(0) {
+    for (int ix = 0; ix < FRAME_HUB_FRAMES; ix++) {
+        SharedFrame *frame = &frames_[ix];
+        frame->data = memory + (size_t)ix * frame_capacity;
+        frame->capacity = frame_capacity;
+        frame->length = 0;
+        frame->width = 0;
+        frame->height = 0;
+        frame->sequence = 0;
+        frame->timestamp_ms = 0;
+        frame->refs = 0;
+    }
+}
+
+SharedFrame *FrameHub::publish_begin(size_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (length > frames_[0].capacity) {
+        skipped_oversize_++;
+        return nullptr;
+    }
+    // unreferenced frames are invisible to consumers, the publisher can fill
+    // one without holding the lock
+    for (int ix = 0; ix < FRAME_HUB_FRAMES; ix++) {
+        if (frames_[ix].refs == 0) {
+            frames_[ix].length = length;
+            return &frames_[ix];
+        }
+    }
+    skipped_busy_++;
+    return nullptr;
+}
+
+void FrameHub::publish_end(SharedFrame *frame, uint16_t width, uint16_t height, uint32_t timestamp_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    frame->width = width;
+    frame->height = height;
+    frame->timestamp_ms = timestamp_ms;
+    frame->sequence = ++sequence_;
+    frame->refs = 1;
+
+    if (latest_) {
+        latest_->refs--;
+    }
+    latest_ = frame;
+    published_++;
+}
+
+SharedFrame *FrameHub::acquire(uint32_t newer_than) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!latest_ || latest_->sequence <= newer_than) {
+        return nullptr;
+    }
+    latest_->refs++;
+    return latest_;
+}
+
+void FrameHub::release(SharedFrame *frame) {
+    if (!frame) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame->refs--;
+}
+
+FrameHubStats FrameHub::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    FrameHubStats s;
+    s.published = published_;
+    s.skipped_busy = skipped_busy_;
+    s.skipped_oversize = skipped_oversize_;
+    return s;
+}
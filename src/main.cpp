@@ -6,12 +6,17 @@
 #include <ArduinoJson.h>
 
 // Edge Impulse Model (USER MUST INSTALL THIS LIBRARY FROM EDGE IMPULSE)
+// Inference buffers are sized for the widest frame we classify (FRAMESIZE_QVGA)
+#define EI_INFERENCE_CONTEXT_MAX_IMAGE_WIDTH 320
 #include <Waste_classification_inferencing.h>
 #include "edge-impulse-sdk/dsp/image/image.hpp"
 #include "esp_camera.h"
 
 // Configuration
 #include "config.h" 
+#include "frame_hub.h"
+#include "pipeline.h"
+#include "uplink.h"
 
 /* Camera Model Configuration */
 #define CAMERA_MODEL_AI_THINKER
@@ -39,13 +44,44 @@
 /* Constants */
 #define EI_CAMERA_RAW_FRAME_BUFFER_COLS           320
 #define EI_CAMERA_RAW_FRAME_BUFFER_ROWS           240
-#define EI_CAMERA_FRAME_BYTE_SIZE                 3
 
 /* Global Variables */
 static bool is_initialised = false;
-static uint8_t *snapshot_buf = NULL;
-bool inference_running = true;
-unsigned long lastInferenceTime = 0;
+
+// Output, tensor and DSP scratch buffers of every inference (~30 KB). With
+// the features quantized by the capture stage the model only takes its few
+// output bytes, so it lives in PSRAM (new_psram_context()).
+static ei_inference_context_t *inference_context = NULL;
+// JPEG decoder and resize scratch of the capture stage, which decodes the next
+// frame while the inference stage runs the model. Also in PSRAM, like the JPEG
+// it decodes: internal RAM is left to the model's fast arena and weight
+// staging buffers, WiFi and the camera DMA.
+static ei_inference_context_t *capture_context = NULL;
+// The model stays set up between inferences, so it can run in slices
+static bool model_session = false;
+
+// Capture (core 0) -> inference (core 1) -> report (core 0)
+static Pipeline *pipeline = NULL;
+
+// Every camera frame is grabbed once and shared by streams, snapshots and inference
+static FrameHub *frame_hub = NULL;
+
+#define FRAME_HUB_FRAME_SIZE   (32 * 1024)  // largest QVGA JPEG we keep
+#define FRAME_MAX_AGE_MS       200          // older frames are not served or classified
+#define STREAM_FPS             15
+#define SNAPSHOT_WAIT_MS       300          // a snapshot without a fresh frame waits this long for the camera
+#define STREAM_BOUNDARY        "123456789000000000000987654321"
+
+#define CAMERA_TASK_CORE       0
+#define CAPTURE_TASK_CORE      0
+#define INFERENCE_TASK_CORE    1
+#define REPORT_TASK_CORE       0
+#define UPLINK_TASK_CORE       0
+
+#define INFERENCE_SLICE_US     20000                     // model time between two yields of the inference task
+#define INFERENCE_MAX_AGE_MS   (2 * INFERENCE_INTERVAL)  // a frame still in the model by then is dropped
+
+#define DEVICE_ID "ESP32-CAM-001"
 
 // Classification results for display
 String lastCategory = "Waiting...";
@@ -53,7 +89,7 @@ float lastConfidence = 0.0;
 unsigned long lastClassificationTime = 0;
 
 // Stream management
-static uint8_t active_streams = 0;
+static std::atomic<uint8_t> active_streams(0);
 const uint8_t MAX_STREAMS = 2;  // Limit concurrent streams
 
 AsyncWebServer server(80);
@@ -113,39 +149,96 @@ void ei_camera_deinit(void) {
 }
 
 /* Camera Capture */
-bool ei_camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf) {
+// Returns the JPEG frame as is, the caller hands it back with
+// esp_camera_fb_return(). Only the camera task calls this.
+camera_fb_t *ei_camera_capture(void) {
     camera_fb_t *fb = esp_camera_fb_get();
     if (!fb) {
         Serial.println("Camera capture failed");
-        return false;
+        return NULL;
     }
 
-    bool converted = fmt2rgb888(fb->buf, fb->len, fb->format, out_buf);
-    esp_camera_fb_return(fb);
-    
-    if (!converted) {
-        Serial.println("Conversion failed");
-        return false;
+    if (fb->format != PIXFORMAT_JPEG) {
+        Serial.println("Unexpected frame format");
+        esp_camera_fb_return(fb);
+        return NULL;
     }
-    
-    return true;
+
+    return fb;
+}
+
+/* Edge Impulse Image Source */
+// The classifier decodes the JPEG at 1/2 scale (DCT scaling), only transforms
+// the blocks inside the model crop, and resizes and quantizes the rows as they
+// come out of the decoder. No full size RGB888 frame is ever allocated.
+static ei::image_source_t ei_camera_get_image(const SharedFrame *frame) {
+    ei::image_source_t image;
+    image.buffer = frame->data;
+    image.width = frame->width;
+    image.height = frame->height;
+    image.stride = 0;
+    image.format = ei::EI_IMAGE_SOURCE_JPEG;
+    image.size = frame->length;
+    return image;
 }
 
-/* Edge Impulse Data Callback */
-static int ei_camera_get_data(size_t offset, size_t length, float *out_ptr) {
-    size_t pixel_ix = offset * 3;
-    size_t bytes_left = length;
-    size_t out_ptr_ix = 0;
-
-    while (bytes_left != 0) {
-        out_ptr[out_ptr_ix] = (snapshot_buf[pixel_ix] << 16) + 
-                              (snapshot_buf[pixel_ix + 1] << 8) + 
-                              snapshot_buf[pixel_ix + 2];
-        out_ptr_ix++;
-        pixel_ix += 3;
-        bytes_left--;
-    }
-    return 0;
+/* Camera Task */
+// The only user of the camera. Grabs at STREAM_FPS while someone streams and
+// otherwise only when asked (capture stage, snapshots). The JPEG is copied
+// into the frame hub and the camera buffer handed back right away.
+static void camera_task(void *arg) {
+    uint32_t last_stream_ms = 0;
+    for (;;) {
+        bool requested = frame_hub->take_request();
+        bool stream_due = active_streams > 0 && millis() - last_stream_ms >= 1000 / STREAM_FPS;
+        if (!requested && !stream_due) {
+            vTaskDelay(pdMS_TO_TICKS(5));
+            continue;
+        }
+        if (stream_due) {
+            last_stream_ms = millis();
+        }
+
+        camera_fb_t *fb = ei_camera_capture();
+        if (!fb) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        SharedFrame *frame = frame_hub->publish_begin(fb->len);
+        if (frame) {
+            memcpy(frame->data, fb->buf, fb->len);
+            frame_hub->publish_end(frame, fb->width, fb->height, millis());
+        }
+        esp_camera_fb_return(fb);
+    }
+}
+
+// The latest frame newer than sequence and at most FRAME_MAX_AGE_MS old, or
+// NULL after asking the camera task for one. Never waits. Release it with
+// frame_hub->release().
+static SharedFrame *acquire_fresh_frame(uint32_t newer_than) {
+    SharedFrame *frame = frame_hub->acquire(newer_than);
+    if (frame && millis() - frame->timestamp_ms <= FRAME_MAX_AGE_MS) {
+        return frame;
+    }
+    frame_hub->release(frame);
+    if (active_streams == 0) {
+        frame_hub->request();
+    }
+    return NULL;
+}
+
+// acquire_fresh_frame(), waiting up to wait_ms for the camera task. Never in
+// the async_tcp task.
+static SharedFrame *wait_fresh_frame(uint32_t newer_than, uint32_t wait_ms) {
+    uint32_t start = millis();
+    for (;;) {
+        SharedFrame *frame = acquire_fresh_frame(newer_than);
+        if (frame || millis() - start >= wait_ms) {
+            return frame;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
 }
 
 /* WiFi Setup */
@@ -179,90 +272,207 @@ void setupWiFi() {
     }
 }
 
-/* Camera Snapshot Handler (Simple, Working Approach) */
-void handleSnapshot(AsyncWebServerRequest *request) {
-    camera_fb_t * fb = esp_camera_fb_get();
-    if(!fb){
-        request->send(503, "text/plain", "Camera capture failed");
-        return;
+/* Stream and Snapshot Responses */
+// One per client. The response pulls from the frame hub: every new frame goes
+// out as one multipart part (or, for a snapshot, as the whole body), straight
+// from the shared buffer, and is released once the last byte is handed over.
+struct FrameClient {
+    SharedFrame *frame;
+    uint32_t sequence;      // last frame sent
+    size_t sent;            // bytes of the current part
+    char header[128];
+    size_t header_length;
+    uint32_t started_ms;
+    bool snapshot;
+    bool done;
+};
+
+static size_t copy_part(const uint8_t *part, size_t part_length, size_t &offset,
+                        uint8_t *&buffer, size_t &space) {
+    if (offset >= part_length) {
+        offset -= part_length;
+        return 0;
     }
-    
-    AsyncWebServerResponse *response = request->beginResponse_P(
-        200,
-        "image/jpeg",
-        fb->buf,
-        fb->len
-    );
-    
+    size_t n = part_length - offset;
+    if (n > space) {
+        n = space;
+    }
+    memcpy(buffer, part + offset, n);
+    buffer += n;
+    space -= n;
+    offset = 0;
+    return n;
+}
+
+static size_t fill_frame_response(FrameClient *client, uint8_t *buffer, size_t max_length) {
+    if (client->done) {
+        return 0;
+    }
+
+    if (!client->frame) {
+        // runs in the async_tcp task with every other connection, never wait
+        // here. The web server asks again on the next ack or on lwIP's poll,
+        // every 500 ms
+        client->frame = acquire_fresh_frame(client->sequence);
+        if (!client->frame && client->snapshot && millis() - client->started_ms >= SNAPSHOT_WAIT_MS) {
+            // no fresh frame in time, the latest there is will do
+            client->frame = frame_hub->acquire(0);
+        }
+        if (!client->frame) {
+            return RESPONSE_TRY_AGAIN;
+        }
+        client->sequence = client->frame->sequence;
+        client->sent = 0;
+        client->header_length = 0;
+        if (!client->snapshot) {
+            client->header_length = snprintf(client->header, sizeof(client->header),
+                "--" STREAM_BOUNDARY "\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %u\r\n\r\n",
+                (unsigned)client->frame->length, (unsigned)client->frame->timestamp_ms);
+        }
+    }
+
+    static const char trailer[] = "\r\n";
+    size_t trailer_length = client->snapshot ? 0 : sizeof(trailer) - 1;
+    size_t space = max_length;
+    size_t offset = client->sent;
+    size_t n = 0;
+    n += copy_part((const uint8_t *)client->header, client->header_length, offset, buffer, space);
+    n += copy_part(client->frame->data, client->frame->length, offset, buffer, space);
+    n += copy_part((const uint8_t *)trailer, trailer_length, offset, buffer, space);
+    client->sent += n;
+
+    if (client->sent == client->header_length + client->frame->length + trailer_length) {
+        frame_hub->release(client->frame);
+        client->frame = NULL;
+        client->done = client->snapshot;
+    }
+    return n;
+}
+
+// A snapshot comes with its frame, or waits for the next one; a stream picks
+// them up as they arrive
+static void beginFrameResponse(AsyncWebServerRequest *request, bool snapshot, SharedFrame *frame) {
+    FrameClient *client = new FrameClient();
+    client->snapshot = snapshot;
+    client->started_ms = millis();
+    if (frame) {
+        client->frame = frame;
+        client->sequence = frame->sequence;
+    }
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+        snapshot ? "image/jpeg" : "multipart/x-mixed-replace;boundary=" STREAM_BOUNDARY,
+        [client](uint8_t *buffer, size_t max_length, size_t index) -> size_t {
+            return fill_frame_response(client, buffer, max_length);
+        });
     response->addHeader("Access-Control-Allow-Origin", "*");
     response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    
+
+    // the response (and its fill callback) is gone once the request disconnects
+    request->onDisconnect([client]() {
+        frame_hub->release(client->frame);
+        if (!client->snapshot) {
+            active_streams--;
+        }
+        delete client;
+    });
     request->send(response);
-    esp_camera_fb_return(fb);
-    
-    Serial.println("📷 Snapshot served");
 }
 
-/* MJPEG Stream - iframe/multipart approach */
+/* Camera Snapshot Handler */
+// Never waits in the handler. A fresh frame goes out right away; otherwise the
+// response waits for the capture the camera task was asked for, and once
+// SNAPSHOT_WAIT_MS have passed (checked on lwIP's poll) sends the latest frame
+// there is. 503 until the camera has delivered its first frame.
+void handleSnapshot(AsyncWebServerRequest *request) {
+    SharedFrame *frame = acquire_fresh_frame(0);
+    if (!frame && frame_hub->stats().published == 0) {
+        request->send(503, "text/plain", "Camera capture failed");
+        return;
+    }
+    beginFrameResponse(request, true, frame);
+}
+
+/* MJPEG Stream */
+// multipart/x-mixed-replace at up to STREAM_FPS, every client is sent the same
+// shared frames; open it directly in an <img> tag
 void handleStream(AsyncWebServerRequest *request) {
-    request->send(200, "text/html", 
-        "<html><body style='margin:0'>"
-        "<img id='stream' style='width:100%; height:100%; object-fit:contain'>"
-        "<script>"
-        "function refreshImage(){"
-        "  document.getElementById('stream').src='/snapshot?t='+Date.now();"
-        "  setTimeout(refreshImage, 100);"  // 10 FPS
-        "}"
-        "refreshImage();"
-        "</script>"
-        "</body></html>");
+    if (active_streams >= MAX_STREAMS) {
+        request->send(503, "text/plain", "Too many streams");
+        return;
+    }
+    active_streams++;
+    beginFrameResponse(request, false, NULL);
 }
 
-/* Send Prediction to Flask Backend */
-void sendPredictionToBackend(String category, float confidence) {
+/* Prediction Uplink */
+// Batches of binary prediction records go to /api/predictions/batch over one
+// kept-alive connection, from their own task. The report stage only queues.
+static WiFiClient uplink_client;
+static HTTPClient uplink_http;
+
+static UplinkSendResult uplink_send(void *user, const uint8_t *batch, size_t length) {
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("WiFi not connected, skipping backend send");
-        return;
+        return UPLINK_FAILED;
     }
-    
-    HTTPClient http;
-    String url = "http://" + String(BACKEND_HOST) + ":" + String(BACKEND_PORT) + "/api/prediction";
-    
-    http.begin(url);
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(3000);
-    
-    StaticJsonDocument<256> doc;
-    doc["category"] = category;
-    doc["confidence"] = confidence;
-    doc["device_id"] = "ESP32-CAM-001";
-    doc["timestamp"] = millis();
-    
-    String jsonString;
-    serializeJson(doc, jsonString);
-    
-    int httpCode = http.POST(jsonString);
-    
+
+    // begin() on a client that is still connected reuses the connection
+    uplink_http.setReuse(true);
+    if (!uplink_http.begin(uplink_client, BACKEND_HOST, BACKEND_PORT, "/api/predictions/batch")) {
+        return UPLINK_FAILED;
+    }
+    uplink_http.setTimeout(3000);
+    uplink_http.addHeader("Content-Type", "application/octet-stream");
+
+    int httpCode = uplink_http.POST((uint8_t *)batch, length);
     if (httpCode > 0) {
-        Serial.printf("✓ Sent to backend: %d\n", httpCode);
-        if (httpCode == 200) {
-            String response = http.getString();
-            Serial.println("Response: " + response);
-        }
+        // read the body so the connection can carry the next batch
+        uplink_http.getString();
     } else {
-        Serial.printf("✗ Backend send failed: %s\n", http.errorToString(httpCode).c_str());
+        Serial.printf("✗ Backend send failed: %s\n", uplink_http.errorToString(httpCode).c_str());
     }
-    
-    http.end();
+    uplink_http.end();
+
+    if (httpCode >= 200 && httpCode < 300) {
+        return UPLINK_SENT;
+    }
+    // the same batch would be refused again, only transport and server errors are worth a retry
+    if (httpCode >= 400 && httpCode < 500) {
+        Serial.printf("✗ Backend rejected batch: HTTP %d\n", httpCode);
+        return UPLINK_REJECTED;
+    }
+    return UPLINK_FAILED;
+}
+
+static void uplink_idle(void *user) {
+    vTaskDelay(pdMS_TO_TICKS(20));
+}
+
+static uint32_t uplink_now_ms(void *user) {
+    return millis();
 }
 
+static const UplinkTransport uplink_transport = { uplink_send, uplink_idle, uplink_now_ms, NULL };
+static Uplink uplink(uplink_transport, DEVICE_ID, ei_classifier_inferencing_categories, EI_CLASSIFIER_LABEL_COUNT);
+
+static void uplink_task(void *arg) {
+    ((Uplink *)arg)->run();
+    vTaskDelete(NULL);
+}
+
+#if EI_CLASSIFIER_PROFILE_OPS
+static void append_text(void *user, const char *text) {
+    ((String *)user)->concat(text);
+}
+#endif
+
 /* Web Server Setup */
 void setupWebServer() {
     // Root endpoint
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
         String html = "<html><body>";
         html += "<h1>ESP32-CAM Waste Classifier</h1>";
-        html += "<p>Status: " + String(inference_running ? "Running" : "Paused") + "</p>";
+        html += "<p>Status: " + String(pipeline->paused() ? "Paused" : "Running") + "</p>";
         html += "<p>WiFi: " + WiFi.localIP().toString() + "</p>";
         html += "<p><a href='/stream'>View Stream</a></p>";
         html += "<p>Dashboard: http://" + String(BACKEND_HOST) + ":" + String(BACKEND_PORT) + "</p>";
@@ -270,7 +480,7 @@ void setupWebServer() {
         request->send(200, "text/html", html);
     });
     
-    // Stream endpoint (Motion JPEG polling)
+    // Stream endpoint (multipart MJPEG)
     server.on("/stream", HTTP_GET, handleStream);
     
     // Snapshot endpoint (single JPEG image)
@@ -279,7 +489,7 @@ void setupWebServer() {
     // Status endpoint
     server.on("/status", HTTP_GET, [](AsyncWebServerRequest *request){
         StaticJsonDocument<256> doc;
-        doc["status"] = inference_running ? "running" : "paused";
+        doc["status"] = pipeline->paused() ? "paused" : "running";
         doc["wifi"] = WiFi.status() == WL_CONNECTED;
         doc["ip"] = WiFi.localIP().toString();
         doc["uptime"] = millis();
@@ -310,10 +520,230 @@ void setupWebServer() {
         request->send(response);
     });
     
+#if EI_CLASSIFIER_PROFILE_OPS
+    // Per-operator profile of the model: summary, ?format=csv, ?reset=1 to clear
+    server.on("/profile", HTTP_GET, [](AsyncWebServerRequest *request){
+        if (request->hasParam("reset")) {
+            run_classifier_reset_profile();
+            request->send(200, "text/plain", "Profile cleared\n");
+            return;
+        }
+        ei_model_profile_t profile;
+        if (run_classifier_get_profile(&profile) != EI_IMPULSE_OK) {
+            request->send(500, "text/plain", "No profile\n");
+            return;
+        }
+        // read while inference keeps running, a node may be one run ahead
+        String text;
+        bool csv = request->hasParam("format") && request->getParam("format")->value() == "csv";
+        if (csv) {
+            ei_profile_write_csv(&profile, append_text, &text);
+        }
+        else {
+            ei_profile_write_summary(&profile, append_text, &text);
+        }
+        AsyncWebServerResponse *response = request->beginResponse(200, csv ? "text/csv" : "text/plain", text);
+        response->addHeader("Access-Control-Allow-Origin", "*");
+        request->send(response);
+    });
+#endif
+
     server.begin();
     Serial.println("✓ Web server started");
 }
 
+/* Pipeline Stages */
+// Capture: grab a frame and decode/quantize it into a feature slot. The camera
+// buffer goes back to the driver right away, the slot holds all the model needs.
+static bool capture_stage(void *user, int8_t *features, size_t features_size, PipelineFrameInfo *info) {
+    // the same frame the streams get, never an older one than last time
+    static uint32_t last_sequence = 0;
+    SharedFrame *frame = wait_fresh_frame(last_sequence, 1000);
+    if (!frame) {
+        Serial.println("Camera capture failed");
+        return false;
+    }
+    last_sequence = frame->sequence;
+
+    ei::image_source_t image = ei_camera_get_image(frame);
+    uint64_t dsp_us = 0;
+    EI_IMPULSE_ERROR res = run_classifier_quantize_image(&image, features, features_size, capture_context, &dsp_us);
+    frame_hub->release(frame);
+
+    if (res != EI_IMPULSE_OK) {
+        Serial.printf("✗ Preprocessing failed: %d\n", res);
+        return false;
+    }
+    info->dsp_us = (uint32_t)dsp_us;
+    return true;
+}
+
+// Inference: run the model over a slot and pick the best label. The model runs
+// in slices of INFERENCE_SLICE_US and gives the core up for a tick after each,
+// so the web server and the idle task on core 1 are not starved; a frame that
+// is still in the model INFERENCE_MAX_AGE_MS after capture is dropped midway.
+// The decision against CONFIDENCE_THRESHOLD is made on the quantized logits;
+// only the detections (and frames too close to call) get their probability.
+static bool inference_stage(void *user, const int8_t *features, size_t features_size, PipelinePrediction *prediction) {
+    ei_impulse_result_t result = {0};
+    ei_impulse_decision_t decision;
+    EI_IMPULSE_ERROR res;
+    if (model_session) {
+        res = run_classifier_start_quantized(features, features_size, &result, false);
+        bool done = false;
+        while (res == EI_IMPULSE_OK && !done) {
+            if (millis() - prediction->captured_ms > INFERENCE_MAX_AGE_MS) {
+                run_classifier_abort();
+                Serial.printf("✗ Frame %u went stale in the model, dropped\n", prediction->sequence);
+                prediction->error = EI_IMPULSE_CANCELED;
+                return false;
+            }
+            res = run_classifier_step(0, INFERENCE_SLICE_US, &done, &result);
+            if (res == EI_IMPULSE_OK && !done) {
+                vTaskDelay(1);
+            }
+        }
+        if (res == EI_IMPULSE_OK) {
+            res = run_classifier_finish_decide_quantized(CONFIDENCE_THRESHOLD, true, &decision, &result, false);
+        }
+    } else {
+        res = run_classifier_decide_quantized(features, features_size, CONFIDENCE_THRESHOLD, true,
+            &decision, &result, false);
+    }
+    prediction->error = res;
+    if (res != EI_IMPULSE_OK) {
+        Serial.printf("✗ Classifier failed: %d\n", res);
+        return false;
+    }
+    prediction->classification_us = (uint32_t)result.timing.classification_us;
+
+    prediction->label = decision.label;
+    prediction->detected = decision.above_threshold;
+    prediction->confidence = decision.probabilities ? result.classification[decision.label].value : -1;
+    return true;
+}
+
+// Report: everything slow that does not need the model, off the inference core
+static void report_stage(void *user, const PipelinePrediction *prediction) {
+    Serial.printf("\n📸 Frame %u: decode %u ms, inference %u ms, latency %u ms\n",
+        prediction->sequence, prediction->dsp_us / 1000, prediction->classification_us / 1000,
+        prediction->classified_ms - prediction->captured_ms);
+
+    if (prediction->label < 0) {
+        return;
+    }
+    const char *best_category = ei_classifier_inferencing_categories[prediction->label];
+    float best_confidence = prediction->confidence;
+
+    // Display and send best prediction
+    if (prediction->detected) {
+        Serial.printf("✓ DETECTED: %s (%.1f%% confidence)\n", 
+                     best_category, 
+                     best_confidence * 100);
+        
+        // Update global for stream display
+        lastCategory = best_category;
+        lastConfidence = best_confidence;
+        lastClassificationTime = millis();
+        
+        // Queue for the web dashboard, the uplink task sends it
+        uplink.submit(prediction->sequence, prediction->captured_ms, prediction->label, best_confidence);
+        
+        // Blink LED, only holds up the next report
+        for(int i = 0; i < 3; i++) {
+            digitalWrite(STATUS_LED, LOW);
+            vTaskDelay(pdMS_TO_TICKS(100));
+            digitalWrite(STATUS_LED, HIGH);
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+    } else {
+        // the probability of a clear miss is never worked out
+        if (best_confidence >= 0) {
+            Serial.printf("✗ Low confidence: %s %.1f%% (threshold: %.1f%%)\n", 
+                         best_category,
+                         best_confidence * 100, 
+                         CONFIDENCE_THRESHOLD * 100);
+        } else {
+            Serial.printf("✗ Low confidence: %s (threshold: %.1f%%)\n",
+                         best_category,
+                         CONFIDENCE_THRESHOLD * 100);
+        }
+        
+        // Update global even for low confidence
+        lastCategory = "Low confidence";
+        lastConfidence = best_confidence >= 0 ? best_confidence : 0;
+        lastClassificationTime = millis();
+    }
+}
+
+static void pipeline_idle(void *user) {
+    vTaskDelay(pdMS_TO_TICKS(5));
+}
+
+static uint32_t pipeline_now_ms(void *user) {
+    return millis();
+}
+
+static void capture_task(void *arg) {
+    ((Pipeline *)arg)->run_capture();
+    vTaskDelete(NULL);
+}
+
+static void inference_task(void *arg) {
+    ((Pipeline *)arg)->run_inference();
+    vTaskDelete(NULL);
+}
+
+static void report_task(void *arg) {
+    ((Pipeline *)arg)->run_report();
+    vTaskDelete(NULL);
+}
+
+/* Inference Contexts */
+// An inference context constructed in PSRAM, NULL without PSRAM. Never freed.
+// ps_malloc() only guarantees 4 byte alignment, so the block is aligned here.
+static ei_inference_context_t *new_psram_context() {
+    const size_t align = alignof(ei_inference_context_t);
+    uint8_t *memory = (uint8_t *)ps_malloc(sizeof(ei_inference_context_t) + align - 1);
+    if (!memory) {
+        return NULL;
+    }
+    uintptr_t aligned = ((uintptr_t)memory + align - 1) & ~(uintptr_t)(align - 1);
+    return new ((void *)aligned) ei_inference_context_t();
+}
+
+/* Pipeline Setup */
+// Frame pool (5 x 32 KB) and two feature slots (2 x 27 KB) in PSRAM, then the
+// camera task and one task per stage
+bool setupPipeline() {
+    uint8_t *frames = (uint8_t *)ps_malloc(FRAME_HUB_FRAMES * FRAME_HUB_FRAME_SIZE);
+    if (!frames) {
+        return false;
+    }
+    frame_hub = new FrameHub(frames, FRAME_HUB_FRAME_SIZE);
+
+    const size_t slot_size = EI_CLASSIFIER_NN_INPUT_FRAME_SIZE;
+    int8_t *slots = (int8_t *)ps_malloc(PIPELINE_SLOTS * slot_size);
+    if (!slots) {
+        return false;
+    }
+
+    static const PipelineStages stages = {
+        capture_stage, inference_stage, report_stage, pipeline_idle, pipeline_now_ms, NULL
+    };
+    pipeline = new Pipeline(stages, slots, slot_size);
+    pipeline->set_interval(INFERENCE_INTERVAL);
+
+    // WiFi lives on core 0, the model gets core 1 (and, for the big kernels, a
+    // worker task on core 0 above these, see EI_PARALLEL_TASK_PRIORITY)
+    xTaskCreatePinnedToCore(camera_task, "camera", 4096, NULL, 2, NULL, CAMERA_TASK_CORE);
+    xTaskCreatePinnedToCore(capture_task, "capture", 8192, pipeline, 2, NULL, CAPTURE_TASK_CORE);
+    xTaskCreatePinnedToCore(inference_task, "inference", 12288, pipeline, 1, NULL, INFERENCE_TASK_CORE);
+    xTaskCreatePinnedToCore(report_task, "report", 4096, pipeline, 1, NULL, REPORT_TASK_CORE);
+    xTaskCreatePinnedToCore(uplink_task, "uplink", 8192, &uplink, 1, NULL, UPLINK_TASK_CORE);
+    return true;
+}
+
 /* Arduino Setup */
 void setup() {
     Serial.begin(115200);
@@ -340,10 +770,44 @@ void setup() {
         }
     }
     Serial.println("✓ Camera initialized");
-    
+
+    // Keep the model arena allocated and the kernels prepared across inferences
+    Serial.println("Loading model...");
+    EI_IMPULSE_ERROR session_res = run_classifier_open_session();
+    if (session_res != EI_IMPULSE_OK) {
+        Serial.printf("✗ Model session failed (%d), initializing per inference\n", session_res);
+    } else {
+        model_session = true;
+        Serial.println("✓ Model loaded");
+    }
+
+    // Per-inference buffers come from a fixed pool, no heap churn in the loop
+    inference_context = new_psram_context();
+    capture_context = new_psram_context();
+    if (!inference_context || !capture_context) {
+        Serial.println("✗ Inference contexts do not fit in PSRAM!");
+        while(1) { 
+            digitalWrite(STATUS_LED, !digitalRead(STATUS_LED));
+            delay(200); 
+        }
+    }
+    run_classifier_set_context(inference_context);
+    Serial.printf("✓ Inference contexts: 2 x %u bytes in PSRAM, free heap %u\n",
+        (unsigned)ei_inference_context_t::footprint(), ESP.getFreeHeap());
+
     // Setup WiFi
     setupWiFi();
     
+    // Start capture, inference and reporting
+    if (!setupPipeline()) {
+        Serial.println("✗ Pipeline setup failed!");
+        while(1) { 
+            digitalWrite(STATUS_LED, !digitalRead(STATUS_LED));
+            delay(200); 
+        }
+    }
+    Serial.println("✓ Pipeline started");
+
     // Setup web server
     if (WiFi.status() == WL_CONNECTED) {
         setupWebServer();
@@ -352,8 +816,6 @@ void setup() {
     Serial.println("\n=== System Ready ===");
     Serial.println("Commands: pause, resume, status, reset");
     Serial.println("Point camera at waste item...\n");
-    
-    lastInferenceTime = millis();
 }
 
 /* Arduino Loop */
@@ -365,24 +827,60 @@ void loop() {
         command.toLowerCase();
         
         if (command == "pause") {
-            inference_running = false;
+            pipeline->set_paused(true);
             Serial.println(">>> Inference PAUSED");
         } 
         else if (command == "resume") {
-            inference_running = true;
+            pipeline->set_paused(false);
             Serial.println(">>> Inference RESUMED");
         }
         else if (command == "status") {
             Serial.println("\n=== System Status ===");
-            Serial.printf("Inference: %s\n", inference_running ? "RUNNING" : "PAUSED");
+            Serial.printf("Inference: %s\n", pipeline->paused() ? "PAUSED" : "RUNNING");
             Serial.printf("WiFi: %s\n", WiFi.status() == WL_CONNECTED ? "Connected" : "Disconnected");
             if (WiFi.status() == WL_CONNECTED) {
                 Serial.printf("IP Address: %s\n", WiFi.localIP().toString().c_str());
                 Serial.printf("Stream: http://%s/stream\n", WiFi.localIP().toString().c_str());
             }
             Serial.printf("Uptime: %lu ms\n", millis());
+            Serial.printf("Inference context: %u bytes, scratch peak %u, overflows %u\n",
+                (unsigned)inference_context->footprint(), (unsigned)inference_context->scratch_peak(),
+                (unsigned)inference_context->overflow_count());
+            PipelineStats stats = pipeline->stats();
+            Serial.printf("Frames: %u captured (%u failed), %u classified (%u failed), %u reported (%u dropped)\n",
+                stats.captured, stats.capture_failed, stats.inferred, stats.inference_failed,
+                stats.reported, stats.dropped);
+            Serial.printf("Queues: capture waited %u times, ready depth max %u, report depth max %u\n",
+                stats.capture_waits, stats.ready_max_depth, stats.report_max_depth);
+            FrameHubStats frame_stats = frame_hub->stats();
+            Serial.printf("Camera: %u frames, %u skipped (pool busy), %u too large, %u streams\n",
+                frame_stats.published, frame_stats.skipped_busy, frame_stats.skipped_oversize,
+                (unsigned)active_streams);
+            UplinkStats uplink_stats = uplink.stats();
+            Serial.printf("Uplink: %u queued, %u sent in %u batches, %u coalesced, %u dropped, %u failed sends\n",
+                uplink_stats.submitted, uplink_stats.sent, uplink_stats.batches, uplink_stats.coalesced,
+                uplink_stats.dropped, uplink_stats.failures);
+            Serial.printf("Free heap: %u, free PSRAM: %u\n", ESP.getFreeHeap(), ESP.getFreePsram());
             Serial.println("====================\n");
         }
+#if EI_CLASSIFIER_PROFILE_OPS
+        else if (command.startsWith("profile")) {
+            ei_model_profile_t profile;
+            if (command == "profile reset") {
+                run_classifier_reset_profile();
+                Serial.println(">>> Profile cleared");
+            }
+            else if (run_classifier_get_profile(&profile) != EI_IMPULSE_OK) {
+                Serial.println(">>> No profile");
+            }
+            else if (command == "profile csv") {
+                ei_profile_print_csv(&profile);
+            }
+            else {
+                ei_profile_print_summary(&profile);
+            }
+        }
+#endif
         else if (command == "reset") {
             Serial.println(">>> Resetting ESP32...");
             delay(500);
@@ -393,6 +891,9 @@ void loop() {
             Serial.println("pause  - Stop inference");
             Serial.println("resume - Start inference");
             Serial.println("status - Show system info");
+#if EI_CLASSIFIER_PROFILE_OPS
+            Serial.println("profile [csv|reset] - Per-operator model times");
+#endif
             Serial.println("reset  - Restart ESP32");
             Serial.println("help   - Show this help");
             Serial.println("========================\n");
@@ -412,119 +913,6 @@ void loop() {
         }
     }
 
-    // Skip inference if paused or interval not reached
-    if (!inference_running) {
-        delay(100);
-        return;
-    }
-
-    if (millis() - lastInferenceTime < INFERENCE_INTERVAL) {
-        delay(10);
-        return;
-    }
-
-    lastInferenceTime = millis();
-
-    // ====================================================================
-    // REAL EDGE IMPULSE INFERENCE (Not simulated!)
-    // ====================================================================
-    
-    Serial.println("\n📸 Capturing image and running inference...");
-    
-    // Allocate snapshot buffer
-    snapshot_buf = (uint8_t*)malloc(EI_CAMERA_RAW_FRAME_BUFFER_COLS * 
-                                     EI_CAMERA_RAW_FRAME_BUFFER_ROWS * 
-                                     EI_CAMERA_FRAME_BYTE_SIZE);
-
-    if (!snapshot_buf) {
-        Serial.println("✗ Memory allocation failed!");
-        delay(1000);
-        return;
-    }
-
-    // Capture image
-    if (!ei_camera_capture((size_t)EI_CLASSIFIER_INPUT_WIDTH, 
-                           (size_t)EI_CLASSIFIER_INPUT_HEIGHT, 
-                           snapshot_buf)) {
-        free(snapshot_buf);
-        delay(1000);
-        return;
-    }
-
-    // Prepare signal for Edge Impulse
-    ei::signal_t signal;
-    signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
-    signal.get_data = &ei_camera_get_data;
-
-    // Run classifier
-    ei_impulse_result_t result = {0};
-    EI_IMPULSE_ERROR res = run_classifier(&signal, &result, false);
-
-    if (res != EI_IMPULSE_OK) {
-        Serial.printf("✗ Classifier failed: %d\n", res);
-        free(snapshot_buf);
-        delay(1000);
-        return;
-    }
-
-    // Process classification results
-    Serial.println("\n=== Classification Results ===");
-    
-    float best_confidence = 0;
-    int best_index = -1;
-    String best_category = "";
-    
-    // Print all predictions
-    for (size_t ix = 0; ix < EI_CLASSIFIER_LABEL_COUNT; ix++) {
-        float confidence = result.classification[ix].value;
-        String label = String(result.classification[ix].label);
-        
-        Serial.printf("  %s: %.2f%%\n", label.c_str(), confidence * 100);
-        
-        if (confidence > best_confidence) {
-            best_confidence = confidence;
-            best_index = ix;
-            best_category = label;
-        }
-    }
-
-    Serial.println("==============================");
-
-    // Display and send best prediction
-    if (best_confidence > CONFIDENCE_THRESHOLD) {
-        Serial.printf("\n✓ DETECTED: %s (%.1f%% confidence)\n", 
-                     best_category.c_str(), 
-                     best_confidence * 100);
-        
-        // Update global for stream display
-        lastCategory = best_category;
-        lastConfidence = best_confidence;
-        lastClassificationTime = millis();
-        
-        // Send to web dashboard
-        sendPredictionToBackend(best_category, best_confidence);
-        
-        // Blink LED
-        for(int i = 0; i < 3; i++) {
-            digitalWrite(STATUS_LED, LOW);
-            delay(100);
-            digitalWrite(STATUS_LED, HIGH);
-            delay(100);
-        }
-    } else {
-        Serial.printf("\n✗ Low confidence: %.1f%% (threshold: %.1f%%)\n", 
-                     best_confidence * 100, 
-                     CONFIDENCE_THRESHOLD * 100);
-        Serial.println("Please reposition the item or improve lighting");
-        
-        // Update global even for low confidence
-        lastCategory = "Low confidence";
-        lastConfidence = best_confidence;
-        lastClassificationTime = millis();
-    }
-
-    Serial.println("---\n");
-
-    // Clean up
-    free(snapshot_buf);
+    // Capture, inference and reporting run in their own tasks
+    delay(20);
 }
@@ -0,0 +1,153 @@
+#include "pipeline.h"
+
+Pipeline::Pipeline(const PipelineStages &stages, int8_t *slot_memory, size_t slot_size)
+    : stages_(stages),
+      slot_memory_(slot_memory),
+      slot_size_(slot_size),
+      interval_ms_(0),
+      paused_(false),
+      running_(true),
+      captured_once_(false),
+      waiting_(false),
+      held_slot_(-1),
+      last_capture_ms_(0),
+      sequence_(0),
+      captured_(0),
+      capture_failed_(0),
+      capture_waits_(0),
+      inferred_(0),
+      inference_failed_(0),
+      reported_(0),
+      dropped_(0) {
+    // the free queue is produced by the inference thread later on, this runs
+    // before any stage thread exists
+    for (uint8_t ix = 0; ix < PIPELINE_SLOTS; ix++) {
+        free_.push(ix);
+    }
+}
+
+bool Pipeline::capture_step() {
+    if (paused_) {
+        return false;
+    }
+
+    uint32_t now = stages_.now_ms(stages_.user);
+    if (captured_once_ && now - last_capture_ms_ < interval_ms_) {
+        return false;
+    }
+
+    // a slot whose capture failed is kept here, only the inference thread
+    // may push to the free queue
+    uint8_t ix;
+    if (held_slot_ >= 0) {
+        ix = (uint8_t)held_slot_;
+        held_slot_ = -1;
+    }
+    else if (!free_.pop(ix)) {
+        // both slots are queued or in the model, count each stall once
+        if (!waiting_) {
+            capture_waits_++;
+            waiting_ = true;
+        }
+        return false;
+    }
+    waiting_ = false;
+
+    captured_once_ = true;
+    last_capture_ms_ = now;
+
+    PipelineFrameInfo *info = &slot_info_[ix];
+    info->sequence = sequence_++;
+    info->captured_ms = now;
+    info->dsp_us = 0;
+    if (!stages_.capture(stages_.user, slot(ix), slot_size_, info)) {
+        capture_failed_++;
+        held_slot_ = ix;
+        return true;
+    }
+
+    captured_++;
+    // cannot fail, there are fewer slots than queue entries
+    ready_.push(ix);
+    return true;
+}
+
+bool Pipeline::inference_step() {
+    uint8_t ix;
+    if (!ready_.pop(ix)) {
+        return false;
+    }
+
+    const PipelineFrameInfo *info = &slot_info_[ix];
+    PipelinePrediction prediction = {};
+    prediction.sequence = info->sequence;
+    prediction.captured_ms = info->captured_ms;
+    prediction.dsp_us = info->dsp_us;
+    prediction.label = -1;
+
+    bool ok = stages_.infer(stages_.user, slot(ix), slot_size_, &prediction);
+    prediction.classified_ms = stages_.now_ms(stages_.user);
+
+    // the features were copied into the model, capture can refill the slot
+    free_.push(ix);
+
+    if (!ok) {
+        inference_failed_++;
+        return true;
+    }
+
+    inferred_++;
+    if (!predictions_.push(prediction)) {
+        // never hold up the model for a slow network
+        dropped_++;
+    }
+    return true;
+}
+
+bool Pipeline::report_step() {
+    PipelinePrediction prediction;
+    if (!predictions_.pop(prediction)) {
+        return false;
+    }
+    stages_.report(stages_.user, &prediction);
+    reported_++;
+    return true;
+}
+
+void Pipeline::run_capture() {
+    while (running_) {
+        if (!capture_step()) {
+            stages_.idle(stages_.user);
+        }
+    }
+}
+
+void Pipeline::run_inference() {
+    while (running_) {
+        if (!inference_step()) {
+            stages_.idle(stages_.user);
+        }
+    }
+}
+
+void Pipeline::run_report() {
+    while (running_) {
+        if (!report_step()) {
+            stages_.idle(stages_.user);
+        }
+    }
+}
+
+PipelineStats Pipeline::stats() const {
+    PipelineStats s;
+    s.captured = captured_;
+    s.capture_failed = capture_failed_;
+    s.capture_waits = capture_waits_;
+    s.inferred = inferred_;
+    s.inference_failed = inference_failed_;
+    s.reported = reported_;
+    s.dropped = dropped_;
+    s.ready_max_depth = (uint32_t)ready_.max_depth();
+    s.report_max_depth = (uint32_t)predictions_.max_depth();
+    return s;
+}
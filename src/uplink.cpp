@@ -0,0 +1,260 @@
+#include "uplink.h"
+
+#include <string.h>
+
+static size_t clamp_length(const char *s) {
+    size_t length = s ? strlen(s) : 0;
+    return length > 255 ? 255 : length;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+#define UPLINK_HELD           1u
+#define UPLINK_HELD_WRITING   2u
+#define UPLINK_HELD_VERSION   4u
+
+static void load_held(const std::atomic<uint32_t> *words, UplinkRecord &record) {
+    record.sequence = words[0].load(std::memory_order_relaxed);
+    record.device_ms = words[1].load(std::memory_order_relaxed);
+    uint32_t w2 = words[2].load(std::memory_order_relaxed);
+    record.confidence = (uint16_t)w2;
+    record.label = (uint8_t)(w2 >> 16);
+    record.count = (uint8_t)(w2 >> 24);
+}
+
+Uplink::Uplink(const UplinkTransport &transport, const char *device_id, const char *const *labels, uint8_t label_count)
+    : transport_(transport),
+      held_state_(0),
+      batch_count_(0),
+      oldest_ms_(0),
+      retry_at_ms_(0),
+      retry_delay_ms_(0),
+      running_(true),
+      submitted_(0),
+      coalesced_(0),
+      dropped_(0),
+      sent_(0),
+      batches_(0),
+      failures_(0) {
+    // everything up to the records is the same for every batch, build it once
+    size_t id_length = clamp_length(device_id);
+    header_size_ = 12 + id_length;
+    for (uint8_t ix = 0; ix < label_count; ix++) {
+        header_size_ += 1 + clamp_length(labels[ix]);
+    }
+    buffer_ = new uint8_t[header_size_ + UPLINK_BATCH_MAX * UPLINK_RECORD_SIZE];
+
+    uint8_t *p = buffer_;
+    memcpy(p, "WCB1", 4);
+    p[4] = UPLINK_BATCH_VERSION;
+    p[5] = (uint8_t)id_length;
+    p[6] = label_count;
+    p += 12;    // record count and send time are filled in by encode()
+    memcpy(p, device_id, id_length);
+    p += id_length;
+    for (uint8_t ix = 0; ix < label_count; ix++) {
+        size_t length = clamp_length(labels[ix]);
+        *p++ = (uint8_t)length;
+        memcpy(p, labels[ix], length);
+        p += length;
+    }
+}
+
+Uplink::~Uplink() {
+    delete[] buffer_;
+}
+
+void Uplink::submit(uint32_t sequence, uint32_t device_ms, int label, float confidence) {
+    if (label < 0 || label > 255) {
+        return;
+    }
+    submitted_++;
+
+    UplinkRecord record;
+    record.sequence = sequence;
+    record.device_ms = device_ms;
+    record.confidence = (uint16_t)(confidence <= 0 ? 0 : confidence >= 1 ? 65535 : confidence * 65535.0f + 0.5f);
+    record.label = (uint8_t)label;
+    record.count = 1;
+
+    // whatever was held back goes first, to keep the order
+    UplinkRecord held;
+    bool holding = claim_held(held);
+    if (holding && ring_.push(held)) {
+        holding = false;
+    }
+    if (!holding && ring_.push(record)) {
+        release_held(NULL);
+        return;
+    }
+
+    // ring full: fold repeated labels together, otherwise keep only the newest
+    if (holding && held.label == record.label && held.count < 255) {
+        held.count++;
+        held.sequence = record.sequence;
+        held.device_ms = record.device_ms;
+        if (record.confidence > held.confidence) {
+            held.confidence = record.confidence;
+        }
+        coalesced_++;
+        release_held(&held);
+        return;
+    }
+    if (holding) {
+        dropped_ += held.count;
+    }
+    release_held(&record);
+}
+
+// Producer: take the held record over, false if there is none (or the
+// consumer just took it). Must be followed by release_held().
+bool Uplink::claim_held(UplinkRecord &record) {
+    uint32_t state = held_state_.load(std::memory_order_acquire);
+    while (state & UPLINK_HELD) {
+        if (held_state_.compare_exchange_weak(state, state | UPLINK_HELD_WRITING, std::memory_order_acq_rel)) {
+            load_held(held_words_, record);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Producer: hold record back, or nothing when it is NULL
+void Uplink::release_held(const UplinkRecord *record) {
+    uint32_t state = held_state_.load(std::memory_order_relaxed);
+    uint32_t version = (state & ~(UPLINK_HELD | UPLINK_HELD_WRITING)) + UPLINK_HELD_VERSION;
+    if (!record) {
+        held_state_.store(version, std::memory_order_release);
+        return;
+    }
+    // the consumer leaves the words alone, they are claimed or not held
+    held_words_[0].store(record->sequence, std::memory_order_relaxed);
+    held_words_[1].store(record->device_ms, std::memory_order_relaxed);
+    held_words_[2].store((uint32_t)record->confidence | (uint32_t)record->label << 16 | (uint32_t)record->count << 24,
+        std::memory_order_relaxed);
+    held_state_.store(version | UPLINK_HELD, std::memory_order_release);
+}
+
+// Consumer: take the held record, false if there is none or the producer is
+// changing it. Call only once the ring is empty, whatever is in it is older.
+bool Uplink::take_held(UplinkRecord &record) {
+    uint32_t state = held_state_.load(std::memory_order_acquire);
+    if ((state & (UPLINK_HELD | UPLINK_HELD_WRITING)) != UPLINK_HELD) {
+        return false;
+    }
+    UplinkRecord copy;
+    load_held(held_words_, copy);
+    // fails if the producer claimed or rewrote the record since the load above
+    uint32_t taken = (state & ~UPLINK_HELD) + UPLINK_HELD_VERSION;
+    if (!held_state_.compare_exchange_strong(state, taken, std::memory_order_acq_rel)) {
+        return false;
+    }
+    record = copy;
+    return true;
+}
+
+size_t Uplink::encode(uint32_t now) {
+    buffer_[7] = batch_count_;
+    put_u32(buffer_ + 8, now);
+
+    uint8_t *p = buffer_ + header_size_;
+    for (uint8_t ix = 0; ix < batch_count_; ix++) {
+        const UplinkRecord &r = batch_[ix];
+        p = put_u32(p, r.sequence);
+        p = put_u32(p, r.device_ms);
+        p = put_u16(p, r.confidence);
+        *p++ = r.label;
+        *p++ = r.count;
+    }
+    return (size_t)(p - buffer_);
+}
+
+bool Uplink::flush_step() {
+    uint32_t now = transport_.now_ms(transport_.user);
+
+    // a failed batch stays put until it goes through or is rejected, newer records wait in the ring
+    if (retry_delay_ms_ == 0) {
+        UplinkRecord record;
+        while (batch_count_ < UPLINK_BATCH_MAX && ring_.pop(record)) {
+            if (batch_count_ == 0) {
+                oldest_ms_ = now;
+            }
+            batch_[batch_count_++] = record;
+        }
+        // ring drained: the record held back is the newest, it would otherwise
+        // wait for the next submit()
+        if (batch_count_ < UPLINK_BATCH_MAX && take_held(record)) {
+            if (batch_count_ == 0) {
+                oldest_ms_ = now;
+            }
+            batch_[batch_count_++] = record;
+        }
+        if (batch_count_ == 0) {
+            return false;
+        }
+        if (batch_count_ < UPLINK_BATCH_MAX && now - oldest_ms_ < UPLINK_FLUSH_MS) {
+            return false;
+        }
+    }
+    else if ((int32_t)(now - retry_at_ms_) < 0) {
+        return false;
+    }
+
+    size_t length = encode(now);
+    UplinkSendResult result = transport_.send(transport_.user, buffer_, length);
+    if (result == UPLINK_FAILED) {
+        failures_++;
+        retry_delay_ms_ = retry_delay_ms_ ? retry_delay_ms_ * 2 : UPLINK_RETRY_MIN_MS;
+        if (retry_delay_ms_ > UPLINK_RETRY_MAX_MS) {
+            retry_delay_ms_ = UPLINK_RETRY_MAX_MS;
+        }
+        retry_at_ms_ = transport_.now_ms(transport_.user) + retry_delay_ms_;
+        return true;
+    }
+
+    uint32_t records = 0;
+    for (uint8_t ix = 0; ix < batch_count_; ix++) {
+        records += batch_[ix].count;
+    }
+    if (result == UPLINK_REJECTED) {
+        dropped_ += records;
+    } else {
+        sent_ += records;
+        batches_++;
+    }
+    batch_count_ = 0;
+    retry_delay_ms_ = 0;
+    return true;
+}
+
+void Uplink::run() {
+    while (running_) {
+        if (!flush_step()) {
+            transport_.idle(transport_.user);
+        }
+    }
+}
+
+UplinkStats Uplink::stats() const {
+    UplinkStats s;
+    s.submitted = submitted_;
+    s.coalesced = coalesced_;
+    s.dropped = dropped_;
+    s.sent = sent_;
+    s.batches = batches_;
+    s.failures = failures_;
+    s.max_depth = (uint32_t)ring_.max_depth();
+    return s;
+}